@@ -0,0 +1,5 @@
+int DrvGpioOpen(int gpio);
+
+int DrvGpioWrite(int fd, int level);
+
+void DrvGpioClose(int fd);
@@ -0,0 +1,181 @@
+typedef struct
+
+{
+
+    long baud;
+
+    unsigned char mem_mode;
+
+    unsigned char rotation;
+
+    unsigned char en_font;
+
+    unsigned char ch_font;
+
+    unsigned char color;
+
+    unsigned char bkcolor;
+
+} lib_epd_state_t;
+
+
+
+
+
+typedef struct
+
+{
+
+    int (*write)(const unsigned char * ptr, int n);
+
+    int (*flush)(void);
+
+} lib_epd_layer_t;
+
+typedef struct
+
+{
+
+    unsigned char * data;
+
+    int len;
+
+    int size;
+
+    int frames;
+
+} lib_epd_scene_t;
+
+
+
+void LibEpdInit(void);
+
+int LibEpdInitSpeed(int speed);
+
+int LibEpdInitDev(const char * dev_name, int speed);
+
+int LibEpdSetLowLatency(int on);
+
+long long LibEpdDrain(void);
+
+void LibEpdGetState(lib_epd_state_t * state);
+
+void LibEpdSetState(const lib_epd_state_t * state);
+
+void LibEpdGetSentState(lib_epd_state_t * state);
+
+void LibEpdSetSentState(const lib_epd_state_t * state);
+
+void LibEpdNoteSent(const unsigned char * ptr, int n);
+
+void LibEpdClose(void);
+
+void LibEpdReset(void);
+
+void LibEpdWakeup(void);
+
+int LibEpdSetWakeupGpio(int gpio);
+
+int LibEpdWakeupWired(void);
+
+
+
+int LibEpdHandshake(void);
+
+int LibEpdWaitReady(void);
+
+int LibEpdWaitReadyUs(long timeout_us);
+
+void LibEpdSetBaud(long baud);
+
+void lib_epd_read_baud(void);
+
+void LibEpdSetMemory(unsigned char mode);
+
+void LibEpdEnterStopMode(void);
+
+void LibEpdUpdate(void);
+
+void LibEpdScreenRotation(unsigned char mode);
+
+void LibEpdSetOrientation(int orientation);
+
+int LibEpdGetOrientation(void);
+
+int LibEpdTextNeedsHost(void);
+
+void LibEpdLoadFont(void);
+
+void LibEpdLoadPic(void);
+
+
+
+void LibEpdSetColor(unsigned char color, unsigned char bkcolor);
+
+void LibEpdSetEnFont(unsigned char font);
+
+void LibEpdSetChFont(unsigned char font);
+
+
+
+void LibEpdDrawPixel(int x0, int y0);
+
+void LibEpdDrawLine(int x0, int y0, int x1, int y1);
+
+void LibEpdFillRect(int x0, int y0, int x1, int y1);
+
+void LibEpdDrawCircle(int x0, int y0, int r);
+
+void LibEpdFillCircle(int x0, int y0, int r);
+
+void LibEpdDrawTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+
+void LibEpdFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+
+void LibEpdClear(void);
+
+
+
+void LibEpdDispChar(unsigned char ch, int x0, int y0);
+
+void LibEpdDispString(const void * p, int x0, int y0);
+
+int LibEpdDispStringUtf8(const char * utf8, int x0, int y0);
+
+
+
+void LibEpdDispBitmap(const void * p, int x0, int y0);
+
+
+
+int LibEpdFrameLen(const unsigned char * ptr);
+
+int LibEpdFrameValid(const unsigned char * ptr, int n);
+
+int LibEpdSendFrames(const unsigned char * ptr, int n);
+
+
+
+void LibEpdSetLayer(int layer, const lib_epd_layer_t * ops);
+
+int LibEpdWrite(const unsigned char * ptr, int n);
+
+int LibEpdWriteAfter(int layer, const unsigned char * ptr, int n);
+
+
+
+void LibEpdSceneInit(lib_epd_scene_t * scene);
+
+void LibEpdSceneFree(lib_epd_scene_t * scene);
+
+void LibEpdSceneReset(lib_epd_scene_t * scene);
+
+int LibEpdSceneAppend(lib_epd_scene_t * scene, const unsigned char * ptr, int n);
+
+int LibEpdSceneCopy(lib_epd_scene_t * dst, const lib_epd_scene_t * src);
+
+void LibEpdSceneBegin(lib_epd_scene_t * scene);
+
+void LibEpdSceneEnd(void);
+
+int LibEpdSceneSend(const lib_epd_scene_t * scene);
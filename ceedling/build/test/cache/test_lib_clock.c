@@ -0,0 +1,162 @@
+#include "mock_drv_gpio.h"
+#include "mock_drv_uart.h"
+#include "lib_epd_mem.h"
+#include "lib_gbk.h"
+#include "lib_epd_sched.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "common.h"
+#include "unity.h"
+
+
+void setUp(void)
+
+{
+
+ LibClockUseVirtual();
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+ LibClockUseReal();
+
+}
+
+
+
+void testVirtualSleepAdvancesSimulatedTime(void)
+
+{
+
+ long long t0 = LibClockNowUs();
+
+
+
+ LibClockSleepUs(5000000);
+
+ UnityAssertEqualNumber((UNITY_INT)((5000000)), (UNITY_INT)((LibClockNowUs() - t0)), (
+
+((void *)0)
+
+), (UNITY_UINT)(26), UNITY_DISPLAY_STYLE_INT64);
+
+
+
+ LibClockAdvanceUs(250);
+
+ UnityAssertEqualNumber((UNITY_INT)((5000250)), (UNITY_INT)((LibClockNowUs() - t0)), (
+
+((void *)0)
+
+), (UNITY_UINT)(29), UNITY_DISPLAY_STYLE_INT64);
+
+}
+
+
+
+void testResetSleepsInSimulatedTime(void)
+
+{
+
+ long long t0 = LibClockNowUs();
+
+
+
+ LibEpdReset();
+
+ UnityAssertEqualNumber((UNITY_INT)((3000510)), (UNITY_INT)((LibClockNowUs() - t0)), (
+
+((void *)0)
+
+), (UNITY_UINT)(37), UNITY_DISPLAY_STYLE_INT64);
+
+}
+
+
+
+void testSchedulerCoalescesInSimulatedTime(void)
+
+{
+
+ lib_epd_sched_stats_t stats;
+
+
+
+ DrvUartPutchars_CMockIgnoreAndReturn(44, 9);
+
+ LibEpdSchedInit(100, 1000, 2000);
+
+
+
+ LibEpdSchedRequest();
+
+ LibClockAdvanceUs(50000);
+
+ LibEpdSchedRequest();
+
+ LibClockAdvanceUs(50000);
+
+ LibEpdSchedRequest();
+
+ if (!(LibEpdSchedPoll())) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(52)));};
+
+
+
+ LibClockAdvanceUs(100000);
+
+ if ((LibEpdSchedPoll())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(55)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((-1)), (UNITY_INT)((LibEpdSchedNextDue())), (
+
+((void *)0)
+
+), (UNITY_UINT)(56), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+ LibEpdSchedRequest();
+
+ LibClockAdvanceUs(150000);
+
+ if (!(LibEpdSchedPoll())) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(61)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((1850)), (UNITY_INT)((LibEpdSchedNextDue())), (
+
+((void *)0)
+
+), (UNITY_UINT)(62), UNITY_DISPLAY_STYLE_INT);
+
+ LibEpdSchedFlush();
+
+ UnityAssertEqualNumber((UNITY_INT)((-1)), (UNITY_INT)((LibEpdSchedNextDue())), (
+
+((void *)0)
+
+), (UNITY_UINT)(64), UNITY_DISPLAY_STYLE_INT);
+
+
+
+ LibEpdSchedGetStats(&stats);
+
+ UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((stats.requests)), (
+
+((void *)0)
+
+), (UNITY_UINT)(67), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((stats.refreshes)), (
+
+((void *)0)
+
+), (UNITY_UINT)(68), UNITY_DISPLAY_STYLE_INT);
+
+ LibEpdSchedClose();
+
+}
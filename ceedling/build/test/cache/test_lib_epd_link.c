@@ -0,0 +1,492 @@
+#include "mock_drv_uart.h"
+#include "mock_lib_epd.h"
+#include "lib_epd_link.h"
+#include "lib_epd_cost.h"
+#include "lib_clock.h"
+#include "common.h"
+#include "unity.h"
+static int s_sends[64];
+
+static int s_errors_left[64];
+
+static int s_drops_left[64];
+
+static int s_wire[4 * 64];
+
+static int s_wire_head;
+
+static int s_wire_tail;
+
+static int s_resyncs;
+
+
+
+
+
+static void _Rect(unsigned char * f, int id)
+
+{
+
+ int i;
+
+
+
+ memset(f, 0, 17);
+
+ f[0] = 0xA5;
+
+ f[2] = 17;
+
+ f[3] = 0x24;
+
+ f[5] = (unsigned char) id;
+
+ f[9] = 10;
+
+ f[11] = 10;
+
+ f[12] = 0xCC;
+
+ f[13] = 0x33;
+
+ f[14] = 0xC3;
+
+ f[15] = 0x3C;
+
+ for (i = 0; i < 17 - 1; i++)
+
+ {
+
+  f[17 - 1] ^= f[i];
+
+ }
+
+}
+
+
+
+static int _FrameLen(const unsigned char * ptr, int num_calls)
+
+{
+
+ (void) num_calls;
+
+ return (ptr[1] << 8) | ptr[2];
+
+}
+
+
+
+
+
+static int _WriteAfter(int layer, const unsigned char * ptr, int n, int num_calls)
+
+{
+
+ int id = ptr[5];
+
+
+
+ (void) num_calls;
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((layer)), (
+
+((void *)0)
+
+), (UNITY_UINT)(58), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((17)), (UNITY_INT)((n)), (
+
+((void *)0)
+
+), (UNITY_UINT)(59), UNITY_DISPLAY_STYLE_INT);
+
+ s_sends[id]++;
+
+ if (s_drops_left[id] > 0)
+
+ {
+
+  s_drops_left[id]--;
+
+  return n;
+
+ }
+
+ if (s_errors_left[id] > 0)
+
+ {
+
+  s_errors_left[id]--;
+
+  s_wire[s_wire_tail++] = 1;
+
+ }
+
+ else
+
+ {
+
+  s_wire[s_wire_tail++] = 0;
+
+ }
+
+ return n;
+
+}
+
+
+
+
+
+static int _Read(unsigned char * ptr, int n, long timeout_us, int num_calls)
+
+{
+
+ (void) num_calls;
+
+ if ((n >= 5)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(82)));};
+
+ if (s_wire_head == s_wire_tail)
+
+ {
+
+  LibClockAdvanceUs(timeout_us);
+
+  return 0;
+
+ }
+
+ LibClockAdvanceUs(1000);
+
+ if (s_wire[s_wire_head++] == 1)
+
+ {
+
+  memcpy(ptr, "Error", 5);
+
+  return 5;
+
+ }
+
+ memcpy(ptr, "OK", 2);
+
+ return 2;
+
+}
+
+
+
+static void _FlushInput(int num_calls)
+
+{
+
+ (void) num_calls;
+
+ s_resyncs++;
+
+}
+
+
+
+
+
+static void _WriteRects(int n)
+
+{
+
+ unsigned char f[17];
+
+ int id;
+
+
+
+ for (id = 0; id < n; id++)
+
+ {
+
+  _Rect(f, id);
+
+  UnityAssertEqualNumber((UNITY_INT)((17)), (UNITY_INT)((LibEpdLinkWrite(f, 17))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(113), UNITY_DISPLAY_STYLE_INT);
+
+ }
+
+}
+
+
+
+void setUp(void)
+
+{
+
+ LibClockUseVirtual();
+
+ memset(s_sends, 0, sizeof(s_sends));
+
+ memset(s_errors_left, 0, sizeof(s_errors_left));
+
+ memset(s_drops_left, 0, sizeof(s_drops_left));
+
+ s_wire_head = 0;
+
+ s_wire_tail = 0;
+
+ s_resyncs = 0;
+
+
+
+ LibEpdFrameLen_StubWithCallback(_FrameLen);
+
+ LibEpdWriteAfter_StubWithCallback(_WriteAfter);
+
+ LibEpdSetLayer_CMockIgnore();
+
+ DrvUartRead_StubWithCallback(_Read);
+
+ DrvUartFlushInput_StubWithCallback(_FlushInput);
+
+ DrvUartBitsPerByte_CMockIgnoreAndReturn(132, 10);
+
+ DrvUartGetSpeed_CMockIgnoreAndReturn(133, 115200);
+
+ LibEpdLinkOpen(8);
+
+ s_resyncs = 0;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+ LibEpdLinkClose();
+
+ LibClockUseReal();
+
+}
+
+
+
+void testRepliesAcknowledgeTheFramesInOrder(void)
+
+{
+
+ lib_epd_link_stats_t st;
+
+ int id;
+
+
+
+ _WriteRects(20);
+
+ if ((LibEpdLinkFlush())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(150)));};
+
+ for (id = 0; id < 20; id++)
+
+ {
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((s_sends[id])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(153), UNITY_DISPLAY_STYLE_INT);
+
+ }
+
+ LibEpdLinkGetStats(&st);
+
+ UnityAssertEqualNumber((UNITY_INT)((20)), (UNITY_INT)((st.frames)), (
+
+((void *)0)
+
+), (UNITY_UINT)(156), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((st.resent)), (
+
+((void *)0)
+
+), (UNITY_UINT)(157), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_resyncs)), (
+
+((void *)0)
+
+), (UNITY_UINT)(158), UNITY_DISPLAY_STYLE_INT);
+
+
+
+ if ((st.window > 4)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(160)));};
+
+}
+
+
+
+void testErrorResendsOnlyThatFrame(void)
+
+{
+
+ lib_epd_link_stats_t st;
+
+ int id;
+
+
+
+ s_errors_left[5] = 1;
+
+ _WriteRects(12);
+
+ if ((LibEpdLinkFlush())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(170)));};
+
+ for (id = 0; id < 12; id++)
+
+ {
+
+  UnityAssertEqualNumber((UNITY_INT)(((id == 5) ? 2 : 1)), (UNITY_INT)((s_sends[id])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(173), UNITY_DISPLAY_STYLE_INT);
+
+ }
+
+ LibEpdLinkGetStats(&st);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.errors)), (
+
+((void *)0)
+
+), (UNITY_UINT)(176), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.resent)), (
+
+((void *)0)
+
+), (UNITY_UINT)(177), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((12)), (UNITY_INT)((st.frames)), (
+
+((void *)0)
+
+), (UNITY_UINT)(178), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((st.timeouts)), (
+
+((void *)0)
+
+), (UNITY_UINT)(179), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_resyncs)), (
+
+((void *)0)
+
+), (UNITY_UINT)(180), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testLostReplyResendsSinceTheSyncPoint(void)
+
+{
+
+ lib_epd_link_stats_t st;
+
+ int id;
+
+
+
+
+
+
+
+ s_drops_left[2] = 1;
+
+ _WriteRects(6);
+
+ if ((LibEpdLinkFlush())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(192)));};
+
+ for (id = 0; id < 6; id++)
+
+ {
+
+  if ((s_sends[id] >= 1)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(195)));};
+
+ }
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((s_sends[2])), (
+
+((void *)0)
+
+), (UNITY_UINT)(197), UNITY_DISPLAY_STYLE_INT);
+
+ if ((s_resyncs >= 1)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(198)));};
+
+ LibEpdLinkGetStats(&st);
+
+ if ((st.timeouts >= 1)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(200)));};
+
+ if ((st.resent >= 1)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(201)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((st.lost)), (
+
+((void *)0)
+
+), (UNITY_UINT)(202), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_wire_tail - s_wire_head)), (
+
+((void *)0)
+
+), (UNITY_UINT)(203), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testFrameGivenUpAfterAllTries(void)
+
+{
+
+ lib_epd_link_stats_t st;
+
+
+
+ s_errors_left[1] = 5;
+
+ _WriteRects(3);
+
+ if (!(LibEpdLinkFlush())) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(212)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((s_sends[1])), (
+
+((void *)0)
+
+), (UNITY_UINT)(213), UNITY_DISPLAY_STYLE_INT);
+
+ LibEpdLinkGetStats(&st);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.lost)), (
+
+((void *)0)
+
+), (UNITY_UINT)(215), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((st.frames)), (
+
+((void *)0)
+
+), (UNITY_UINT)(216), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+ if ((LibEpdLinkFlush())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(219)));};
+
+}
@@ -0,0 +1,331 @@
+#include "mock_lib_epd.h"
+#include "lib_epd_shape.h"
+#include "common.h"
+#include "unity.h"
+
+
+static long s_area2;
+
+static int s_triangles;
+
+
+
+static void _FillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, int num_calls)
+
+{
+
+ long cross = (long) (x1 - x0) * (y2 - y0) - (long) (y1 - y0) * (x2 - x0);
+
+
+
+ (void) num_calls;
+
+ if ((cross != 0)) {} else {UnityFail( ((("degenerate triangle"))), (UNITY_UINT)((UNITY_UINT)(14)));};
+
+ s_area2 += (cross > 0) ? cross : -cross;
+
+ s_triangles++;
+
+}
+
+
+
+void setUp(void)
+
+{
+
+ s_area2 = 0;
+
+ s_triangles = 0;
+
+ LibEpdFillTriangle_StubWithCallback(_FillTriangle);
+
+}
+
+
+
+void tearDown(void)
+
+{}
+
+
+
+void testConvexPolygonIsAFan(void)
+
+{
+
+ const int xy[] = { 0, 0, 40, 0, 50, 30, 20, 50, -10, 30 };
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((LibEpdFillPolygon(xy, 5, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(33), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((s_triangles)), (
+
+((void *)0)
+
+), (UNITY_UINT)(34), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 2100)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(35), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testConcavePolygonIsCoveredOnce(void)
+
+{
+
+
+
+ const int xy[] = { 0, 0, 20, 0, 20, 10, 10, 10, 10, 20, 0, 20 };
+
+ lib_epd_shape_stats_t stats;
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((LibEpdFillPolygon(xy, 6, &stats))), (
+
+((void *)0)
+
+), (UNITY_UINT)(44), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((stats.frames)), (
+
+((void *)0)
+
+), (UNITY_UINT)(45), UNITY_DISPLAY_STYLE_INT);
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 300)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(47), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testConcavePolygonEitherWinding(void)
+
+{
+
+
+
+ const int cw[] = { 0, 10, 30, 10, 30, 0, 50, 20, 30, 40, 30, 30, 0, 30 };
+
+ const int ccw[] = { 0, 30, 30, 30, 30, 40, 50, 20, 30, 0, 30, 10, 0, 10 };
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((LibEpdFillPolygon(cw, 7, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(56), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 1000)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(57), UNITY_DISPLAY_STYLE_INT);
+
+
+
+ s_area2 = 0;
+
+ UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((LibEpdFillPolygon(ccw, 7, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(60), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 1000)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(61), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCollinearVerticesMakeNoDegenerateTriangle(void)
+
+{
+
+
+
+ const int xy[] = { 0, 0, 10, 0, 20, 0, 20, 20, 0, 20, 0, 10 };
+
+ int frames;
+
+
+
+ frames = LibEpdFillPolygon(xy, 6, 
+
+                                  ((void *)0)
+
+                                      );
+
+ if ((frames <= 6 - 2)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(71)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((frames)), (UNITY_INT)((s_triangles)), (
+
+((void *)0)
+
+), (UNITY_UINT)(72), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 400)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(73), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testConcavePolygonWithCollinearVertices(void)
+
+{
+
+
+
+ const int xy[] = { 0, 0, 10, 0, 10, 20, 10, 30, 20, 30, 20, 0, 30, 0, 30, 40, 15, 40, 0, 40 };
+
+ int frames;
+
+
+
+ frames = LibEpdFillPolygon(xy, 10, 
+
+                                   ((void *)0)
+
+                                       );
+
+ if ((frames <= 10 - 2)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(83)));};
+
+ UnityAssertEqualNumber((UNITY_INT)((frames)), (UNITY_INT)((s_triangles)), (
+
+((void *)0)
+
+), (UNITY_UINT)(84), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2 * 900)), (UNITY_INT)((s_area2)), (
+
+((void *)0)
+
+), (UNITY_UINT)(85), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testPolygonOnALineSendsNothing(void)
+
+{
+
+ const int xy[] = { 0, 0, 10, 5, 20, 10, 30, 15 };
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((LibEpdFillPolygon(xy, 4, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(92), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_triangles)), (
+
+((void *)0)
+
+), (UNITY_UINT)(93), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testPolygonOutOfRangeSendsNothing(void)
+
+{
+
+ static int xy[2 * (64 + 1)];
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((-1)), (UNITY_INT)((LibEpdFillPolygon(xy, 2, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(100), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((-1)), (UNITY_INT)((LibEpdFillPolygon(xy, 64 + 1, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(101), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_triangles)), (
+
+((void *)0)
+
+), (UNITY_UINT)(102), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRoundRectWithLargestArcs(void)
+
+{
+
+
+
+ LibEpdDrawLine_CMockIgnore();
+
+ UnityAssertEqualNumber((UNITY_INT)((4 * 91)), (UNITY_INT)((LibEpdDrawRoundRect(0, 0, 30000, 30000, 14000, 
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(109), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,312 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_drv_gpio.h"
+
+static const char* CMockString_DrvGpioClose = "DrvGpioClose";
+static const char* CMockString_DrvGpioOpen = "DrvGpioOpen";
+static const char* CMockString_DrvGpioWrite = "DrvGpioWrite";
+static const char* CMockString_fd = "fd";
+static const char* CMockString_gpio = "gpio";
+static const char* CMockString_level = "level";
+
+typedef struct _CMOCK_DrvGpioOpen_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_gpio;
+
+} CMOCK_DrvGpioOpen_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvGpioWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_fd;
+  int Expected_level;
+
+} CMOCK_DrvGpioWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvGpioClose_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_fd;
+
+} CMOCK_DrvGpioClose_CALL_INSTANCE;
+
+static struct mock_drv_gpioInstance
+{
+  int DrvGpioOpen_IgnoreBool;
+  int DrvGpioOpen_FinalReturn;
+  CMOCK_DrvGpioOpen_CALLBACK DrvGpioOpen_CallbackFunctionPointer;
+  int DrvGpioOpen_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvGpioOpen_CallInstance;
+  int DrvGpioWrite_IgnoreBool;
+  int DrvGpioWrite_FinalReturn;
+  CMOCK_DrvGpioWrite_CALLBACK DrvGpioWrite_CallbackFunctionPointer;
+  int DrvGpioWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvGpioWrite_CallInstance;
+  int DrvGpioClose_IgnoreBool;
+  CMOCK_DrvGpioClose_CALLBACK DrvGpioClose_CallbackFunctionPointer;
+  int DrvGpioClose_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvGpioClose_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_drv_gpio_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.DrvGpioOpen_IgnoreBool)
+    Mock.DrvGpioOpen_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvGpioOpen);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvGpioOpen_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvGpioOpen_CallbackFunctionPointer != NULL)
+    Mock.DrvGpioOpen_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvGpioWrite_IgnoreBool)
+    Mock.DrvGpioWrite_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvGpioWrite);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvGpioWrite_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvGpioWrite_CallbackFunctionPointer != NULL)
+    Mock.DrvGpioWrite_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvGpioClose_IgnoreBool)
+    Mock.DrvGpioClose_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvGpioClose);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvGpioClose_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvGpioClose_CallbackFunctionPointer != NULL)
+    Mock.DrvGpioClose_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_drv_gpio_Init(void)
+{
+  mock_drv_gpio_Destroy();
+}
+
+void mock_drv_gpio_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.DrvGpioOpen_CallbackFunctionPointer = NULL;
+  Mock.DrvGpioOpen_CallbackCalls = 0;
+  Mock.DrvGpioWrite_CallbackFunctionPointer = NULL;
+  Mock.DrvGpioWrite_CallbackCalls = 0;
+  Mock.DrvGpioClose_CallbackFunctionPointer = NULL;
+  Mock.DrvGpioClose_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+int DrvGpioOpen(int gpio)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvGpioOpen_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvGpioOpen);
+  cmock_call_instance = (CMOCK_DrvGpioOpen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvGpioOpen_CallInstance);
+  Mock.DrvGpioOpen_CallInstance = CMock_Guts_MemNext(Mock.DrvGpioOpen_CallInstance);
+  if (Mock.DrvGpioOpen_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvGpioOpen_FinalReturn;
+    Mock.DrvGpioOpen_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvGpioOpen_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvGpioOpen_CallbackFunctionPointer(gpio, Mock.DrvGpioOpen_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvGpioOpen,CMockString_gpio);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_gpio, gpio, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvGpioOpen(CMOCK_DrvGpioOpen_CALL_INSTANCE* cmock_call_instance, int gpio)
+{
+  cmock_call_instance->Expected_gpio = gpio;
+}
+
+void DrvGpioOpen_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvGpioOpen_CALL_INSTANCE));
+  CMOCK_DrvGpioOpen_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvGpioOpen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvGpioOpen_CallInstance = CMock_Guts_MemChain(Mock.DrvGpioOpen_CallInstance, cmock_guts_index);
+  Mock.DrvGpioOpen_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvGpioOpen_IgnoreBool = (int)1;
+}
+
+void DrvGpioOpen_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int gpio, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvGpioOpen_CALL_INSTANCE));
+  CMOCK_DrvGpioOpen_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvGpioOpen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvGpioOpen_CallInstance = CMock_Guts_MemChain(Mock.DrvGpioOpen_CallInstance, cmock_guts_index);
+  Mock.DrvGpioOpen_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvGpioOpen(cmock_call_instance, gpio);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvGpioOpen_StubWithCallback(CMOCK_DrvGpioOpen_CALLBACK Callback)
+{
+  Mock.DrvGpioOpen_CallbackFunctionPointer = Callback;
+}
+
+int DrvGpioWrite(int fd, int level)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvGpioWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvGpioWrite);
+  cmock_call_instance = (CMOCK_DrvGpioWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvGpioWrite_CallInstance);
+  Mock.DrvGpioWrite_CallInstance = CMock_Guts_MemNext(Mock.DrvGpioWrite_CallInstance);
+  if (Mock.DrvGpioWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvGpioWrite_FinalReturn;
+    Mock.DrvGpioWrite_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvGpioWrite_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvGpioWrite_CallbackFunctionPointer(fd, level, Mock.DrvGpioWrite_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvGpioWrite,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvGpioWrite,CMockString_level);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_level, level, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvGpioWrite(CMOCK_DrvGpioWrite_CALL_INSTANCE* cmock_call_instance, int fd, int level)
+{
+  cmock_call_instance->Expected_fd = fd;
+  cmock_call_instance->Expected_level = level;
+}
+
+void DrvGpioWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvGpioWrite_CALL_INSTANCE));
+  CMOCK_DrvGpioWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvGpioWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvGpioWrite_CallInstance = CMock_Guts_MemChain(Mock.DrvGpioWrite_CallInstance, cmock_guts_index);
+  Mock.DrvGpioWrite_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvGpioWrite_IgnoreBool = (int)1;
+}
+
+void DrvGpioWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, int level, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvGpioWrite_CALL_INSTANCE));
+  CMOCK_DrvGpioWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvGpioWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvGpioWrite_CallInstance = CMock_Guts_MemChain(Mock.DrvGpioWrite_CallInstance, cmock_guts_index);
+  Mock.DrvGpioWrite_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvGpioWrite(cmock_call_instance, fd, level);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvGpioWrite_StubWithCallback(CMOCK_DrvGpioWrite_CALLBACK Callback)
+{
+  Mock.DrvGpioWrite_CallbackFunctionPointer = Callback;
+}
+
+void DrvGpioClose(int fd)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvGpioClose_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvGpioClose);
+  cmock_call_instance = (CMOCK_DrvGpioClose_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvGpioClose_CallInstance);
+  Mock.DrvGpioClose_CallInstance = CMock_Guts_MemNext(Mock.DrvGpioClose_CallInstance);
+  if (Mock.DrvGpioClose_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.DrvGpioClose_CallbackFunctionPointer != NULL)
+  {
+    Mock.DrvGpioClose_CallbackFunctionPointer(fd, Mock.DrvGpioClose_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvGpioClose,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_DrvGpioClose(CMOCK_DrvGpioClose_CALL_INSTANCE* cmock_call_instance, int fd)
+{
+  cmock_call_instance->Expected_fd = fd;
+}
+
+void DrvGpioClose_CMockIgnore(void)
+{
+  Mock.DrvGpioClose_IgnoreBool = (int)1;
+}
+
+void DrvGpioClose_CMockExpect(UNITY_LINE_TYPE cmock_line, int fd)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvGpioClose_CALL_INSTANCE));
+  CMOCK_DrvGpioClose_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvGpioClose_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvGpioClose_CallInstance = CMock_Guts_MemChain(Mock.DrvGpioClose_CallInstance, cmock_guts_index);
+  Mock.DrvGpioClose_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvGpioClose(cmock_call_instance, fd);
+  UNITY_CLR_DETAILS();
+}
+
+void DrvGpioClose_StubWithCallback(CMOCK_DrvGpioClose_CALLBACK Callback)
+{
+  Mock.DrvGpioClose_CallbackFunctionPointer = Callback;
+}
+
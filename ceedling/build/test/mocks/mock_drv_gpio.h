@@ -0,0 +1,42 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_DRV_GPIO_H
+#define _MOCK_DRV_GPIO_H
+
+#include "drv_gpio.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_drv_gpio_Init(void);
+void mock_drv_gpio_Destroy(void);
+void mock_drv_gpio_Verify(void);
+
+
+
+
+#define DrvGpioOpen_IgnoreAndReturn(cmock_retval) DrvGpioOpen_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvGpioOpen_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvGpioOpen_ExpectAndReturn(gpio, cmock_retval) DrvGpioOpen_CMockExpectAndReturn(__LINE__, gpio, cmock_retval)
+void DrvGpioOpen_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int gpio, int cmock_to_return);
+typedef int (* CMOCK_DrvGpioOpen_CALLBACK)(int gpio, int cmock_num_calls);
+void DrvGpioOpen_StubWithCallback(CMOCK_DrvGpioOpen_CALLBACK Callback);
+#define DrvGpioWrite_IgnoreAndReturn(cmock_retval) DrvGpioWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvGpioWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvGpioWrite_ExpectAndReturn(fd, level, cmock_retval) DrvGpioWrite_CMockExpectAndReturn(__LINE__, fd, level, cmock_retval)
+void DrvGpioWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, int level, int cmock_to_return);
+typedef int (* CMOCK_DrvGpioWrite_CALLBACK)(int fd, int level, int cmock_num_calls);
+void DrvGpioWrite_StubWithCallback(CMOCK_DrvGpioWrite_CALLBACK Callback);
+#define DrvGpioClose_Ignore() DrvGpioClose_CMockIgnore()
+void DrvGpioClose_CMockIgnore(void);
+#define DrvGpioClose_Expect(fd) DrvGpioClose_CMockExpect(__LINE__, fd)
+void DrvGpioClose_CMockExpect(UNITY_LINE_TYPE cmock_line, int fd);
+typedef void (* CMOCK_DrvGpioClose_CALLBACK)(int fd, int cmock_num_calls);
+void DrvGpioClose_StubWithCallback(CMOCK_DrvGpioClose_CALLBACK Callback);
+
+#endif
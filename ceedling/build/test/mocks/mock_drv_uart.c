@@ -0,0 +1,1647 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_drv_uart.h"
+
+static const char* CMockString_DrvUartBitsPerByte = "DrvUartBitsPerByte";
+static const char* CMockString_DrvUartDrain = "DrvUartDrain";
+static const char* CMockString_DrvUartDrainPort = "DrvUartDrainPort";
+static const char* CMockString_DrvUartFlushInput = "DrvUartFlushInput";
+static const char* CMockString_DrvUartFlushPort = "DrvUartFlushPort";
+static const char* CMockString_DrvUartGetChars = "DrvUartGetChars";
+static const char* CMockString_DrvUartGetSpeed = "DrvUartGetSpeed";
+static const char* CMockString_DrvUartGetStats = "DrvUartGetStats";
+static const char* CMockString_DrvUartInit = "DrvUartInit";
+static const char* CMockString_DrvUartKill = "DrvUartKill";
+static const char* CMockString_DrvUartOpenPort = "DrvUartOpenPort";
+static const char* CMockString_DrvUartOutq = "DrvUartOutq";
+static const char* CMockString_DrvUartPutchars = "DrvUartPutchars";
+static const char* CMockString_DrvUartRead = "DrvUartRead";
+static const char* CMockString_DrvUartReadPort = "DrvUartReadPort";
+static const char* CMockString_DrvUartSetLowLatency = "DrvUartSetLowLatency";
+static const char* CMockString_DrvUartWritePort = "DrvUartWritePort";
+static const char* CMockString_databits = "databits";
+static const char* CMockString_dev_name = "dev_name";
+static const char* CMockString_fd = "fd";
+static const char* CMockString_n = "n";
+static const char* CMockString_on = "on";
+static const char* CMockString_parity = "parity";
+static const char* CMockString_ptr = "ptr";
+static const char* CMockString_speed = "speed";
+static const char* CMockString_stats = "stats";
+static const char* CMockString_stopbits = "stopbits";
+static const char* CMockString_timeout_us = "timeout_us";
+
+typedef struct _CMOCK_DrvUartInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  char* Expected_dev_name;
+  int Expected_speed;
+  int Expected_databits;
+  int Expected_stopbits;
+  int Expected_parity;
+
+} CMOCK_DrvUartInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartOpenPort_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  char* Expected_dev_name;
+  int Expected_speed;
+  int Expected_databits;
+  int Expected_stopbits;
+  int Expected_parity;
+
+} CMOCK_DrvUartOpenPort_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartWritePort_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_fd;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_DrvUartWritePort_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartDrainPort_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_fd;
+
+} CMOCK_DrvUartDrainPort_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartFlushPort_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_fd;
+
+} CMOCK_DrvUartFlushPort_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartReadPort_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_fd;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+  long Expected_timeout_us;
+
+} CMOCK_DrvUartReadPort_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartKill_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_DrvUartKill_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartPutchars_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_DrvUartPutchars_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartGetChars_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+
+} CMOCK_DrvUartGetChars_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+  long Expected_timeout_us;
+
+} CMOCK_DrvUartRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartFlushInput_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_DrvUartFlushInput_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartGetSpeed_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_DrvUartGetSpeed_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartBitsPerByte_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_DrvUartBitsPerByte_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartSetLowLatency_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_on;
+
+} CMOCK_DrvUartSetLowLatency_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartOutq_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_DrvUartOutq_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartDrain_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  long long ReturnVal;
+  int CallOrder;
+
+} CMOCK_DrvUartDrain_CALL_INSTANCE;
+
+typedef struct _CMOCK_DrvUartGetStats_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  drv_uart_stats_t* Expected_stats;
+
+} CMOCK_DrvUartGetStats_CALL_INSTANCE;
+
+static struct mock_drv_uartInstance
+{
+  int DrvUartInit_IgnoreBool;
+  int DrvUartInit_FinalReturn;
+  CMOCK_DrvUartInit_CALLBACK DrvUartInit_CallbackFunctionPointer;
+  int DrvUartInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartInit_CallInstance;
+  int DrvUartOpenPort_IgnoreBool;
+  int DrvUartOpenPort_FinalReturn;
+  CMOCK_DrvUartOpenPort_CALLBACK DrvUartOpenPort_CallbackFunctionPointer;
+  int DrvUartOpenPort_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartOpenPort_CallInstance;
+  int DrvUartWritePort_IgnoreBool;
+  int DrvUartWritePort_FinalReturn;
+  CMOCK_DrvUartWritePort_CALLBACK DrvUartWritePort_CallbackFunctionPointer;
+  int DrvUartWritePort_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartWritePort_CallInstance;
+  int DrvUartDrainPort_IgnoreBool;
+  int DrvUartDrainPort_FinalReturn;
+  CMOCK_DrvUartDrainPort_CALLBACK DrvUartDrainPort_CallbackFunctionPointer;
+  int DrvUartDrainPort_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartDrainPort_CallInstance;
+  int DrvUartFlushPort_IgnoreBool;
+  CMOCK_DrvUartFlushPort_CALLBACK DrvUartFlushPort_CallbackFunctionPointer;
+  int DrvUartFlushPort_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartFlushPort_CallInstance;
+  int DrvUartReadPort_IgnoreBool;
+  int DrvUartReadPort_FinalReturn;
+  CMOCK_DrvUartReadPort_CALLBACK DrvUartReadPort_CallbackFunctionPointer;
+  int DrvUartReadPort_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartReadPort_CallInstance;
+  int DrvUartKill_IgnoreBool;
+  int DrvUartKill_FinalReturn;
+  CMOCK_DrvUartKill_CALLBACK DrvUartKill_CallbackFunctionPointer;
+  int DrvUartKill_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartKill_CallInstance;
+  int DrvUartPutchars_IgnoreBool;
+  int DrvUartPutchars_FinalReturn;
+  CMOCK_DrvUartPutchars_CALLBACK DrvUartPutchars_CallbackFunctionPointer;
+  int DrvUartPutchars_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartPutchars_CallInstance;
+  int DrvUartGetChars_IgnoreBool;
+  int DrvUartGetChars_FinalReturn;
+  CMOCK_DrvUartGetChars_CALLBACK DrvUartGetChars_CallbackFunctionPointer;
+  int DrvUartGetChars_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartGetChars_CallInstance;
+  int DrvUartRead_IgnoreBool;
+  int DrvUartRead_FinalReturn;
+  CMOCK_DrvUartRead_CALLBACK DrvUartRead_CallbackFunctionPointer;
+  int DrvUartRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartRead_CallInstance;
+  int DrvUartFlushInput_IgnoreBool;
+  CMOCK_DrvUartFlushInput_CALLBACK DrvUartFlushInput_CallbackFunctionPointer;
+  int DrvUartFlushInput_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartFlushInput_CallInstance;
+  int DrvUartGetSpeed_IgnoreBool;
+  int DrvUartGetSpeed_FinalReturn;
+  CMOCK_DrvUartGetSpeed_CALLBACK DrvUartGetSpeed_CallbackFunctionPointer;
+  int DrvUartGetSpeed_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartGetSpeed_CallInstance;
+  int DrvUartBitsPerByte_IgnoreBool;
+  int DrvUartBitsPerByte_FinalReturn;
+  CMOCK_DrvUartBitsPerByte_CALLBACK DrvUartBitsPerByte_CallbackFunctionPointer;
+  int DrvUartBitsPerByte_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartBitsPerByte_CallInstance;
+  int DrvUartSetLowLatency_IgnoreBool;
+  int DrvUartSetLowLatency_FinalReturn;
+  CMOCK_DrvUartSetLowLatency_CALLBACK DrvUartSetLowLatency_CallbackFunctionPointer;
+  int DrvUartSetLowLatency_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartSetLowLatency_CallInstance;
+  int DrvUartOutq_IgnoreBool;
+  int DrvUartOutq_FinalReturn;
+  CMOCK_DrvUartOutq_CALLBACK DrvUartOutq_CallbackFunctionPointer;
+  int DrvUartOutq_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartOutq_CallInstance;
+  int DrvUartDrain_IgnoreBool;
+  long long DrvUartDrain_FinalReturn;
+  CMOCK_DrvUartDrain_CALLBACK DrvUartDrain_CallbackFunctionPointer;
+  int DrvUartDrain_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartDrain_CallInstance;
+  int DrvUartGetStats_IgnoreBool;
+  CMOCK_DrvUartGetStats_CALLBACK DrvUartGetStats_CallbackFunctionPointer;
+  int DrvUartGetStats_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DrvUartGetStats_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_drv_uart_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.DrvUartInit_IgnoreBool)
+    Mock.DrvUartInit_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartInit);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartInit_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartInit_CallbackFunctionPointer != NULL)
+    Mock.DrvUartInit_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartOpenPort_IgnoreBool)
+    Mock.DrvUartOpenPort_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartOpenPort);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartOpenPort_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartOpenPort_CallbackFunctionPointer != NULL)
+    Mock.DrvUartOpenPort_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartWritePort_IgnoreBool)
+    Mock.DrvUartWritePort_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartWritePort);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartWritePort_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartWritePort_CallbackFunctionPointer != NULL)
+    Mock.DrvUartWritePort_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartDrainPort_IgnoreBool)
+    Mock.DrvUartDrainPort_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartDrainPort);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartDrainPort_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartDrainPort_CallbackFunctionPointer != NULL)
+    Mock.DrvUartDrainPort_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartFlushPort_IgnoreBool)
+    Mock.DrvUartFlushPort_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartFlushPort);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartFlushPort_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartFlushPort_CallbackFunctionPointer != NULL)
+    Mock.DrvUartFlushPort_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartReadPort_IgnoreBool)
+    Mock.DrvUartReadPort_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartReadPort);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartReadPort_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartReadPort_CallbackFunctionPointer != NULL)
+    Mock.DrvUartReadPort_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartKill_IgnoreBool)
+    Mock.DrvUartKill_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartKill);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartKill_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartKill_CallbackFunctionPointer != NULL)
+    Mock.DrvUartKill_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartPutchars_IgnoreBool)
+    Mock.DrvUartPutchars_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartPutchars);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartPutchars_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartPutchars_CallbackFunctionPointer != NULL)
+    Mock.DrvUartPutchars_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartGetChars_IgnoreBool)
+    Mock.DrvUartGetChars_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetChars);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartGetChars_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartGetChars_CallbackFunctionPointer != NULL)
+    Mock.DrvUartGetChars_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartRead_IgnoreBool)
+    Mock.DrvUartRead_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartRead);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartRead_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartRead_CallbackFunctionPointer != NULL)
+    Mock.DrvUartRead_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartFlushInput_IgnoreBool)
+    Mock.DrvUartFlushInput_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartFlushInput);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartFlushInput_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartFlushInput_CallbackFunctionPointer != NULL)
+    Mock.DrvUartFlushInput_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartGetSpeed_IgnoreBool)
+    Mock.DrvUartGetSpeed_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetSpeed);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartGetSpeed_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartGetSpeed_CallbackFunctionPointer != NULL)
+    Mock.DrvUartGetSpeed_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartBitsPerByte_IgnoreBool)
+    Mock.DrvUartBitsPerByte_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartBitsPerByte);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartBitsPerByte_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartBitsPerByte_CallbackFunctionPointer != NULL)
+    Mock.DrvUartBitsPerByte_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartSetLowLatency_IgnoreBool)
+    Mock.DrvUartSetLowLatency_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartSetLowLatency);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartSetLowLatency_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartSetLowLatency_CallbackFunctionPointer != NULL)
+    Mock.DrvUartSetLowLatency_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartOutq_IgnoreBool)
+    Mock.DrvUartOutq_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartOutq);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartOutq_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartOutq_CallbackFunctionPointer != NULL)
+    Mock.DrvUartOutq_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartDrain_IgnoreBool)
+    Mock.DrvUartDrain_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartDrain);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartDrain_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartDrain_CallbackFunctionPointer != NULL)
+    Mock.DrvUartDrain_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.DrvUartGetStats_IgnoreBool)
+    Mock.DrvUartGetStats_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetStats);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.DrvUartGetStats_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.DrvUartGetStats_CallbackFunctionPointer != NULL)
+    Mock.DrvUartGetStats_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_drv_uart_Init(void)
+{
+  mock_drv_uart_Destroy();
+}
+
+void mock_drv_uart_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.DrvUartInit_CallbackFunctionPointer = NULL;
+  Mock.DrvUartInit_CallbackCalls = 0;
+  Mock.DrvUartOpenPort_CallbackFunctionPointer = NULL;
+  Mock.DrvUartOpenPort_CallbackCalls = 0;
+  Mock.DrvUartWritePort_CallbackFunctionPointer = NULL;
+  Mock.DrvUartWritePort_CallbackCalls = 0;
+  Mock.DrvUartDrainPort_CallbackFunctionPointer = NULL;
+  Mock.DrvUartDrainPort_CallbackCalls = 0;
+  Mock.DrvUartFlushPort_CallbackFunctionPointer = NULL;
+  Mock.DrvUartFlushPort_CallbackCalls = 0;
+  Mock.DrvUartReadPort_CallbackFunctionPointer = NULL;
+  Mock.DrvUartReadPort_CallbackCalls = 0;
+  Mock.DrvUartKill_CallbackFunctionPointer = NULL;
+  Mock.DrvUartKill_CallbackCalls = 0;
+  Mock.DrvUartPutchars_CallbackFunctionPointer = NULL;
+  Mock.DrvUartPutchars_CallbackCalls = 0;
+  Mock.DrvUartGetChars_CallbackFunctionPointer = NULL;
+  Mock.DrvUartGetChars_CallbackCalls = 0;
+  Mock.DrvUartRead_CallbackFunctionPointer = NULL;
+  Mock.DrvUartRead_CallbackCalls = 0;
+  Mock.DrvUartFlushInput_CallbackFunctionPointer = NULL;
+  Mock.DrvUartFlushInput_CallbackCalls = 0;
+  Mock.DrvUartGetSpeed_CallbackFunctionPointer = NULL;
+  Mock.DrvUartGetSpeed_CallbackCalls = 0;
+  Mock.DrvUartBitsPerByte_CallbackFunctionPointer = NULL;
+  Mock.DrvUartBitsPerByte_CallbackCalls = 0;
+  Mock.DrvUartSetLowLatency_CallbackFunctionPointer = NULL;
+  Mock.DrvUartSetLowLatency_CallbackCalls = 0;
+  Mock.DrvUartOutq_CallbackFunctionPointer = NULL;
+  Mock.DrvUartOutq_CallbackCalls = 0;
+  Mock.DrvUartDrain_CallbackFunctionPointer = NULL;
+  Mock.DrvUartDrain_CallbackCalls = 0;
+  Mock.DrvUartGetStats_CallbackFunctionPointer = NULL;
+  Mock.DrvUartGetStats_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+int DrvUartInit(char* dev_name, int speed, int databits, int stopbits, int parity)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartInit);
+  cmock_call_instance = (CMOCK_DrvUartInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartInit_CallInstance);
+  Mock.DrvUartInit_CallInstance = CMock_Guts_MemNext(Mock.DrvUartInit_CallInstance);
+  if (Mock.DrvUartInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartInit_FinalReturn;
+    Mock.DrvUartInit_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartInit_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartInit_CallbackFunctionPointer(dev_name, speed, databits, stopbits, parity, Mock.DrvUartInit_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartInit,CMockString_dev_name);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_dev_name, dev_name, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartInit,CMockString_speed);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_speed, speed, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartInit,CMockString_databits);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_databits, databits, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartInit,CMockString_stopbits);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_stopbits, stopbits, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartInit,CMockString_parity);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_parity, parity, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartInit(CMOCK_DrvUartInit_CALL_INSTANCE* cmock_call_instance, char* dev_name, int speed, int databits, int stopbits, int parity)
+{
+  cmock_call_instance->Expected_dev_name = dev_name;
+  cmock_call_instance->Expected_speed = speed;
+  cmock_call_instance->Expected_databits = databits;
+  cmock_call_instance->Expected_stopbits = stopbits;
+  cmock_call_instance->Expected_parity = parity;
+}
+
+void DrvUartInit_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartInit_CALL_INSTANCE));
+  CMOCK_DrvUartInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartInit_CallInstance = CMock_Guts_MemChain(Mock.DrvUartInit_CallInstance, cmock_guts_index);
+  Mock.DrvUartInit_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartInit_IgnoreBool = (int)1;
+}
+
+void DrvUartInit_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartInit_CALL_INSTANCE));
+  CMOCK_DrvUartInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartInit_CallInstance = CMock_Guts_MemChain(Mock.DrvUartInit_CallInstance, cmock_guts_index);
+  Mock.DrvUartInit_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartInit(cmock_call_instance, dev_name, speed, databits, stopbits, parity);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartInit_StubWithCallback(CMOCK_DrvUartInit_CALLBACK Callback)
+{
+  Mock.DrvUartInit_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartOpenPort(char* dev_name, int speed, int databits, int stopbits, int parity)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartOpenPort_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartOpenPort);
+  cmock_call_instance = (CMOCK_DrvUartOpenPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartOpenPort_CallInstance);
+  Mock.DrvUartOpenPort_CallInstance = CMock_Guts_MemNext(Mock.DrvUartOpenPort_CallInstance);
+  if (Mock.DrvUartOpenPort_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartOpenPort_FinalReturn;
+    Mock.DrvUartOpenPort_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartOpenPort_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartOpenPort_CallbackFunctionPointer(dev_name, speed, databits, stopbits, parity, Mock.DrvUartOpenPort_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartOpenPort,CMockString_dev_name);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_dev_name, dev_name, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartOpenPort,CMockString_speed);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_speed, speed, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartOpenPort,CMockString_databits);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_databits, databits, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartOpenPort,CMockString_stopbits);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_stopbits, stopbits, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartOpenPort,CMockString_parity);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_parity, parity, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartOpenPort(CMOCK_DrvUartOpenPort_CALL_INSTANCE* cmock_call_instance, char* dev_name, int speed, int databits, int stopbits, int parity)
+{
+  cmock_call_instance->Expected_dev_name = dev_name;
+  cmock_call_instance->Expected_speed = speed;
+  cmock_call_instance->Expected_databits = databits;
+  cmock_call_instance->Expected_stopbits = stopbits;
+  cmock_call_instance->Expected_parity = parity;
+}
+
+void DrvUartOpenPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartOpenPort_CALL_INSTANCE));
+  CMOCK_DrvUartOpenPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartOpenPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartOpenPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartOpenPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartOpenPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartOpenPort_IgnoreBool = (int)1;
+}
+
+void DrvUartOpenPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartOpenPort_CALL_INSTANCE));
+  CMOCK_DrvUartOpenPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartOpenPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartOpenPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartOpenPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartOpenPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartOpenPort(cmock_call_instance, dev_name, speed, databits, stopbits, parity);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartOpenPort_StubWithCallback(CMOCK_DrvUartOpenPort_CALLBACK Callback)
+{
+  Mock.DrvUartOpenPort_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartWritePort(int fd, const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartWritePort_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartWritePort);
+  cmock_call_instance = (CMOCK_DrvUartWritePort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartWritePort_CallInstance);
+  Mock.DrvUartWritePort_CallInstance = CMock_Guts_MemNext(Mock.DrvUartWritePort_CallInstance);
+  if (Mock.DrvUartWritePort_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartWritePort_FinalReturn;
+    Mock.DrvUartWritePort_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartWritePort_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartWritePort_CallbackFunctionPointer(fd, ptr, n, Mock.DrvUartWritePort_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartWritePort,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartWritePort,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartWritePort,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartWritePort(CMOCK_DrvUartWritePort_CALL_INSTANCE* cmock_call_instance, int fd, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_fd = fd;
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void DrvUartWritePort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartWritePort_CALL_INSTANCE));
+  CMOCK_DrvUartWritePort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartWritePort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartWritePort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartWritePort_CallInstance, cmock_guts_index);
+  Mock.DrvUartWritePort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartWritePort_IgnoreBool = (int)1;
+}
+
+void DrvUartWritePort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartWritePort_CALL_INSTANCE));
+  CMOCK_DrvUartWritePort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartWritePort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartWritePort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartWritePort_CallInstance, cmock_guts_index);
+  Mock.DrvUartWritePort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartWritePort(cmock_call_instance, fd, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartWritePort_StubWithCallback(CMOCK_DrvUartWritePort_CALLBACK Callback)
+{
+  Mock.DrvUartWritePort_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartDrainPort(int fd)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartDrainPort_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartDrainPort);
+  cmock_call_instance = (CMOCK_DrvUartDrainPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartDrainPort_CallInstance);
+  Mock.DrvUartDrainPort_CallInstance = CMock_Guts_MemNext(Mock.DrvUartDrainPort_CallInstance);
+  if (Mock.DrvUartDrainPort_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartDrainPort_FinalReturn;
+    Mock.DrvUartDrainPort_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartDrainPort_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartDrainPort_CallbackFunctionPointer(fd, Mock.DrvUartDrainPort_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartDrainPort,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartDrainPort(CMOCK_DrvUartDrainPort_CALL_INSTANCE* cmock_call_instance, int fd)
+{
+  cmock_call_instance->Expected_fd = fd;
+}
+
+void DrvUartDrainPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartDrainPort_CALL_INSTANCE));
+  CMOCK_DrvUartDrainPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartDrainPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartDrainPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartDrainPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartDrainPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartDrainPort_IgnoreBool = (int)1;
+}
+
+void DrvUartDrainPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartDrainPort_CALL_INSTANCE));
+  CMOCK_DrvUartDrainPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartDrainPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartDrainPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartDrainPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartDrainPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartDrainPort(cmock_call_instance, fd);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartDrainPort_StubWithCallback(CMOCK_DrvUartDrainPort_CALLBACK Callback)
+{
+  Mock.DrvUartDrainPort_CallbackFunctionPointer = Callback;
+}
+
+void DrvUartFlushPort(int fd)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartFlushPort_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartFlushPort);
+  cmock_call_instance = (CMOCK_DrvUartFlushPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartFlushPort_CallInstance);
+  Mock.DrvUartFlushPort_CallInstance = CMock_Guts_MemNext(Mock.DrvUartFlushPort_CallInstance);
+  if (Mock.DrvUartFlushPort_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.DrvUartFlushPort_CallbackFunctionPointer != NULL)
+  {
+    Mock.DrvUartFlushPort_CallbackFunctionPointer(fd, Mock.DrvUartFlushPort_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartFlushPort,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_DrvUartFlushPort(CMOCK_DrvUartFlushPort_CALL_INSTANCE* cmock_call_instance, int fd)
+{
+  cmock_call_instance->Expected_fd = fd;
+}
+
+void DrvUartFlushPort_CMockIgnore(void)
+{
+  Mock.DrvUartFlushPort_IgnoreBool = (int)1;
+}
+
+void DrvUartFlushPort_CMockExpect(UNITY_LINE_TYPE cmock_line, int fd)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartFlushPort_CALL_INSTANCE));
+  CMOCK_DrvUartFlushPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartFlushPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartFlushPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartFlushPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartFlushPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartFlushPort(cmock_call_instance, fd);
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartFlushPort_StubWithCallback(CMOCK_DrvUartFlushPort_CALLBACK Callback)
+{
+  Mock.DrvUartFlushPort_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartReadPort(int fd, unsigned char* ptr, int n, long timeout_us)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartReadPort_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartReadPort);
+  cmock_call_instance = (CMOCK_DrvUartReadPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartReadPort_CallInstance);
+  Mock.DrvUartReadPort_CallInstance = CMock_Guts_MemNext(Mock.DrvUartReadPort_CallInstance);
+  if (Mock.DrvUartReadPort_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartReadPort_FinalReturn;
+    Mock.DrvUartReadPort_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartReadPort_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartReadPort_CallbackFunctionPointer(fd, ptr, n, timeout_us, Mock.DrvUartReadPort_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartReadPort,CMockString_fd);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_fd, fd, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartReadPort,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartReadPort,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartReadPort,CMockString_timeout_us);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_timeout_us, timeout_us, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartReadPort(CMOCK_DrvUartReadPort_CALL_INSTANCE* cmock_call_instance, int fd, unsigned char* ptr, int n, long timeout_us)
+{
+  cmock_call_instance->Expected_fd = fd;
+  cmock_call_instance->Expected_ptr = ptr;
+  cmock_call_instance->Expected_n = n;
+  cmock_call_instance->Expected_timeout_us = timeout_us;
+}
+
+void DrvUartReadPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartReadPort_CALL_INSTANCE));
+  CMOCK_DrvUartReadPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartReadPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartReadPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartReadPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartReadPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartReadPort_IgnoreBool = (int)1;
+}
+
+void DrvUartReadPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, unsigned char* ptr, int n, long timeout_us, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartReadPort_CALL_INSTANCE));
+  CMOCK_DrvUartReadPort_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartReadPort_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartReadPort_CallInstance = CMock_Guts_MemChain(Mock.DrvUartReadPort_CallInstance, cmock_guts_index);
+  Mock.DrvUartReadPort_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartReadPort(cmock_call_instance, fd, ptr, n, timeout_us);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartReadPort_StubWithCallback(CMOCK_DrvUartReadPort_CALLBACK Callback)
+{
+  Mock.DrvUartReadPort_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartKill(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartKill_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartKill);
+  cmock_call_instance = (CMOCK_DrvUartKill_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartKill_CallInstance);
+  Mock.DrvUartKill_CallInstance = CMock_Guts_MemNext(Mock.DrvUartKill_CallInstance);
+  if (Mock.DrvUartKill_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartKill_FinalReturn;
+    Mock.DrvUartKill_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartKill_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartKill_CallbackFunctionPointer(Mock.DrvUartKill_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DrvUartKill_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartKill_CALL_INSTANCE));
+  CMOCK_DrvUartKill_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartKill_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartKill_CallInstance = CMock_Guts_MemChain(Mock.DrvUartKill_CallInstance, cmock_guts_index);
+  Mock.DrvUartKill_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartKill_IgnoreBool = (int)1;
+}
+
+void DrvUartKill_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartKill_CALL_INSTANCE));
+  CMOCK_DrvUartKill_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartKill_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartKill_CallInstance = CMock_Guts_MemChain(Mock.DrvUartKill_CallInstance, cmock_guts_index);
+  Mock.DrvUartKill_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartKill_StubWithCallback(CMOCK_DrvUartKill_CALLBACK Callback)
+{
+  Mock.DrvUartKill_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartPutchars(const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartPutchars_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartPutchars);
+  cmock_call_instance = (CMOCK_DrvUartPutchars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartPutchars_CallInstance);
+  Mock.DrvUartPutchars_CallInstance = CMock_Guts_MemNext(Mock.DrvUartPutchars_CallInstance);
+  if (Mock.DrvUartPutchars_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartPutchars_FinalReturn;
+    Mock.DrvUartPutchars_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartPutchars_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartPutchars_CallbackFunctionPointer(ptr, n, Mock.DrvUartPutchars_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartPutchars,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartPutchars,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartPutchars(CMOCK_DrvUartPutchars_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void DrvUartPutchars_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartPutchars_CALL_INSTANCE));
+  CMOCK_DrvUartPutchars_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartPutchars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartPutchars_CallInstance = CMock_Guts_MemChain(Mock.DrvUartPutchars_CallInstance, cmock_guts_index);
+  Mock.DrvUartPutchars_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartPutchars_IgnoreBool = (int)1;
+}
+
+void DrvUartPutchars_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartPutchars_CALL_INSTANCE));
+  CMOCK_DrvUartPutchars_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartPutchars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartPutchars_CallInstance = CMock_Guts_MemChain(Mock.DrvUartPutchars_CallInstance, cmock_guts_index);
+  Mock.DrvUartPutchars_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartPutchars(cmock_call_instance, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartPutchars_StubWithCallback(CMOCK_DrvUartPutchars_CALLBACK Callback)
+{
+  Mock.DrvUartPutchars_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartGetChars(unsigned char* ptr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartGetChars_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetChars);
+  cmock_call_instance = (CMOCK_DrvUartGetChars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartGetChars_CallInstance);
+  Mock.DrvUartGetChars_CallInstance = CMock_Guts_MemNext(Mock.DrvUartGetChars_CallInstance);
+  if (Mock.DrvUartGetChars_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartGetChars_FinalReturn;
+    Mock.DrvUartGetChars_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartGetChars_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartGetChars_CallbackFunctionPointer(ptr, Mock.DrvUartGetChars_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartGetChars,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartGetChars(CMOCK_DrvUartGetChars_CALL_INSTANCE* cmock_call_instance, unsigned char* ptr)
+{
+  cmock_call_instance->Expected_ptr = ptr;
+}
+
+void DrvUartGetChars_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartGetChars_CALL_INSTANCE));
+  CMOCK_DrvUartGetChars_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartGetChars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartGetChars_CallInstance = CMock_Guts_MemChain(Mock.DrvUartGetChars_CallInstance, cmock_guts_index);
+  Mock.DrvUartGetChars_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartGetChars_IgnoreBool = (int)1;
+}
+
+void DrvUartGetChars_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned char* ptr, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartGetChars_CALL_INSTANCE));
+  CMOCK_DrvUartGetChars_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartGetChars_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartGetChars_CallInstance = CMock_Guts_MemChain(Mock.DrvUartGetChars_CallInstance, cmock_guts_index);
+  Mock.DrvUartGetChars_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartGetChars(cmock_call_instance, ptr);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartGetChars_StubWithCallback(CMOCK_DrvUartGetChars_CALLBACK Callback)
+{
+  Mock.DrvUartGetChars_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartRead(unsigned char* ptr, int n, long timeout_us)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartRead);
+  cmock_call_instance = (CMOCK_DrvUartRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartRead_CallInstance);
+  Mock.DrvUartRead_CallInstance = CMock_Guts_MemNext(Mock.DrvUartRead_CallInstance);
+  if (Mock.DrvUartRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartRead_FinalReturn;
+    Mock.DrvUartRead_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartRead_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartRead_CallbackFunctionPointer(ptr, n, timeout_us, Mock.DrvUartRead_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartRead,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartRead,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartRead,CMockString_timeout_us);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_timeout_us, timeout_us, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartRead(CMOCK_DrvUartRead_CALL_INSTANCE* cmock_call_instance, unsigned char* ptr, int n, long timeout_us)
+{
+  cmock_call_instance->Expected_ptr = ptr;
+  cmock_call_instance->Expected_n = n;
+  cmock_call_instance->Expected_timeout_us = timeout_us;
+}
+
+void DrvUartRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartRead_CALL_INSTANCE));
+  CMOCK_DrvUartRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartRead_CallInstance = CMock_Guts_MemChain(Mock.DrvUartRead_CallInstance, cmock_guts_index);
+  Mock.DrvUartRead_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartRead_IgnoreBool = (int)1;
+}
+
+void DrvUartRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned char* ptr, int n, long timeout_us, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartRead_CALL_INSTANCE));
+  CMOCK_DrvUartRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartRead_CallInstance = CMock_Guts_MemChain(Mock.DrvUartRead_CallInstance, cmock_guts_index);
+  Mock.DrvUartRead_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartRead(cmock_call_instance, ptr, n, timeout_us);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartRead_StubWithCallback(CMOCK_DrvUartRead_CALLBACK Callback)
+{
+  Mock.DrvUartRead_CallbackFunctionPointer = Callback;
+}
+
+void DrvUartFlushInput(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartFlushInput_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartFlushInput);
+  cmock_call_instance = (CMOCK_DrvUartFlushInput_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartFlushInput_CallInstance);
+  Mock.DrvUartFlushInput_CallInstance = CMock_Guts_MemNext(Mock.DrvUartFlushInput_CallInstance);
+  if (Mock.DrvUartFlushInput_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.DrvUartFlushInput_CallbackFunctionPointer != NULL)
+  {
+    Mock.DrvUartFlushInput_CallbackFunctionPointer(Mock.DrvUartFlushInput_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartFlushInput_CMockIgnore(void)
+{
+  Mock.DrvUartFlushInput_IgnoreBool = (int)1;
+}
+
+void DrvUartFlushInput_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartFlushInput_CALL_INSTANCE));
+  CMOCK_DrvUartFlushInput_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartFlushInput_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartFlushInput_CallInstance = CMock_Guts_MemChain(Mock.DrvUartFlushInput_CallInstance, cmock_guts_index);
+  Mock.DrvUartFlushInput_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartFlushInput_StubWithCallback(CMOCK_DrvUartFlushInput_CALLBACK Callback)
+{
+  Mock.DrvUartFlushInput_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartGetSpeed(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartGetSpeed_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetSpeed);
+  cmock_call_instance = (CMOCK_DrvUartGetSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartGetSpeed_CallInstance);
+  Mock.DrvUartGetSpeed_CallInstance = CMock_Guts_MemNext(Mock.DrvUartGetSpeed_CallInstance);
+  if (Mock.DrvUartGetSpeed_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartGetSpeed_FinalReturn;
+    Mock.DrvUartGetSpeed_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartGetSpeed_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartGetSpeed_CallbackFunctionPointer(Mock.DrvUartGetSpeed_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DrvUartGetSpeed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartGetSpeed_CALL_INSTANCE));
+  CMOCK_DrvUartGetSpeed_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartGetSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartGetSpeed_CallInstance = CMock_Guts_MemChain(Mock.DrvUartGetSpeed_CallInstance, cmock_guts_index);
+  Mock.DrvUartGetSpeed_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartGetSpeed_IgnoreBool = (int)1;
+}
+
+void DrvUartGetSpeed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartGetSpeed_CALL_INSTANCE));
+  CMOCK_DrvUartGetSpeed_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartGetSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartGetSpeed_CallInstance = CMock_Guts_MemChain(Mock.DrvUartGetSpeed_CallInstance, cmock_guts_index);
+  Mock.DrvUartGetSpeed_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartGetSpeed_StubWithCallback(CMOCK_DrvUartGetSpeed_CALLBACK Callback)
+{
+  Mock.DrvUartGetSpeed_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartBitsPerByte(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartBitsPerByte_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartBitsPerByte);
+  cmock_call_instance = (CMOCK_DrvUartBitsPerByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartBitsPerByte_CallInstance);
+  Mock.DrvUartBitsPerByte_CallInstance = CMock_Guts_MemNext(Mock.DrvUartBitsPerByte_CallInstance);
+  if (Mock.DrvUartBitsPerByte_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartBitsPerByte_FinalReturn;
+    Mock.DrvUartBitsPerByte_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartBitsPerByte_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartBitsPerByte_CallbackFunctionPointer(Mock.DrvUartBitsPerByte_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DrvUartBitsPerByte_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartBitsPerByte_CALL_INSTANCE));
+  CMOCK_DrvUartBitsPerByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartBitsPerByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartBitsPerByte_CallInstance = CMock_Guts_MemChain(Mock.DrvUartBitsPerByte_CallInstance, cmock_guts_index);
+  Mock.DrvUartBitsPerByte_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartBitsPerByte_IgnoreBool = (int)1;
+}
+
+void DrvUartBitsPerByte_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartBitsPerByte_CALL_INSTANCE));
+  CMOCK_DrvUartBitsPerByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartBitsPerByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartBitsPerByte_CallInstance = CMock_Guts_MemChain(Mock.DrvUartBitsPerByte_CallInstance, cmock_guts_index);
+  Mock.DrvUartBitsPerByte_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartBitsPerByte_StubWithCallback(CMOCK_DrvUartBitsPerByte_CALLBACK Callback)
+{
+  Mock.DrvUartBitsPerByte_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartSetLowLatency(int on)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartSetLowLatency_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartSetLowLatency);
+  cmock_call_instance = (CMOCK_DrvUartSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartSetLowLatency_CallInstance);
+  Mock.DrvUartSetLowLatency_CallInstance = CMock_Guts_MemNext(Mock.DrvUartSetLowLatency_CallInstance);
+  if (Mock.DrvUartSetLowLatency_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartSetLowLatency_FinalReturn;
+    Mock.DrvUartSetLowLatency_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartSetLowLatency_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartSetLowLatency_CallbackFunctionPointer(on, Mock.DrvUartSetLowLatency_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartSetLowLatency,CMockString_on);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_on, on, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DrvUartSetLowLatency(CMOCK_DrvUartSetLowLatency_CALL_INSTANCE* cmock_call_instance, int on)
+{
+  cmock_call_instance->Expected_on = on;
+}
+
+void DrvUartSetLowLatency_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartSetLowLatency_CALL_INSTANCE));
+  CMOCK_DrvUartSetLowLatency_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartSetLowLatency_CallInstance = CMock_Guts_MemChain(Mock.DrvUartSetLowLatency_CallInstance, cmock_guts_index);
+  Mock.DrvUartSetLowLatency_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartSetLowLatency_IgnoreBool = (int)1;
+}
+
+void DrvUartSetLowLatency_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int on, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartSetLowLatency_CALL_INSTANCE));
+  CMOCK_DrvUartSetLowLatency_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartSetLowLatency_CallInstance = CMock_Guts_MemChain(Mock.DrvUartSetLowLatency_CallInstance, cmock_guts_index);
+  Mock.DrvUartSetLowLatency_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartSetLowLatency(cmock_call_instance, on);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartSetLowLatency_StubWithCallback(CMOCK_DrvUartSetLowLatency_CALLBACK Callback)
+{
+  Mock.DrvUartSetLowLatency_CallbackFunctionPointer = Callback;
+}
+
+int DrvUartOutq(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartOutq_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartOutq);
+  cmock_call_instance = (CMOCK_DrvUartOutq_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartOutq_CallInstance);
+  Mock.DrvUartOutq_CallInstance = CMock_Guts_MemNext(Mock.DrvUartOutq_CallInstance);
+  if (Mock.DrvUartOutq_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartOutq_FinalReturn;
+    Mock.DrvUartOutq_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartOutq_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartOutq_CallbackFunctionPointer(Mock.DrvUartOutq_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DrvUartOutq_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartOutq_CALL_INSTANCE));
+  CMOCK_DrvUartOutq_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartOutq_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartOutq_CallInstance = CMock_Guts_MemChain(Mock.DrvUartOutq_CallInstance, cmock_guts_index);
+  Mock.DrvUartOutq_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartOutq_IgnoreBool = (int)1;
+}
+
+void DrvUartOutq_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartOutq_CALL_INSTANCE));
+  CMOCK_DrvUartOutq_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartOutq_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartOutq_CallInstance = CMock_Guts_MemChain(Mock.DrvUartOutq_CallInstance, cmock_guts_index);
+  Mock.DrvUartOutq_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartOutq_StubWithCallback(CMOCK_DrvUartOutq_CALLBACK Callback)
+{
+  Mock.DrvUartOutq_CallbackFunctionPointer = Callback;
+}
+
+long long DrvUartDrain(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartDrain_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartDrain);
+  cmock_call_instance = (CMOCK_DrvUartDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartDrain_CallInstance);
+  Mock.DrvUartDrain_CallInstance = CMock_Guts_MemNext(Mock.DrvUartDrain_CallInstance);
+  if (Mock.DrvUartDrain_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DrvUartDrain_FinalReturn;
+    memcpy(&Mock.DrvUartDrain_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(long long));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.DrvUartDrain_CallbackFunctionPointer != NULL)
+  {
+    return Mock.DrvUartDrain_CallbackFunctionPointer(Mock.DrvUartDrain_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DrvUartDrain_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartDrain_CALL_INSTANCE));
+  CMOCK_DrvUartDrain_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartDrain_CallInstance = CMock_Guts_MemChain(Mock.DrvUartDrain_CallInstance, cmock_guts_index);
+  Mock.DrvUartDrain_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DrvUartDrain_IgnoreBool = (int)1;
+}
+
+void DrvUartDrain_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartDrain_CALL_INSTANCE));
+  CMOCK_DrvUartDrain_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartDrain_CallInstance = CMock_Guts_MemChain(Mock.DrvUartDrain_CallInstance, cmock_guts_index);
+  Mock.DrvUartDrain_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(long long));
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartDrain_StubWithCallback(CMOCK_DrvUartDrain_CALLBACK Callback)
+{
+  Mock.DrvUartDrain_CallbackFunctionPointer = Callback;
+}
+
+void DrvUartGetStats(drv_uart_stats_t* stats)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DrvUartGetStats_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DrvUartGetStats);
+  cmock_call_instance = (CMOCK_DrvUartGetStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DrvUartGetStats_CallInstance);
+  Mock.DrvUartGetStats_CallInstance = CMock_Guts_MemNext(Mock.DrvUartGetStats_CallInstance);
+  if (Mock.DrvUartGetStats_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.DrvUartGetStats_CallbackFunctionPointer != NULL)
+  {
+    Mock.DrvUartGetStats_CallbackFunctionPointer(stats, Mock.DrvUartGetStats_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_DrvUartGetStats,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(drv_uart_stats_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_DrvUartGetStats(CMOCK_DrvUartGetStats_CALL_INSTANCE* cmock_call_instance, drv_uart_stats_t* stats)
+{
+  cmock_call_instance->Expected_stats = stats;
+}
+
+void DrvUartGetStats_CMockIgnore(void)
+{
+  Mock.DrvUartGetStats_IgnoreBool = (int)1;
+}
+
+void DrvUartGetStats_CMockExpect(UNITY_LINE_TYPE cmock_line, drv_uart_stats_t* stats)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DrvUartGetStats_CALL_INSTANCE));
+  CMOCK_DrvUartGetStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_DrvUartGetStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DrvUartGetStats_CallInstance = CMock_Guts_MemChain(Mock.DrvUartGetStats_CallInstance, cmock_guts_index);
+  Mock.DrvUartGetStats_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_DrvUartGetStats(cmock_call_instance, stats);
+  UNITY_CLR_DETAILS();
+}
+
+void DrvUartGetStats_StubWithCallback(CMOCK_DrvUartGetStats_CALLBACK Callback)
+{
+  Mock.DrvUartGetStats_CallbackFunctionPointer = Callback;
+}
+
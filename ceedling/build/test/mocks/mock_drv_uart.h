@@ -0,0 +1,126 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_DRV_UART_H
+#define _MOCK_DRV_UART_H
+
+#include "drv_uart.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_drv_uart_Init(void);
+void mock_drv_uart_Destroy(void);
+void mock_drv_uart_Verify(void);
+
+
+
+
+#define DrvUartInit_IgnoreAndReturn(cmock_retval) DrvUartInit_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartInit_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartInit_ExpectAndReturn(dev_name, speed, databits, stopbits, parity, cmock_retval) DrvUartInit_CMockExpectAndReturn(__LINE__, dev_name, speed, databits, stopbits, parity, cmock_retval)
+void DrvUartInit_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_to_return);
+typedef int (* CMOCK_DrvUartInit_CALLBACK)(char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_num_calls);
+void DrvUartInit_StubWithCallback(CMOCK_DrvUartInit_CALLBACK Callback);
+#define DrvUartOpenPort_IgnoreAndReturn(cmock_retval) DrvUartOpenPort_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartOpenPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartOpenPort_ExpectAndReturn(dev_name, speed, databits, stopbits, parity, cmock_retval) DrvUartOpenPort_CMockExpectAndReturn(__LINE__, dev_name, speed, databits, stopbits, parity, cmock_retval)
+void DrvUartOpenPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_to_return);
+typedef int (* CMOCK_DrvUartOpenPort_CALLBACK)(char* dev_name, int speed, int databits, int stopbits, int parity, int cmock_num_calls);
+void DrvUartOpenPort_StubWithCallback(CMOCK_DrvUartOpenPort_CALLBACK Callback);
+#define DrvUartWritePort_IgnoreAndReturn(cmock_retval) DrvUartWritePort_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartWritePort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartWritePort_ExpectAndReturn(fd, ptr, n, cmock_retval) DrvUartWritePort_CMockExpectAndReturn(__LINE__, fd, ptr, n, cmock_retval)
+void DrvUartWritePort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_DrvUartWritePort_CALLBACK)(int fd, const unsigned char* ptr, int n, int cmock_num_calls);
+void DrvUartWritePort_StubWithCallback(CMOCK_DrvUartWritePort_CALLBACK Callback);
+#define DrvUartDrainPort_IgnoreAndReturn(cmock_retval) DrvUartDrainPort_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartDrainPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartDrainPort_ExpectAndReturn(fd, cmock_retval) DrvUartDrainPort_CMockExpectAndReturn(__LINE__, fd, cmock_retval)
+void DrvUartDrainPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, int cmock_to_return);
+typedef int (* CMOCK_DrvUartDrainPort_CALLBACK)(int fd, int cmock_num_calls);
+void DrvUartDrainPort_StubWithCallback(CMOCK_DrvUartDrainPort_CALLBACK Callback);
+#define DrvUartFlushPort_Ignore() DrvUartFlushPort_CMockIgnore()
+void DrvUartFlushPort_CMockIgnore(void);
+#define DrvUartFlushPort_Expect(fd) DrvUartFlushPort_CMockExpect(__LINE__, fd)
+void DrvUartFlushPort_CMockExpect(UNITY_LINE_TYPE cmock_line, int fd);
+typedef void (* CMOCK_DrvUartFlushPort_CALLBACK)(int fd, int cmock_num_calls);
+void DrvUartFlushPort_StubWithCallback(CMOCK_DrvUartFlushPort_CALLBACK Callback);
+#define DrvUartReadPort_IgnoreAndReturn(cmock_retval) DrvUartReadPort_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartReadPort_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartReadPort_ExpectAndReturn(fd, ptr, n, timeout_us, cmock_retval) DrvUartReadPort_CMockExpectAndReturn(__LINE__, fd, ptr, n, timeout_us, cmock_retval)
+void DrvUartReadPort_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int fd, unsigned char* ptr, int n, long timeout_us, int cmock_to_return);
+typedef int (* CMOCK_DrvUartReadPort_CALLBACK)(int fd, unsigned char* ptr, int n, long timeout_us, int cmock_num_calls);
+void DrvUartReadPort_StubWithCallback(CMOCK_DrvUartReadPort_CALLBACK Callback);
+#define DrvUartKill_IgnoreAndReturn(cmock_retval) DrvUartKill_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartKill_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartKill_ExpectAndReturn(cmock_retval) DrvUartKill_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DrvUartKill_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_DrvUartKill_CALLBACK)(int cmock_num_calls);
+void DrvUartKill_StubWithCallback(CMOCK_DrvUartKill_CALLBACK Callback);
+#define DrvUartPutchars_IgnoreAndReturn(cmock_retval) DrvUartPutchars_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartPutchars_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartPutchars_ExpectAndReturn(ptr, n, cmock_retval) DrvUartPutchars_CMockExpectAndReturn(__LINE__, ptr, n, cmock_retval)
+void DrvUartPutchars_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_DrvUartPutchars_CALLBACK)(const unsigned char* ptr, int n, int cmock_num_calls);
+void DrvUartPutchars_StubWithCallback(CMOCK_DrvUartPutchars_CALLBACK Callback);
+#define DrvUartGetChars_IgnoreAndReturn(cmock_retval) DrvUartGetChars_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartGetChars_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartGetChars_ExpectAndReturn(ptr, cmock_retval) DrvUartGetChars_CMockExpectAndReturn(__LINE__, ptr, cmock_retval)
+void DrvUartGetChars_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned char* ptr, int cmock_to_return);
+typedef int (* CMOCK_DrvUartGetChars_CALLBACK)(unsigned char* ptr, int cmock_num_calls);
+void DrvUartGetChars_StubWithCallback(CMOCK_DrvUartGetChars_CALLBACK Callback);
+#define DrvUartRead_IgnoreAndReturn(cmock_retval) DrvUartRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartRead_ExpectAndReturn(ptr, n, timeout_us, cmock_retval) DrvUartRead_CMockExpectAndReturn(__LINE__, ptr, n, timeout_us, cmock_retval)
+void DrvUartRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned char* ptr, int n, long timeout_us, int cmock_to_return);
+typedef int (* CMOCK_DrvUartRead_CALLBACK)(unsigned char* ptr, int n, long timeout_us, int cmock_num_calls);
+void DrvUartRead_StubWithCallback(CMOCK_DrvUartRead_CALLBACK Callback);
+#define DrvUartFlushInput_Ignore() DrvUartFlushInput_CMockIgnore()
+void DrvUartFlushInput_CMockIgnore(void);
+#define DrvUartFlushInput_Expect() DrvUartFlushInput_CMockExpect(__LINE__)
+void DrvUartFlushInput_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DrvUartFlushInput_CALLBACK)(int cmock_num_calls);
+void DrvUartFlushInput_StubWithCallback(CMOCK_DrvUartFlushInput_CALLBACK Callback);
+#define DrvUartGetSpeed_IgnoreAndReturn(cmock_retval) DrvUartGetSpeed_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartGetSpeed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartGetSpeed_ExpectAndReturn(cmock_retval) DrvUartGetSpeed_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DrvUartGetSpeed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_DrvUartGetSpeed_CALLBACK)(int cmock_num_calls);
+void DrvUartGetSpeed_StubWithCallback(CMOCK_DrvUartGetSpeed_CALLBACK Callback);
+#define DrvUartBitsPerByte_IgnoreAndReturn(cmock_retval) DrvUartBitsPerByte_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartBitsPerByte_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartBitsPerByte_ExpectAndReturn(cmock_retval) DrvUartBitsPerByte_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DrvUartBitsPerByte_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_DrvUartBitsPerByte_CALLBACK)(int cmock_num_calls);
+void DrvUartBitsPerByte_StubWithCallback(CMOCK_DrvUartBitsPerByte_CALLBACK Callback);
+#define DrvUartSetLowLatency_IgnoreAndReturn(cmock_retval) DrvUartSetLowLatency_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartSetLowLatency_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartSetLowLatency_ExpectAndReturn(on, cmock_retval) DrvUartSetLowLatency_CMockExpectAndReturn(__LINE__, on, cmock_retval)
+void DrvUartSetLowLatency_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int on, int cmock_to_return);
+typedef int (* CMOCK_DrvUartSetLowLatency_CALLBACK)(int on, int cmock_num_calls);
+void DrvUartSetLowLatency_StubWithCallback(CMOCK_DrvUartSetLowLatency_CALLBACK Callback);
+#define DrvUartOutq_IgnoreAndReturn(cmock_retval) DrvUartOutq_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartOutq_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define DrvUartOutq_ExpectAndReturn(cmock_retval) DrvUartOutq_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DrvUartOutq_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_DrvUartOutq_CALLBACK)(int cmock_num_calls);
+void DrvUartOutq_StubWithCallback(CMOCK_DrvUartOutq_CALLBACK Callback);
+#define DrvUartDrain_IgnoreAndReturn(cmock_retval) DrvUartDrain_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DrvUartDrain_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return);
+#define DrvUartDrain_ExpectAndReturn(cmock_retval) DrvUartDrain_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DrvUartDrain_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return);
+typedef long long (* CMOCK_DrvUartDrain_CALLBACK)(int cmock_num_calls);
+void DrvUartDrain_StubWithCallback(CMOCK_DrvUartDrain_CALLBACK Callback);
+#define DrvUartGetStats_Ignore() DrvUartGetStats_CMockIgnore()
+void DrvUartGetStats_CMockIgnore(void);
+#define DrvUartGetStats_Expect(stats) DrvUartGetStats_CMockExpect(__LINE__, stats)
+void DrvUartGetStats_CMockExpect(UNITY_LINE_TYPE cmock_line, drv_uart_stats_t* stats);
+typedef void (* CMOCK_DrvUartGetStats_CALLBACK)(drv_uart_stats_t* stats, int cmock_num_calls);
+void DrvUartGetStats_StubWithCallback(CMOCK_DrvUartGetStats_CALLBACK Callback);
+
+#endif
@@ -0,0 +1,5070 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_lib_epd.h"
+
+static const char* CMockString_LibEpdClear = "LibEpdClear";
+static const char* CMockString_LibEpdClose = "LibEpdClose";
+static const char* CMockString_LibEpdDispBitmap = "LibEpdDispBitmap";
+static const char* CMockString_LibEpdDispChar = "LibEpdDispChar";
+static const char* CMockString_LibEpdDispString = "LibEpdDispString";
+static const char* CMockString_LibEpdDispStringUtf8 = "LibEpdDispStringUtf8";
+static const char* CMockString_LibEpdDrain = "LibEpdDrain";
+static const char* CMockString_LibEpdDrawCircle = "LibEpdDrawCircle";
+static const char* CMockString_LibEpdDrawLine = "LibEpdDrawLine";
+static const char* CMockString_LibEpdDrawPixel = "LibEpdDrawPixel";
+static const char* CMockString_LibEpdDrawTriangle = "LibEpdDrawTriangle";
+static const char* CMockString_LibEpdEnterStopMode = "LibEpdEnterStopMode";
+static const char* CMockString_LibEpdFillCircle = "LibEpdFillCircle";
+static const char* CMockString_LibEpdFillRect = "LibEpdFillRect";
+static const char* CMockString_LibEpdFillTriangle = "LibEpdFillTriangle";
+static const char* CMockString_LibEpdFrameLen = "LibEpdFrameLen";
+static const char* CMockString_LibEpdFrameValid = "LibEpdFrameValid";
+static const char* CMockString_LibEpdGetOrientation = "LibEpdGetOrientation";
+static const char* CMockString_LibEpdGetSentState = "LibEpdGetSentState";
+static const char* CMockString_LibEpdGetState = "LibEpdGetState";
+static const char* CMockString_LibEpdHandshake = "LibEpdHandshake";
+static const char* CMockString_LibEpdInit = "LibEpdInit";
+static const char* CMockString_LibEpdInitDev = "LibEpdInitDev";
+static const char* CMockString_LibEpdInitSpeed = "LibEpdInitSpeed";
+static const char* CMockString_LibEpdLoadFont = "LibEpdLoadFont";
+static const char* CMockString_LibEpdLoadPic = "LibEpdLoadPic";
+static const char* CMockString_LibEpdNoteSent = "LibEpdNoteSent";
+static const char* CMockString_LibEpdReset = "LibEpdReset";
+static const char* CMockString_LibEpdSceneAppend = "LibEpdSceneAppend";
+static const char* CMockString_LibEpdSceneBegin = "LibEpdSceneBegin";
+static const char* CMockString_LibEpdSceneCopy = "LibEpdSceneCopy";
+static const char* CMockString_LibEpdSceneEnd = "LibEpdSceneEnd";
+static const char* CMockString_LibEpdSceneFree = "LibEpdSceneFree";
+static const char* CMockString_LibEpdSceneInit = "LibEpdSceneInit";
+static const char* CMockString_LibEpdSceneReset = "LibEpdSceneReset";
+static const char* CMockString_LibEpdSceneSend = "LibEpdSceneSend";
+static const char* CMockString_LibEpdScreenRotation = "LibEpdScreenRotation";
+static const char* CMockString_LibEpdSendFrames = "LibEpdSendFrames";
+static const char* CMockString_LibEpdSetBaud = "LibEpdSetBaud";
+static const char* CMockString_LibEpdSetChFont = "LibEpdSetChFont";
+static const char* CMockString_LibEpdSetColor = "LibEpdSetColor";
+static const char* CMockString_LibEpdSetEnFont = "LibEpdSetEnFont";
+static const char* CMockString_LibEpdSetLayer = "LibEpdSetLayer";
+static const char* CMockString_LibEpdSetLowLatency = "LibEpdSetLowLatency";
+static const char* CMockString_LibEpdSetMemory = "LibEpdSetMemory";
+static const char* CMockString_LibEpdSetOrientation = "LibEpdSetOrientation";
+static const char* CMockString_LibEpdSetSentState = "LibEpdSetSentState";
+static const char* CMockString_LibEpdSetState = "LibEpdSetState";
+static const char* CMockString_LibEpdSetWakeupGpio = "LibEpdSetWakeupGpio";
+static const char* CMockString_LibEpdTextNeedsHost = "LibEpdTextNeedsHost";
+static const char* CMockString_LibEpdUpdate = "LibEpdUpdate";
+static const char* CMockString_LibEpdWaitReady = "LibEpdWaitReady";
+static const char* CMockString_LibEpdWaitReadyUs = "LibEpdWaitReadyUs";
+static const char* CMockString_LibEpdWakeup = "LibEpdWakeup";
+static const char* CMockString_LibEpdWakeupWired = "LibEpdWakeupWired";
+static const char* CMockString_LibEpdWrite = "LibEpdWrite";
+static const char* CMockString_LibEpdWriteAfter = "LibEpdWriteAfter";
+static const char* CMockString_baud = "baud";
+static const char* CMockString_bkcolor = "bkcolor";
+static const char* CMockString_ch = "ch";
+static const char* CMockString_color = "color";
+static const char* CMockString_dev_name = "dev_name";
+static const char* CMockString_dst = "dst";
+static const char* CMockString_font = "font";
+static const char* CMockString_gpio = "gpio";
+static const char* CMockString_layer = "layer";
+static const char* CMockString_lib_epd_read_baud = "lib_epd_read_baud";
+static const char* CMockString_mode = "mode";
+static const char* CMockString_n = "n";
+static const char* CMockString_on = "on";
+static const char* CMockString_ops = "ops";
+static const char* CMockString_orientation = "orientation";
+static const char* CMockString_p = "p";
+static const char* CMockString_ptr = "ptr";
+static const char* CMockString_r = "r";
+static const char* CMockString_scene = "scene";
+static const char* CMockString_speed = "speed";
+static const char* CMockString_src = "src";
+static const char* CMockString_state = "state";
+static const char* CMockString_timeout_us = "timeout_us";
+static const char* CMockString_utf8 = "utf8";
+static const char* CMockString_x0 = "x0";
+static const char* CMockString_x1 = "x1";
+static const char* CMockString_x2 = "x2";
+static const char* CMockString_y0 = "y0";
+static const char* CMockString_y1 = "y1";
+static const char* CMockString_y2 = "y2";
+
+typedef struct _CMOCK_LibEpdInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdInitSpeed_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_speed;
+
+} CMOCK_LibEpdInitSpeed_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdInitDev_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  char* Expected_dev_name;
+  int Expected_speed;
+
+} CMOCK_LibEpdInitDev_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetLowLatency_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_on;
+
+} CMOCK_LibEpdSetLowLatency_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDrain_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  long long ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdDrain_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdGetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_state_t* Expected_state;
+
+} CMOCK_LibEpdGetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_state_t* Expected_state;
+
+} CMOCK_LibEpdSetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdGetSentState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_state_t* Expected_state;
+
+} CMOCK_LibEpdGetSentState_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetSentState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_state_t* Expected_state;
+
+} CMOCK_LibEpdSetSentState_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdNoteSent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdNoteSent_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdClose_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdClose_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdReset_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdReset_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWakeup_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdWakeup_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_gpio;
+
+} CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWakeupWired_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdWakeupWired_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdHandshake_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdHandshake_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWaitReady_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdWaitReady_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  long Expected_timeout_us;
+
+} CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetBaud_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  long Expected_baud;
+
+} CMOCK_LibEpdSetBaud_CALL_INSTANCE;
+
+typedef struct _CMOCK_lib_epd_read_baud_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_lib_epd_read_baud_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetMemory_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_mode;
+
+} CMOCK_LibEpdSetMemory_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdEnterStopMode_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdEnterStopMode_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdUpdate_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdUpdate_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdScreenRotation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_mode;
+
+} CMOCK_LibEpdScreenRotation_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetOrientation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_orientation;
+
+} CMOCK_LibEpdSetOrientation_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdGetOrientation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdGetOrientation_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+
+} CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdLoadFont_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdLoadFont_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdLoadPic_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdLoadPic_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetColor_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_color;
+  unsigned char Expected_bkcolor;
+
+} CMOCK_LibEpdSetColor_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetEnFont_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_font;
+
+} CMOCK_LibEpdSetEnFont_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetChFont_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_font;
+
+} CMOCK_LibEpdSetChFont_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDrawPixel_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+
+} CMOCK_LibEpdDrawPixel_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDrawLine_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_x1;
+  int Expected_y1;
+
+} CMOCK_LibEpdDrawLine_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdFillRect_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_x1;
+  int Expected_y1;
+
+} CMOCK_LibEpdFillRect_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDrawCircle_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_r;
+
+} CMOCK_LibEpdDrawCircle_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdFillCircle_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_r;
+
+} CMOCK_LibEpdFillCircle_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDrawTriangle_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_x1;
+  int Expected_y1;
+  int Expected_x2;
+  int Expected_y2;
+
+} CMOCK_LibEpdDrawTriangle_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdFillTriangle_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_x0;
+  int Expected_y0;
+  int Expected_x1;
+  int Expected_y1;
+  int Expected_x2;
+  int Expected_y2;
+
+} CMOCK_LibEpdFillTriangle_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdClear_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdClear_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDispChar_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  unsigned char Expected_ch;
+  int Expected_x0;
+  int Expected_y0;
+
+} CMOCK_LibEpdDispChar_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDispString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  void* Expected_p;
+  int Expected_x0;
+  int Expected_y0;
+
+} CMOCK_LibEpdDispString_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  char* Expected_utf8;
+  int Expected_x0;
+  int Expected_y0;
+
+} CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdDispBitmap_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  void* Expected_p;
+  int Expected_x0;
+  int Expected_y0;
+
+} CMOCK_LibEpdDispBitmap_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdFrameLen_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+
+} CMOCK_LibEpdFrameLen_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdFrameValid_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdFrameValid_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSendFrames_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdSendFrames_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSetLayer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int Expected_layer;
+  lib_epd_layer_t* Expected_ops;
+
+} CMOCK_LibEpdSetLayer_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdWriteAfter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  int Expected_layer;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdWriteAfter_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+
+} CMOCK_LibEpdSceneInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneFree_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+
+} CMOCK_LibEpdSceneFree_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneReset_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+
+} CMOCK_LibEpdSceneReset_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneAppend_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+  unsigned char* Expected_ptr;
+  int Expected_n;
+
+} CMOCK_LibEpdSceneAppend_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneCopy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  lib_epd_scene_t* Expected_dst;
+  lib_epd_scene_t* Expected_src;
+
+} CMOCK_LibEpdSceneCopy_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneBegin_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+
+} CMOCK_LibEpdSceneBegin_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneEnd_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+
+} CMOCK_LibEpdSceneEnd_CALL_INSTANCE;
+
+typedef struct _CMOCK_LibEpdSceneSend_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int ReturnVal;
+  int CallOrder;
+  lib_epd_scene_t* Expected_scene;
+
+} CMOCK_LibEpdSceneSend_CALL_INSTANCE;
+
+static struct mock_lib_epdInstance
+{
+  int LibEpdInit_IgnoreBool;
+  CMOCK_LibEpdInit_CALLBACK LibEpdInit_CallbackFunctionPointer;
+  int LibEpdInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdInit_CallInstance;
+  int LibEpdInitSpeed_IgnoreBool;
+  int LibEpdInitSpeed_FinalReturn;
+  CMOCK_LibEpdInitSpeed_CALLBACK LibEpdInitSpeed_CallbackFunctionPointer;
+  int LibEpdInitSpeed_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdInitSpeed_CallInstance;
+  int LibEpdInitDev_IgnoreBool;
+  int LibEpdInitDev_FinalReturn;
+  CMOCK_LibEpdInitDev_CALLBACK LibEpdInitDev_CallbackFunctionPointer;
+  int LibEpdInitDev_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdInitDev_CallInstance;
+  int LibEpdSetLowLatency_IgnoreBool;
+  int LibEpdSetLowLatency_FinalReturn;
+  CMOCK_LibEpdSetLowLatency_CALLBACK LibEpdSetLowLatency_CallbackFunctionPointer;
+  int LibEpdSetLowLatency_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetLowLatency_CallInstance;
+  int LibEpdDrain_IgnoreBool;
+  long long LibEpdDrain_FinalReturn;
+  CMOCK_LibEpdDrain_CALLBACK LibEpdDrain_CallbackFunctionPointer;
+  int LibEpdDrain_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDrain_CallInstance;
+  int LibEpdGetState_IgnoreBool;
+  CMOCK_LibEpdGetState_CALLBACK LibEpdGetState_CallbackFunctionPointer;
+  int LibEpdGetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdGetState_CallInstance;
+  int LibEpdSetState_IgnoreBool;
+  CMOCK_LibEpdSetState_CALLBACK LibEpdSetState_CallbackFunctionPointer;
+  int LibEpdSetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetState_CallInstance;
+  int LibEpdGetSentState_IgnoreBool;
+  CMOCK_LibEpdGetSentState_CALLBACK LibEpdGetSentState_CallbackFunctionPointer;
+  int LibEpdGetSentState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdGetSentState_CallInstance;
+  int LibEpdSetSentState_IgnoreBool;
+  CMOCK_LibEpdSetSentState_CALLBACK LibEpdSetSentState_CallbackFunctionPointer;
+  int LibEpdSetSentState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetSentState_CallInstance;
+  int LibEpdNoteSent_IgnoreBool;
+  CMOCK_LibEpdNoteSent_CALLBACK LibEpdNoteSent_CallbackFunctionPointer;
+  int LibEpdNoteSent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdNoteSent_CallInstance;
+  int LibEpdClose_IgnoreBool;
+  CMOCK_LibEpdClose_CALLBACK LibEpdClose_CallbackFunctionPointer;
+  int LibEpdClose_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdClose_CallInstance;
+  int LibEpdReset_IgnoreBool;
+  CMOCK_LibEpdReset_CALLBACK LibEpdReset_CallbackFunctionPointer;
+  int LibEpdReset_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdReset_CallInstance;
+  int LibEpdWakeup_IgnoreBool;
+  CMOCK_LibEpdWakeup_CALLBACK LibEpdWakeup_CallbackFunctionPointer;
+  int LibEpdWakeup_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWakeup_CallInstance;
+  int LibEpdSetWakeupGpio_IgnoreBool;
+  int LibEpdSetWakeupGpio_FinalReturn;
+  CMOCK_LibEpdSetWakeupGpio_CALLBACK LibEpdSetWakeupGpio_CallbackFunctionPointer;
+  int LibEpdSetWakeupGpio_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetWakeupGpio_CallInstance;
+  int LibEpdWakeupWired_IgnoreBool;
+  int LibEpdWakeupWired_FinalReturn;
+  CMOCK_LibEpdWakeupWired_CALLBACK LibEpdWakeupWired_CallbackFunctionPointer;
+  int LibEpdWakeupWired_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWakeupWired_CallInstance;
+  int LibEpdHandshake_IgnoreBool;
+  int LibEpdHandshake_FinalReturn;
+  CMOCK_LibEpdHandshake_CALLBACK LibEpdHandshake_CallbackFunctionPointer;
+  int LibEpdHandshake_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdHandshake_CallInstance;
+  int LibEpdWaitReady_IgnoreBool;
+  int LibEpdWaitReady_FinalReturn;
+  CMOCK_LibEpdWaitReady_CALLBACK LibEpdWaitReady_CallbackFunctionPointer;
+  int LibEpdWaitReady_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWaitReady_CallInstance;
+  int LibEpdWaitReadyUs_IgnoreBool;
+  int LibEpdWaitReadyUs_FinalReturn;
+  CMOCK_LibEpdWaitReadyUs_CALLBACK LibEpdWaitReadyUs_CallbackFunctionPointer;
+  int LibEpdWaitReadyUs_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWaitReadyUs_CallInstance;
+  int LibEpdSetBaud_IgnoreBool;
+  CMOCK_LibEpdSetBaud_CALLBACK LibEpdSetBaud_CallbackFunctionPointer;
+  int LibEpdSetBaud_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetBaud_CallInstance;
+  int lib_epd_read_baud_IgnoreBool;
+  CMOCK_lib_epd_read_baud_CALLBACK lib_epd_read_baud_CallbackFunctionPointer;
+  int lib_epd_read_baud_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE lib_epd_read_baud_CallInstance;
+  int LibEpdSetMemory_IgnoreBool;
+  CMOCK_LibEpdSetMemory_CALLBACK LibEpdSetMemory_CallbackFunctionPointer;
+  int LibEpdSetMemory_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetMemory_CallInstance;
+  int LibEpdEnterStopMode_IgnoreBool;
+  CMOCK_LibEpdEnterStopMode_CALLBACK LibEpdEnterStopMode_CallbackFunctionPointer;
+  int LibEpdEnterStopMode_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdEnterStopMode_CallInstance;
+  int LibEpdUpdate_IgnoreBool;
+  CMOCK_LibEpdUpdate_CALLBACK LibEpdUpdate_CallbackFunctionPointer;
+  int LibEpdUpdate_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdUpdate_CallInstance;
+  int LibEpdScreenRotation_IgnoreBool;
+  CMOCK_LibEpdScreenRotation_CALLBACK LibEpdScreenRotation_CallbackFunctionPointer;
+  int LibEpdScreenRotation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdScreenRotation_CallInstance;
+  int LibEpdSetOrientation_IgnoreBool;
+  CMOCK_LibEpdSetOrientation_CALLBACK LibEpdSetOrientation_CallbackFunctionPointer;
+  int LibEpdSetOrientation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetOrientation_CallInstance;
+  int LibEpdGetOrientation_IgnoreBool;
+  int LibEpdGetOrientation_FinalReturn;
+  CMOCK_LibEpdGetOrientation_CALLBACK LibEpdGetOrientation_CallbackFunctionPointer;
+  int LibEpdGetOrientation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdGetOrientation_CallInstance;
+  int LibEpdTextNeedsHost_IgnoreBool;
+  int LibEpdTextNeedsHost_FinalReturn;
+  CMOCK_LibEpdTextNeedsHost_CALLBACK LibEpdTextNeedsHost_CallbackFunctionPointer;
+  int LibEpdTextNeedsHost_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdTextNeedsHost_CallInstance;
+  int LibEpdLoadFont_IgnoreBool;
+  CMOCK_LibEpdLoadFont_CALLBACK LibEpdLoadFont_CallbackFunctionPointer;
+  int LibEpdLoadFont_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdLoadFont_CallInstance;
+  int LibEpdLoadPic_IgnoreBool;
+  CMOCK_LibEpdLoadPic_CALLBACK LibEpdLoadPic_CallbackFunctionPointer;
+  int LibEpdLoadPic_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdLoadPic_CallInstance;
+  int LibEpdSetColor_IgnoreBool;
+  CMOCK_LibEpdSetColor_CALLBACK LibEpdSetColor_CallbackFunctionPointer;
+  int LibEpdSetColor_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetColor_CallInstance;
+  int LibEpdSetEnFont_IgnoreBool;
+  CMOCK_LibEpdSetEnFont_CALLBACK LibEpdSetEnFont_CallbackFunctionPointer;
+  int LibEpdSetEnFont_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetEnFont_CallInstance;
+  int LibEpdSetChFont_IgnoreBool;
+  CMOCK_LibEpdSetChFont_CALLBACK LibEpdSetChFont_CallbackFunctionPointer;
+  int LibEpdSetChFont_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetChFont_CallInstance;
+  int LibEpdDrawPixel_IgnoreBool;
+  CMOCK_LibEpdDrawPixel_CALLBACK LibEpdDrawPixel_CallbackFunctionPointer;
+  int LibEpdDrawPixel_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDrawPixel_CallInstance;
+  int LibEpdDrawLine_IgnoreBool;
+  CMOCK_LibEpdDrawLine_CALLBACK LibEpdDrawLine_CallbackFunctionPointer;
+  int LibEpdDrawLine_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDrawLine_CallInstance;
+  int LibEpdFillRect_IgnoreBool;
+  CMOCK_LibEpdFillRect_CALLBACK LibEpdFillRect_CallbackFunctionPointer;
+  int LibEpdFillRect_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdFillRect_CallInstance;
+  int LibEpdDrawCircle_IgnoreBool;
+  CMOCK_LibEpdDrawCircle_CALLBACK LibEpdDrawCircle_CallbackFunctionPointer;
+  int LibEpdDrawCircle_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDrawCircle_CallInstance;
+  int LibEpdFillCircle_IgnoreBool;
+  CMOCK_LibEpdFillCircle_CALLBACK LibEpdFillCircle_CallbackFunctionPointer;
+  int LibEpdFillCircle_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdFillCircle_CallInstance;
+  int LibEpdDrawTriangle_IgnoreBool;
+  CMOCK_LibEpdDrawTriangle_CALLBACK LibEpdDrawTriangle_CallbackFunctionPointer;
+  int LibEpdDrawTriangle_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDrawTriangle_CallInstance;
+  int LibEpdFillTriangle_IgnoreBool;
+  CMOCK_LibEpdFillTriangle_CALLBACK LibEpdFillTriangle_CallbackFunctionPointer;
+  int LibEpdFillTriangle_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdFillTriangle_CallInstance;
+  int LibEpdClear_IgnoreBool;
+  CMOCK_LibEpdClear_CALLBACK LibEpdClear_CallbackFunctionPointer;
+  int LibEpdClear_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdClear_CallInstance;
+  int LibEpdDispChar_IgnoreBool;
+  CMOCK_LibEpdDispChar_CALLBACK LibEpdDispChar_CallbackFunctionPointer;
+  int LibEpdDispChar_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDispChar_CallInstance;
+  int LibEpdDispString_IgnoreBool;
+  CMOCK_LibEpdDispString_CALLBACK LibEpdDispString_CallbackFunctionPointer;
+  int LibEpdDispString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDispString_CallInstance;
+  int LibEpdDispStringUtf8_IgnoreBool;
+  int LibEpdDispStringUtf8_FinalReturn;
+  CMOCK_LibEpdDispStringUtf8_CALLBACK LibEpdDispStringUtf8_CallbackFunctionPointer;
+  int LibEpdDispStringUtf8_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDispStringUtf8_CallInstance;
+  int LibEpdDispBitmap_IgnoreBool;
+  CMOCK_LibEpdDispBitmap_CALLBACK LibEpdDispBitmap_CallbackFunctionPointer;
+  int LibEpdDispBitmap_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdDispBitmap_CallInstance;
+  int LibEpdFrameLen_IgnoreBool;
+  int LibEpdFrameLen_FinalReturn;
+  CMOCK_LibEpdFrameLen_CALLBACK LibEpdFrameLen_CallbackFunctionPointer;
+  int LibEpdFrameLen_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdFrameLen_CallInstance;
+  int LibEpdFrameValid_IgnoreBool;
+  int LibEpdFrameValid_FinalReturn;
+  CMOCK_LibEpdFrameValid_CALLBACK LibEpdFrameValid_CallbackFunctionPointer;
+  int LibEpdFrameValid_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdFrameValid_CallInstance;
+  int LibEpdSendFrames_IgnoreBool;
+  int LibEpdSendFrames_FinalReturn;
+  CMOCK_LibEpdSendFrames_CALLBACK LibEpdSendFrames_CallbackFunctionPointer;
+  int LibEpdSendFrames_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSendFrames_CallInstance;
+  int LibEpdSetLayer_IgnoreBool;
+  CMOCK_LibEpdSetLayer_CALLBACK LibEpdSetLayer_CallbackFunctionPointer;
+  int LibEpdSetLayer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSetLayer_CallInstance;
+  int LibEpdWrite_IgnoreBool;
+  int LibEpdWrite_FinalReturn;
+  CMOCK_LibEpdWrite_CALLBACK LibEpdWrite_CallbackFunctionPointer;
+  int LibEpdWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWrite_CallInstance;
+  int LibEpdWriteAfter_IgnoreBool;
+  int LibEpdWriteAfter_FinalReturn;
+  CMOCK_LibEpdWriteAfter_CALLBACK LibEpdWriteAfter_CallbackFunctionPointer;
+  int LibEpdWriteAfter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdWriteAfter_CallInstance;
+  int LibEpdSceneInit_IgnoreBool;
+  CMOCK_LibEpdSceneInit_CALLBACK LibEpdSceneInit_CallbackFunctionPointer;
+  int LibEpdSceneInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneInit_CallInstance;
+  int LibEpdSceneFree_IgnoreBool;
+  CMOCK_LibEpdSceneFree_CALLBACK LibEpdSceneFree_CallbackFunctionPointer;
+  int LibEpdSceneFree_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneFree_CallInstance;
+  int LibEpdSceneReset_IgnoreBool;
+  CMOCK_LibEpdSceneReset_CALLBACK LibEpdSceneReset_CallbackFunctionPointer;
+  int LibEpdSceneReset_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneReset_CallInstance;
+  int LibEpdSceneAppend_IgnoreBool;
+  int LibEpdSceneAppend_FinalReturn;
+  CMOCK_LibEpdSceneAppend_CALLBACK LibEpdSceneAppend_CallbackFunctionPointer;
+  int LibEpdSceneAppend_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneAppend_CallInstance;
+  int LibEpdSceneCopy_IgnoreBool;
+  int LibEpdSceneCopy_FinalReturn;
+  CMOCK_LibEpdSceneCopy_CALLBACK LibEpdSceneCopy_CallbackFunctionPointer;
+  int LibEpdSceneCopy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneCopy_CallInstance;
+  int LibEpdSceneBegin_IgnoreBool;
+  CMOCK_LibEpdSceneBegin_CALLBACK LibEpdSceneBegin_CallbackFunctionPointer;
+  int LibEpdSceneBegin_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneBegin_CallInstance;
+  int LibEpdSceneEnd_IgnoreBool;
+  CMOCK_LibEpdSceneEnd_CALLBACK LibEpdSceneEnd_CallbackFunctionPointer;
+  int LibEpdSceneEnd_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneEnd_CallInstance;
+  int LibEpdSceneSend_IgnoreBool;
+  int LibEpdSceneSend_FinalReturn;
+  CMOCK_LibEpdSceneSend_CALLBACK LibEpdSceneSend_CallbackFunctionPointer;
+  int LibEpdSceneSend_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LibEpdSceneSend_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_lib_epd_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.LibEpdInit_IgnoreBool)
+    Mock.LibEpdInit_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdInit);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdInit_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdInit_CallbackFunctionPointer != NULL)
+    Mock.LibEpdInit_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdInitSpeed_IgnoreBool)
+    Mock.LibEpdInitSpeed_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdInitSpeed);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdInitSpeed_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdInitSpeed_CallbackFunctionPointer != NULL)
+    Mock.LibEpdInitSpeed_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdInitDev_IgnoreBool)
+    Mock.LibEpdInitDev_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdInitDev);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdInitDev_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdInitDev_CallbackFunctionPointer != NULL)
+    Mock.LibEpdInitDev_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetLowLatency_IgnoreBool)
+    Mock.LibEpdSetLowLatency_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetLowLatency);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetLowLatency_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetLowLatency_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetLowLatency_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDrain_IgnoreBool)
+    Mock.LibEpdDrain_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrain);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDrain_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDrain_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDrain_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdGetState_IgnoreBool)
+    Mock.LibEpdGetState_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetState);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdGetState_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdGetState_CallbackFunctionPointer != NULL)
+    Mock.LibEpdGetState_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetState_IgnoreBool)
+    Mock.LibEpdSetState_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetState);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetState_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetState_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetState_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdGetSentState_IgnoreBool)
+    Mock.LibEpdGetSentState_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetSentState);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdGetSentState_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdGetSentState_CallbackFunctionPointer != NULL)
+    Mock.LibEpdGetSentState_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetSentState_IgnoreBool)
+    Mock.LibEpdSetSentState_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetSentState);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetSentState_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetSentState_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetSentState_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdNoteSent_IgnoreBool)
+    Mock.LibEpdNoteSent_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdNoteSent);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdNoteSent_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdNoteSent_CallbackFunctionPointer != NULL)
+    Mock.LibEpdNoteSent_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdClose_IgnoreBool)
+    Mock.LibEpdClose_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdClose);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdClose_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdClose_CallbackFunctionPointer != NULL)
+    Mock.LibEpdClose_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdReset_IgnoreBool)
+    Mock.LibEpdReset_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdReset);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdReset_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdReset_CallbackFunctionPointer != NULL)
+    Mock.LibEpdReset_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWakeup_IgnoreBool)
+    Mock.LibEpdWakeup_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWakeup);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWakeup_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWakeup_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWakeup_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetWakeupGpio_IgnoreBool)
+    Mock.LibEpdSetWakeupGpio_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetWakeupGpio);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetWakeupGpio_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetWakeupGpio_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetWakeupGpio_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWakeupWired_IgnoreBool)
+    Mock.LibEpdWakeupWired_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWakeupWired);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWakeupWired_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWakeupWired_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWakeupWired_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdHandshake_IgnoreBool)
+    Mock.LibEpdHandshake_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdHandshake);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdHandshake_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdHandshake_CallbackFunctionPointer != NULL)
+    Mock.LibEpdHandshake_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWaitReady_IgnoreBool)
+    Mock.LibEpdWaitReady_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWaitReady);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWaitReady_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWaitReady_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWaitReady_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWaitReadyUs_IgnoreBool)
+    Mock.LibEpdWaitReadyUs_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWaitReadyUs);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWaitReadyUs_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWaitReadyUs_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWaitReadyUs_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetBaud_IgnoreBool)
+    Mock.LibEpdSetBaud_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetBaud);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetBaud_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetBaud_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetBaud_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.lib_epd_read_baud_IgnoreBool)
+    Mock.lib_epd_read_baud_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_lib_epd_read_baud);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.lib_epd_read_baud_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.lib_epd_read_baud_CallbackFunctionPointer != NULL)
+    Mock.lib_epd_read_baud_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetMemory_IgnoreBool)
+    Mock.LibEpdSetMemory_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetMemory);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetMemory_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetMemory_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetMemory_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdEnterStopMode_IgnoreBool)
+    Mock.LibEpdEnterStopMode_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdEnterStopMode);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdEnterStopMode_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdEnterStopMode_CallbackFunctionPointer != NULL)
+    Mock.LibEpdEnterStopMode_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdUpdate_IgnoreBool)
+    Mock.LibEpdUpdate_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdUpdate);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdUpdate_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdUpdate_CallbackFunctionPointer != NULL)
+    Mock.LibEpdUpdate_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdScreenRotation_IgnoreBool)
+    Mock.LibEpdScreenRotation_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdScreenRotation);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdScreenRotation_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdScreenRotation_CallbackFunctionPointer != NULL)
+    Mock.LibEpdScreenRotation_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetOrientation_IgnoreBool)
+    Mock.LibEpdSetOrientation_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetOrientation);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetOrientation_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetOrientation_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetOrientation_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdGetOrientation_IgnoreBool)
+    Mock.LibEpdGetOrientation_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetOrientation);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdGetOrientation_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdGetOrientation_CallbackFunctionPointer != NULL)
+    Mock.LibEpdGetOrientation_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdTextNeedsHost_IgnoreBool)
+    Mock.LibEpdTextNeedsHost_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdTextNeedsHost);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdTextNeedsHost_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdTextNeedsHost_CallbackFunctionPointer != NULL)
+    Mock.LibEpdTextNeedsHost_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdLoadFont_IgnoreBool)
+    Mock.LibEpdLoadFont_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdLoadFont);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdLoadFont_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdLoadFont_CallbackFunctionPointer != NULL)
+    Mock.LibEpdLoadFont_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdLoadPic_IgnoreBool)
+    Mock.LibEpdLoadPic_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdLoadPic);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdLoadPic_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdLoadPic_CallbackFunctionPointer != NULL)
+    Mock.LibEpdLoadPic_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetColor_IgnoreBool)
+    Mock.LibEpdSetColor_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetColor);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetColor_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetColor_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetColor_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetEnFont_IgnoreBool)
+    Mock.LibEpdSetEnFont_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetEnFont);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetEnFont_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetEnFont_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetEnFont_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetChFont_IgnoreBool)
+    Mock.LibEpdSetChFont_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetChFont);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetChFont_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetChFont_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetChFont_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDrawPixel_IgnoreBool)
+    Mock.LibEpdDrawPixel_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawPixel);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDrawPixel_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDrawPixel_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDrawPixel_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDrawLine_IgnoreBool)
+    Mock.LibEpdDrawLine_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawLine);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDrawLine_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDrawLine_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDrawLine_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdFillRect_IgnoreBool)
+    Mock.LibEpdFillRect_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillRect);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdFillRect_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdFillRect_CallbackFunctionPointer != NULL)
+    Mock.LibEpdFillRect_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDrawCircle_IgnoreBool)
+    Mock.LibEpdDrawCircle_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawCircle);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDrawCircle_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDrawCircle_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDrawCircle_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdFillCircle_IgnoreBool)
+    Mock.LibEpdFillCircle_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillCircle);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdFillCircle_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdFillCircle_CallbackFunctionPointer != NULL)
+    Mock.LibEpdFillCircle_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDrawTriangle_IgnoreBool)
+    Mock.LibEpdDrawTriangle_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawTriangle);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDrawTriangle_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDrawTriangle_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDrawTriangle_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdFillTriangle_IgnoreBool)
+    Mock.LibEpdFillTriangle_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillTriangle);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdFillTriangle_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdFillTriangle_CallbackFunctionPointer != NULL)
+    Mock.LibEpdFillTriangle_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdClear_IgnoreBool)
+    Mock.LibEpdClear_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdClear);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdClear_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdClear_CallbackFunctionPointer != NULL)
+    Mock.LibEpdClear_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDispChar_IgnoreBool)
+    Mock.LibEpdDispChar_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispChar);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDispChar_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDispChar_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDispChar_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDispString_IgnoreBool)
+    Mock.LibEpdDispString_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispString);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDispString_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDispString_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDispString_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDispStringUtf8_IgnoreBool)
+    Mock.LibEpdDispStringUtf8_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispStringUtf8);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDispStringUtf8_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDispStringUtf8_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDispStringUtf8_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdDispBitmap_IgnoreBool)
+    Mock.LibEpdDispBitmap_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispBitmap);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdDispBitmap_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdDispBitmap_CallbackFunctionPointer != NULL)
+    Mock.LibEpdDispBitmap_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdFrameLen_IgnoreBool)
+    Mock.LibEpdFrameLen_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdFrameLen);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdFrameLen_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdFrameLen_CallbackFunctionPointer != NULL)
+    Mock.LibEpdFrameLen_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdFrameValid_IgnoreBool)
+    Mock.LibEpdFrameValid_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdFrameValid);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdFrameValid_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdFrameValid_CallbackFunctionPointer != NULL)
+    Mock.LibEpdFrameValid_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSendFrames_IgnoreBool)
+    Mock.LibEpdSendFrames_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSendFrames);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSendFrames_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSendFrames_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSendFrames_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSetLayer_IgnoreBool)
+    Mock.LibEpdSetLayer_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetLayer);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSetLayer_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSetLayer_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSetLayer_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWrite_IgnoreBool)
+    Mock.LibEpdWrite_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWrite);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWrite_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWrite_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWrite_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdWriteAfter_IgnoreBool)
+    Mock.LibEpdWriteAfter_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdWriteAfter);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdWriteAfter_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdWriteAfter_CallbackFunctionPointer != NULL)
+    Mock.LibEpdWriteAfter_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneInit_IgnoreBool)
+    Mock.LibEpdSceneInit_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneInit);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneInit_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneInit_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneInit_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneFree_IgnoreBool)
+    Mock.LibEpdSceneFree_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneFree);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneFree_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneFree_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneFree_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneReset_IgnoreBool)
+    Mock.LibEpdSceneReset_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneReset);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneReset_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneReset_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneReset_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneAppend_IgnoreBool)
+    Mock.LibEpdSceneAppend_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneAppend);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneAppend_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneAppend_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneAppend_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneCopy_IgnoreBool)
+    Mock.LibEpdSceneCopy_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneCopy);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneCopy_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneCopy_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneCopy_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneBegin_IgnoreBool)
+    Mock.LibEpdSceneBegin_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneBegin);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneBegin_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneBegin_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneBegin_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneEnd_IgnoreBool)
+    Mock.LibEpdSceneEnd_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneEnd);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneEnd_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneEnd_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneEnd_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.LibEpdSceneSend_IgnoreBool)
+    Mock.LibEpdSceneSend_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneSend);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.LibEpdSceneSend_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.LibEpdSceneSend_CallbackFunctionPointer != NULL)
+    Mock.LibEpdSceneSend_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_lib_epd_Init(void)
+{
+  mock_lib_epd_Destroy();
+}
+
+void mock_lib_epd_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.LibEpdInit_CallbackFunctionPointer = NULL;
+  Mock.LibEpdInit_CallbackCalls = 0;
+  Mock.LibEpdInitSpeed_CallbackFunctionPointer = NULL;
+  Mock.LibEpdInitSpeed_CallbackCalls = 0;
+  Mock.LibEpdInitDev_CallbackFunctionPointer = NULL;
+  Mock.LibEpdInitDev_CallbackCalls = 0;
+  Mock.LibEpdSetLowLatency_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetLowLatency_CallbackCalls = 0;
+  Mock.LibEpdDrain_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDrain_CallbackCalls = 0;
+  Mock.LibEpdGetState_CallbackFunctionPointer = NULL;
+  Mock.LibEpdGetState_CallbackCalls = 0;
+  Mock.LibEpdSetState_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetState_CallbackCalls = 0;
+  Mock.LibEpdGetSentState_CallbackFunctionPointer = NULL;
+  Mock.LibEpdGetSentState_CallbackCalls = 0;
+  Mock.LibEpdSetSentState_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetSentState_CallbackCalls = 0;
+  Mock.LibEpdNoteSent_CallbackFunctionPointer = NULL;
+  Mock.LibEpdNoteSent_CallbackCalls = 0;
+  Mock.LibEpdClose_CallbackFunctionPointer = NULL;
+  Mock.LibEpdClose_CallbackCalls = 0;
+  Mock.LibEpdReset_CallbackFunctionPointer = NULL;
+  Mock.LibEpdReset_CallbackCalls = 0;
+  Mock.LibEpdWakeup_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWakeup_CallbackCalls = 0;
+  Mock.LibEpdSetWakeupGpio_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetWakeupGpio_CallbackCalls = 0;
+  Mock.LibEpdWakeupWired_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWakeupWired_CallbackCalls = 0;
+  Mock.LibEpdHandshake_CallbackFunctionPointer = NULL;
+  Mock.LibEpdHandshake_CallbackCalls = 0;
+  Mock.LibEpdWaitReady_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWaitReady_CallbackCalls = 0;
+  Mock.LibEpdWaitReadyUs_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWaitReadyUs_CallbackCalls = 0;
+  Mock.LibEpdSetBaud_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetBaud_CallbackCalls = 0;
+  Mock.lib_epd_read_baud_CallbackFunctionPointer = NULL;
+  Mock.lib_epd_read_baud_CallbackCalls = 0;
+  Mock.LibEpdSetMemory_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetMemory_CallbackCalls = 0;
+  Mock.LibEpdEnterStopMode_CallbackFunctionPointer = NULL;
+  Mock.LibEpdEnterStopMode_CallbackCalls = 0;
+  Mock.LibEpdUpdate_CallbackFunctionPointer = NULL;
+  Mock.LibEpdUpdate_CallbackCalls = 0;
+  Mock.LibEpdScreenRotation_CallbackFunctionPointer = NULL;
+  Mock.LibEpdScreenRotation_CallbackCalls = 0;
+  Mock.LibEpdSetOrientation_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetOrientation_CallbackCalls = 0;
+  Mock.LibEpdGetOrientation_CallbackFunctionPointer = NULL;
+  Mock.LibEpdGetOrientation_CallbackCalls = 0;
+  Mock.LibEpdTextNeedsHost_CallbackFunctionPointer = NULL;
+  Mock.LibEpdTextNeedsHost_CallbackCalls = 0;
+  Mock.LibEpdLoadFont_CallbackFunctionPointer = NULL;
+  Mock.LibEpdLoadFont_CallbackCalls = 0;
+  Mock.LibEpdLoadPic_CallbackFunctionPointer = NULL;
+  Mock.LibEpdLoadPic_CallbackCalls = 0;
+  Mock.LibEpdSetColor_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetColor_CallbackCalls = 0;
+  Mock.LibEpdSetEnFont_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetEnFont_CallbackCalls = 0;
+  Mock.LibEpdSetChFont_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetChFont_CallbackCalls = 0;
+  Mock.LibEpdDrawPixel_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDrawPixel_CallbackCalls = 0;
+  Mock.LibEpdDrawLine_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDrawLine_CallbackCalls = 0;
+  Mock.LibEpdFillRect_CallbackFunctionPointer = NULL;
+  Mock.LibEpdFillRect_CallbackCalls = 0;
+  Mock.LibEpdDrawCircle_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDrawCircle_CallbackCalls = 0;
+  Mock.LibEpdFillCircle_CallbackFunctionPointer = NULL;
+  Mock.LibEpdFillCircle_CallbackCalls = 0;
+  Mock.LibEpdDrawTriangle_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDrawTriangle_CallbackCalls = 0;
+  Mock.LibEpdFillTriangle_CallbackFunctionPointer = NULL;
+  Mock.LibEpdFillTriangle_CallbackCalls = 0;
+  Mock.LibEpdClear_CallbackFunctionPointer = NULL;
+  Mock.LibEpdClear_CallbackCalls = 0;
+  Mock.LibEpdDispChar_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDispChar_CallbackCalls = 0;
+  Mock.LibEpdDispString_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDispString_CallbackCalls = 0;
+  Mock.LibEpdDispStringUtf8_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDispStringUtf8_CallbackCalls = 0;
+  Mock.LibEpdDispBitmap_CallbackFunctionPointer = NULL;
+  Mock.LibEpdDispBitmap_CallbackCalls = 0;
+  Mock.LibEpdFrameLen_CallbackFunctionPointer = NULL;
+  Mock.LibEpdFrameLen_CallbackCalls = 0;
+  Mock.LibEpdFrameValid_CallbackFunctionPointer = NULL;
+  Mock.LibEpdFrameValid_CallbackCalls = 0;
+  Mock.LibEpdSendFrames_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSendFrames_CallbackCalls = 0;
+  Mock.LibEpdSetLayer_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSetLayer_CallbackCalls = 0;
+  Mock.LibEpdWrite_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWrite_CallbackCalls = 0;
+  Mock.LibEpdWriteAfter_CallbackFunctionPointer = NULL;
+  Mock.LibEpdWriteAfter_CallbackCalls = 0;
+  Mock.LibEpdSceneInit_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneInit_CallbackCalls = 0;
+  Mock.LibEpdSceneFree_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneFree_CallbackCalls = 0;
+  Mock.LibEpdSceneReset_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneReset_CallbackCalls = 0;
+  Mock.LibEpdSceneAppend_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneAppend_CallbackCalls = 0;
+  Mock.LibEpdSceneCopy_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneCopy_CallbackCalls = 0;
+  Mock.LibEpdSceneBegin_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneBegin_CallbackCalls = 0;
+  Mock.LibEpdSceneEnd_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneEnd_CallbackCalls = 0;
+  Mock.LibEpdSceneSend_CallbackFunctionPointer = NULL;
+  Mock.LibEpdSceneSend_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void LibEpdInit(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdInit);
+  cmock_call_instance = (CMOCK_LibEpdInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdInit_CallInstance);
+  Mock.LibEpdInit_CallInstance = CMock_Guts_MemNext(Mock.LibEpdInit_CallInstance);
+  if (Mock.LibEpdInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdInit_CallbackFunctionPointer(Mock.LibEpdInit_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdInit_CMockIgnore(void)
+{
+  Mock.LibEpdInit_IgnoreBool = (int)1;
+}
+
+void LibEpdInit_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdInit_CALL_INSTANCE));
+  CMOCK_LibEpdInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdInit_CallInstance = CMock_Guts_MemChain(Mock.LibEpdInit_CallInstance, cmock_guts_index);
+  Mock.LibEpdInit_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdInit_StubWithCallback(CMOCK_LibEpdInit_CALLBACK Callback)
+{
+  Mock.LibEpdInit_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdInitSpeed(int speed)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdInitSpeed_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdInitSpeed);
+  cmock_call_instance = (CMOCK_LibEpdInitSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdInitSpeed_CallInstance);
+  Mock.LibEpdInitSpeed_CallInstance = CMock_Guts_MemNext(Mock.LibEpdInitSpeed_CallInstance);
+  if (Mock.LibEpdInitSpeed_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdInitSpeed_FinalReturn;
+    Mock.LibEpdInitSpeed_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdInitSpeed_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdInitSpeed_CallbackFunctionPointer(speed, Mock.LibEpdInitSpeed_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdInitSpeed,CMockString_speed);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_speed, speed, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdInitSpeed(CMOCK_LibEpdInitSpeed_CALL_INSTANCE* cmock_call_instance, int speed)
+{
+  cmock_call_instance->Expected_speed = speed;
+}
+
+void LibEpdInitSpeed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdInitSpeed_CALL_INSTANCE));
+  CMOCK_LibEpdInitSpeed_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdInitSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdInitSpeed_CallInstance = CMock_Guts_MemChain(Mock.LibEpdInitSpeed_CallInstance, cmock_guts_index);
+  Mock.LibEpdInitSpeed_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdInitSpeed_IgnoreBool = (int)1;
+}
+
+void LibEpdInitSpeed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int speed, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdInitSpeed_CALL_INSTANCE));
+  CMOCK_LibEpdInitSpeed_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdInitSpeed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdInitSpeed_CallInstance = CMock_Guts_MemChain(Mock.LibEpdInitSpeed_CallInstance, cmock_guts_index);
+  Mock.LibEpdInitSpeed_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdInitSpeed(cmock_call_instance, speed);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdInitSpeed_StubWithCallback(CMOCK_LibEpdInitSpeed_CALLBACK Callback)
+{
+  Mock.LibEpdInitSpeed_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdInitDev(const char* dev_name, int speed)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdInitDev_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdInitDev);
+  cmock_call_instance = (CMOCK_LibEpdInitDev_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdInitDev_CallInstance);
+  Mock.LibEpdInitDev_CallInstance = CMock_Guts_MemNext(Mock.LibEpdInitDev_CallInstance);
+  if (Mock.LibEpdInitDev_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdInitDev_FinalReturn;
+    Mock.LibEpdInitDev_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdInitDev_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdInitDev_CallbackFunctionPointer(dev_name, speed, Mock.LibEpdInitDev_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdInitDev,CMockString_dev_name);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_dev_name, dev_name, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdInitDev,CMockString_speed);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_speed, speed, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdInitDev(CMOCK_LibEpdInitDev_CALL_INSTANCE* cmock_call_instance, const char* dev_name, int speed)
+{
+  cmock_call_instance->Expected_dev_name = (char*)dev_name;
+  cmock_call_instance->Expected_speed = speed;
+}
+
+void LibEpdInitDev_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdInitDev_CALL_INSTANCE));
+  CMOCK_LibEpdInitDev_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdInitDev_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdInitDev_CallInstance = CMock_Guts_MemChain(Mock.LibEpdInitDev_CallInstance, cmock_guts_index);
+  Mock.LibEpdInitDev_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdInitDev_IgnoreBool = (int)1;
+}
+
+void LibEpdInitDev_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const char* dev_name, int speed, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdInitDev_CALL_INSTANCE));
+  CMOCK_LibEpdInitDev_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdInitDev_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdInitDev_CallInstance = CMock_Guts_MemChain(Mock.LibEpdInitDev_CallInstance, cmock_guts_index);
+  Mock.LibEpdInitDev_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdInitDev(cmock_call_instance, dev_name, speed);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdInitDev_StubWithCallback(CMOCK_LibEpdInitDev_CALLBACK Callback)
+{
+  Mock.LibEpdInitDev_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSetLowLatency(int on)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetLowLatency_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetLowLatency);
+  cmock_call_instance = (CMOCK_LibEpdSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetLowLatency_CallInstance);
+  Mock.LibEpdSetLowLatency_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetLowLatency_CallInstance);
+  if (Mock.LibEpdSetLowLatency_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSetLowLatency_FinalReturn;
+    Mock.LibEpdSetLowLatency_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSetLowLatency_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSetLowLatency_CallbackFunctionPointer(on, Mock.LibEpdSetLowLatency_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetLowLatency,CMockString_on);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_on, on, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSetLowLatency(CMOCK_LibEpdSetLowLatency_CALL_INSTANCE* cmock_call_instance, int on)
+{
+  cmock_call_instance->Expected_on = on;
+}
+
+void LibEpdSetLowLatency_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetLowLatency_CALL_INSTANCE));
+  CMOCK_LibEpdSetLowLatency_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetLowLatency_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetLowLatency_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetLowLatency_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSetLowLatency_IgnoreBool = (int)1;
+}
+
+void LibEpdSetLowLatency_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int on, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetLowLatency_CALL_INSTANCE));
+  CMOCK_LibEpdSetLowLatency_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetLowLatency_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetLowLatency_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetLowLatency_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetLowLatency_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetLowLatency(cmock_call_instance, on);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetLowLatency_StubWithCallback(CMOCK_LibEpdSetLowLatency_CALLBACK Callback)
+{
+  Mock.LibEpdSetLowLatency_CallbackFunctionPointer = Callback;
+}
+
+long long LibEpdDrain(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDrain_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrain);
+  cmock_call_instance = (CMOCK_LibEpdDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDrain_CallInstance);
+  Mock.LibEpdDrain_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDrain_CallInstance);
+  if (Mock.LibEpdDrain_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdDrain_FinalReturn;
+    memcpy(&Mock.LibEpdDrain_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(long long));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdDrain_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdDrain_CallbackFunctionPointer(Mock.LibEpdDrain_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdDrain_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrain_CALL_INSTANCE));
+  CMOCK_LibEpdDrain_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrain_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrain_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrain_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdDrain_IgnoreBool = (int)1;
+}
+
+void LibEpdDrain_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrain_CALL_INSTANCE));
+  CMOCK_LibEpdDrain_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrain_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrain_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrain_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrain_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(long long));
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDrain_StubWithCallback(CMOCK_LibEpdDrain_CALLBACK Callback)
+{
+  Mock.LibEpdDrain_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdGetState(lib_epd_state_t* state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdGetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetState);
+  cmock_call_instance = (CMOCK_LibEpdGetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdGetState_CallInstance);
+  Mock.LibEpdGetState_CallInstance = CMock_Guts_MemNext(Mock.LibEpdGetState_CallInstance);
+  if (Mock.LibEpdGetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdGetState_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdGetState_CallbackFunctionPointer(state, Mock.LibEpdGetState_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdGetState,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_state), (void*)(state), sizeof(lib_epd_state_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdGetState(CMOCK_LibEpdGetState_CALL_INSTANCE* cmock_call_instance, lib_epd_state_t* state)
+{
+  cmock_call_instance->Expected_state = state;
+}
+
+void LibEpdGetState_CMockIgnore(void)
+{
+  Mock.LibEpdGetState_IgnoreBool = (int)1;
+}
+
+void LibEpdGetState_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_state_t* state)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdGetState_CALL_INSTANCE));
+  CMOCK_LibEpdGetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdGetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdGetState_CallInstance = CMock_Guts_MemChain(Mock.LibEpdGetState_CallInstance, cmock_guts_index);
+  Mock.LibEpdGetState_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdGetState(cmock_call_instance, state);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdGetState_StubWithCallback(CMOCK_LibEpdGetState_CALLBACK Callback)
+{
+  Mock.LibEpdGetState_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetState(const lib_epd_state_t* state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetState);
+  cmock_call_instance = (CMOCK_LibEpdSetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetState_CallInstance);
+  Mock.LibEpdSetState_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetState_CallInstance);
+  if (Mock.LibEpdSetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetState_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetState_CallbackFunctionPointer(state, Mock.LibEpdSetState_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetState,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_state), (void*)(state), sizeof(lib_epd_state_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetState(CMOCK_LibEpdSetState_CALL_INSTANCE* cmock_call_instance, const lib_epd_state_t* state)
+{
+  cmock_call_instance->Expected_state = (lib_epd_state_t*)state;
+}
+
+void LibEpdSetState_CMockIgnore(void)
+{
+  Mock.LibEpdSetState_IgnoreBool = (int)1;
+}
+
+void LibEpdSetState_CMockExpect(UNITY_LINE_TYPE cmock_line, const lib_epd_state_t* state)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetState_CALL_INSTANCE));
+  CMOCK_LibEpdSetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetState_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetState_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetState_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetState(cmock_call_instance, state);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetState_StubWithCallback(CMOCK_LibEpdSetState_CALLBACK Callback)
+{
+  Mock.LibEpdSetState_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdGetSentState(lib_epd_state_t* state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdGetSentState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetSentState);
+  cmock_call_instance = (CMOCK_LibEpdGetSentState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdGetSentState_CallInstance);
+  Mock.LibEpdGetSentState_CallInstance = CMock_Guts_MemNext(Mock.LibEpdGetSentState_CallInstance);
+  if (Mock.LibEpdGetSentState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdGetSentState_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdGetSentState_CallbackFunctionPointer(state, Mock.LibEpdGetSentState_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdGetSentState,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_state), (void*)(state), sizeof(lib_epd_state_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdGetSentState(CMOCK_LibEpdGetSentState_CALL_INSTANCE* cmock_call_instance, lib_epd_state_t* state)
+{
+  cmock_call_instance->Expected_state = state;
+}
+
+void LibEpdGetSentState_CMockIgnore(void)
+{
+  Mock.LibEpdGetSentState_IgnoreBool = (int)1;
+}
+
+void LibEpdGetSentState_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_state_t* state)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdGetSentState_CALL_INSTANCE));
+  CMOCK_LibEpdGetSentState_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdGetSentState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdGetSentState_CallInstance = CMock_Guts_MemChain(Mock.LibEpdGetSentState_CallInstance, cmock_guts_index);
+  Mock.LibEpdGetSentState_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdGetSentState(cmock_call_instance, state);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdGetSentState_StubWithCallback(CMOCK_LibEpdGetSentState_CALLBACK Callback)
+{
+  Mock.LibEpdGetSentState_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetSentState(const lib_epd_state_t* state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetSentState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetSentState);
+  cmock_call_instance = (CMOCK_LibEpdSetSentState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetSentState_CallInstance);
+  Mock.LibEpdSetSentState_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetSentState_CallInstance);
+  if (Mock.LibEpdSetSentState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetSentState_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetSentState_CallbackFunctionPointer(state, Mock.LibEpdSetSentState_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetSentState,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_state), (void*)(state), sizeof(lib_epd_state_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetSentState(CMOCK_LibEpdSetSentState_CALL_INSTANCE* cmock_call_instance, const lib_epd_state_t* state)
+{
+  cmock_call_instance->Expected_state = (lib_epd_state_t*)state;
+}
+
+void LibEpdSetSentState_CMockIgnore(void)
+{
+  Mock.LibEpdSetSentState_IgnoreBool = (int)1;
+}
+
+void LibEpdSetSentState_CMockExpect(UNITY_LINE_TYPE cmock_line, const lib_epd_state_t* state)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetSentState_CALL_INSTANCE));
+  CMOCK_LibEpdSetSentState_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetSentState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetSentState_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetSentState_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetSentState_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetSentState(cmock_call_instance, state);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetSentState_StubWithCallback(CMOCK_LibEpdSetSentState_CALLBACK Callback)
+{
+  Mock.LibEpdSetSentState_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdNoteSent(const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdNoteSent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdNoteSent);
+  cmock_call_instance = (CMOCK_LibEpdNoteSent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdNoteSent_CallInstance);
+  Mock.LibEpdNoteSent_CallInstance = CMock_Guts_MemNext(Mock.LibEpdNoteSent_CallInstance);
+  if (Mock.LibEpdNoteSent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdNoteSent_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdNoteSent_CallbackFunctionPointer(ptr, n, Mock.LibEpdNoteSent_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdNoteSent,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdNoteSent,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdNoteSent(CMOCK_LibEpdNoteSent_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdNoteSent_CMockIgnore(void)
+{
+  Mock.LibEpdNoteSent_IgnoreBool = (int)1;
+}
+
+void LibEpdNoteSent_CMockExpect(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdNoteSent_CALL_INSTANCE));
+  CMOCK_LibEpdNoteSent_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdNoteSent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdNoteSent_CallInstance = CMock_Guts_MemChain(Mock.LibEpdNoteSent_CallInstance, cmock_guts_index);
+  Mock.LibEpdNoteSent_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdNoteSent(cmock_call_instance, ptr, n);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdNoteSent_StubWithCallback(CMOCK_LibEpdNoteSent_CALLBACK Callback)
+{
+  Mock.LibEpdNoteSent_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdClose(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdClose_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdClose);
+  cmock_call_instance = (CMOCK_LibEpdClose_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdClose_CallInstance);
+  Mock.LibEpdClose_CallInstance = CMock_Guts_MemNext(Mock.LibEpdClose_CallInstance);
+  if (Mock.LibEpdClose_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdClose_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdClose_CallbackFunctionPointer(Mock.LibEpdClose_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdClose_CMockIgnore(void)
+{
+  Mock.LibEpdClose_IgnoreBool = (int)1;
+}
+
+void LibEpdClose_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdClose_CALL_INSTANCE));
+  CMOCK_LibEpdClose_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdClose_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdClose_CallInstance = CMock_Guts_MemChain(Mock.LibEpdClose_CallInstance, cmock_guts_index);
+  Mock.LibEpdClose_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdClose_StubWithCallback(CMOCK_LibEpdClose_CALLBACK Callback)
+{
+  Mock.LibEpdClose_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdReset(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdReset_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdReset);
+  cmock_call_instance = (CMOCK_LibEpdReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdReset_CallInstance);
+  Mock.LibEpdReset_CallInstance = CMock_Guts_MemNext(Mock.LibEpdReset_CallInstance);
+  if (Mock.LibEpdReset_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdReset_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdReset_CallbackFunctionPointer(Mock.LibEpdReset_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdReset_CMockIgnore(void)
+{
+  Mock.LibEpdReset_IgnoreBool = (int)1;
+}
+
+void LibEpdReset_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdReset_CALL_INSTANCE));
+  CMOCK_LibEpdReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdReset_CallInstance = CMock_Guts_MemChain(Mock.LibEpdReset_CallInstance, cmock_guts_index);
+  Mock.LibEpdReset_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdReset_StubWithCallback(CMOCK_LibEpdReset_CALLBACK Callback)
+{
+  Mock.LibEpdReset_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdWakeup(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWakeup_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWakeup);
+  cmock_call_instance = (CMOCK_LibEpdWakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWakeup_CallInstance);
+  Mock.LibEpdWakeup_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWakeup_CallInstance);
+  if (Mock.LibEpdWakeup_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdWakeup_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdWakeup_CallbackFunctionPointer(Mock.LibEpdWakeup_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWakeup_CMockIgnore(void)
+{
+  Mock.LibEpdWakeup_IgnoreBool = (int)1;
+}
+
+void LibEpdWakeup_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWakeup_CALL_INSTANCE));
+  CMOCK_LibEpdWakeup_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWakeup_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWakeup_CallInstance, cmock_guts_index);
+  Mock.LibEpdWakeup_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWakeup_StubWithCallback(CMOCK_LibEpdWakeup_CALLBACK Callback)
+{
+  Mock.LibEpdWakeup_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSetWakeupGpio(int gpio)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetWakeupGpio);
+  cmock_call_instance = (CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetWakeupGpio_CallInstance);
+  Mock.LibEpdSetWakeupGpio_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetWakeupGpio_CallInstance);
+  if (Mock.LibEpdSetWakeupGpio_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSetWakeupGpio_FinalReturn;
+    Mock.LibEpdSetWakeupGpio_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSetWakeupGpio_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSetWakeupGpio_CallbackFunctionPointer(gpio, Mock.LibEpdSetWakeupGpio_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetWakeupGpio,CMockString_gpio);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_gpio, gpio, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSetWakeupGpio(CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE* cmock_call_instance, int gpio)
+{
+  cmock_call_instance->Expected_gpio = gpio;
+}
+
+void LibEpdSetWakeupGpio_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE));
+  CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetWakeupGpio_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetWakeupGpio_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetWakeupGpio_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSetWakeupGpio_IgnoreBool = (int)1;
+}
+
+void LibEpdSetWakeupGpio_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int gpio, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE));
+  CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetWakeupGpio_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetWakeupGpio_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetWakeupGpio_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetWakeupGpio_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetWakeupGpio(cmock_call_instance, gpio);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetWakeupGpio_StubWithCallback(CMOCK_LibEpdSetWakeupGpio_CALLBACK Callback)
+{
+  Mock.LibEpdSetWakeupGpio_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdWakeupWired(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWakeupWired_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWakeupWired);
+  cmock_call_instance = (CMOCK_LibEpdWakeupWired_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWakeupWired_CallInstance);
+  Mock.LibEpdWakeupWired_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWakeupWired_CallInstance);
+  if (Mock.LibEpdWakeupWired_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdWakeupWired_FinalReturn;
+    Mock.LibEpdWakeupWired_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdWakeupWired_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdWakeupWired_CallbackFunctionPointer(Mock.LibEpdWakeupWired_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdWakeupWired_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWakeupWired_CALL_INSTANCE));
+  CMOCK_LibEpdWakeupWired_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWakeupWired_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWakeupWired_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWakeupWired_CallInstance, cmock_guts_index);
+  Mock.LibEpdWakeupWired_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdWakeupWired_IgnoreBool = (int)1;
+}
+
+void LibEpdWakeupWired_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWakeupWired_CALL_INSTANCE));
+  CMOCK_LibEpdWakeupWired_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWakeupWired_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWakeupWired_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWakeupWired_CallInstance, cmock_guts_index);
+  Mock.LibEpdWakeupWired_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWakeupWired_StubWithCallback(CMOCK_LibEpdWakeupWired_CALLBACK Callback)
+{
+  Mock.LibEpdWakeupWired_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdHandshake(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdHandshake_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdHandshake);
+  cmock_call_instance = (CMOCK_LibEpdHandshake_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdHandshake_CallInstance);
+  Mock.LibEpdHandshake_CallInstance = CMock_Guts_MemNext(Mock.LibEpdHandshake_CallInstance);
+  if (Mock.LibEpdHandshake_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdHandshake_FinalReturn;
+    Mock.LibEpdHandshake_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdHandshake_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdHandshake_CallbackFunctionPointer(Mock.LibEpdHandshake_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdHandshake_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdHandshake_CALL_INSTANCE));
+  CMOCK_LibEpdHandshake_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdHandshake_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdHandshake_CallInstance = CMock_Guts_MemChain(Mock.LibEpdHandshake_CallInstance, cmock_guts_index);
+  Mock.LibEpdHandshake_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdHandshake_IgnoreBool = (int)1;
+}
+
+void LibEpdHandshake_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdHandshake_CALL_INSTANCE));
+  CMOCK_LibEpdHandshake_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdHandshake_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdHandshake_CallInstance = CMock_Guts_MemChain(Mock.LibEpdHandshake_CallInstance, cmock_guts_index);
+  Mock.LibEpdHandshake_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdHandshake_StubWithCallback(CMOCK_LibEpdHandshake_CALLBACK Callback)
+{
+  Mock.LibEpdHandshake_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdWaitReady(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWaitReady_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWaitReady);
+  cmock_call_instance = (CMOCK_LibEpdWaitReady_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWaitReady_CallInstance);
+  Mock.LibEpdWaitReady_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWaitReady_CallInstance);
+  if (Mock.LibEpdWaitReady_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdWaitReady_FinalReturn;
+    Mock.LibEpdWaitReady_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdWaitReady_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdWaitReady_CallbackFunctionPointer(Mock.LibEpdWaitReady_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdWaitReady_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWaitReady_CALL_INSTANCE));
+  CMOCK_LibEpdWaitReady_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWaitReady_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWaitReady_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWaitReady_CallInstance, cmock_guts_index);
+  Mock.LibEpdWaitReady_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdWaitReady_IgnoreBool = (int)1;
+}
+
+void LibEpdWaitReady_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWaitReady_CALL_INSTANCE));
+  CMOCK_LibEpdWaitReady_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWaitReady_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWaitReady_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWaitReady_CallInstance, cmock_guts_index);
+  Mock.LibEpdWaitReady_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWaitReady_StubWithCallback(CMOCK_LibEpdWaitReady_CALLBACK Callback)
+{
+  Mock.LibEpdWaitReady_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdWaitReadyUs(long timeout_us)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWaitReadyUs);
+  cmock_call_instance = (CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWaitReadyUs_CallInstance);
+  Mock.LibEpdWaitReadyUs_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWaitReadyUs_CallInstance);
+  if (Mock.LibEpdWaitReadyUs_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdWaitReadyUs_FinalReturn;
+    Mock.LibEpdWaitReadyUs_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdWaitReadyUs_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdWaitReadyUs_CallbackFunctionPointer(timeout_us, Mock.LibEpdWaitReadyUs_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWaitReadyUs,CMockString_timeout_us);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_timeout_us, timeout_us, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdWaitReadyUs(CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE* cmock_call_instance, long timeout_us)
+{
+  cmock_call_instance->Expected_timeout_us = timeout_us;
+}
+
+void LibEpdWaitReadyUs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE));
+  CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWaitReadyUs_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWaitReadyUs_CallInstance, cmock_guts_index);
+  Mock.LibEpdWaitReadyUs_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdWaitReadyUs_IgnoreBool = (int)1;
+}
+
+void LibEpdWaitReadyUs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long timeout_us, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE));
+  CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWaitReadyUs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWaitReadyUs_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWaitReadyUs_CallInstance, cmock_guts_index);
+  Mock.LibEpdWaitReadyUs_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdWaitReadyUs(cmock_call_instance, timeout_us);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWaitReadyUs_StubWithCallback(CMOCK_LibEpdWaitReadyUs_CALLBACK Callback)
+{
+  Mock.LibEpdWaitReadyUs_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetBaud(long baud)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetBaud_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetBaud);
+  cmock_call_instance = (CMOCK_LibEpdSetBaud_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetBaud_CallInstance);
+  Mock.LibEpdSetBaud_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetBaud_CallInstance);
+  if (Mock.LibEpdSetBaud_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetBaud_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetBaud_CallbackFunctionPointer(baud, Mock.LibEpdSetBaud_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetBaud,CMockString_baud);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_baud, baud, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetBaud(CMOCK_LibEpdSetBaud_CALL_INSTANCE* cmock_call_instance, long baud)
+{
+  cmock_call_instance->Expected_baud = baud;
+}
+
+void LibEpdSetBaud_CMockIgnore(void)
+{
+  Mock.LibEpdSetBaud_IgnoreBool = (int)1;
+}
+
+void LibEpdSetBaud_CMockExpect(UNITY_LINE_TYPE cmock_line, long baud)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetBaud_CALL_INSTANCE));
+  CMOCK_LibEpdSetBaud_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetBaud_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetBaud_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetBaud_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetBaud_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetBaud(cmock_call_instance, baud);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetBaud_StubWithCallback(CMOCK_LibEpdSetBaud_CALLBACK Callback)
+{
+  Mock.LibEpdSetBaud_CallbackFunctionPointer = Callback;
+}
+
+void lib_epd_read_baud(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_lib_epd_read_baud_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_lib_epd_read_baud);
+  cmock_call_instance = (CMOCK_lib_epd_read_baud_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.lib_epd_read_baud_CallInstance);
+  Mock.lib_epd_read_baud_CallInstance = CMock_Guts_MemNext(Mock.lib_epd_read_baud_CallInstance);
+  if (Mock.lib_epd_read_baud_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.lib_epd_read_baud_CallbackFunctionPointer != NULL)
+  {
+    Mock.lib_epd_read_baud_CallbackFunctionPointer(Mock.lib_epd_read_baud_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void lib_epd_read_baud_CMockIgnore(void)
+{
+  Mock.lib_epd_read_baud_IgnoreBool = (int)1;
+}
+
+void lib_epd_read_baud_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_lib_epd_read_baud_CALL_INSTANCE));
+  CMOCK_lib_epd_read_baud_CALL_INSTANCE* cmock_call_instance = (CMOCK_lib_epd_read_baud_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.lib_epd_read_baud_CallInstance = CMock_Guts_MemChain(Mock.lib_epd_read_baud_CallInstance, cmock_guts_index);
+  Mock.lib_epd_read_baud_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void lib_epd_read_baud_StubWithCallback(CMOCK_lib_epd_read_baud_CALLBACK Callback)
+{
+  Mock.lib_epd_read_baud_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetMemory(unsigned char mode)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetMemory_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetMemory);
+  cmock_call_instance = (CMOCK_LibEpdSetMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetMemory_CallInstance);
+  Mock.LibEpdSetMemory_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetMemory_CallInstance);
+  if (Mock.LibEpdSetMemory_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetMemory_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetMemory_CallbackFunctionPointer(mode, Mock.LibEpdSetMemory_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetMemory,CMockString_mode);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_mode, mode, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetMemory(CMOCK_LibEpdSetMemory_CALL_INSTANCE* cmock_call_instance, unsigned char mode)
+{
+  cmock_call_instance->Expected_mode = mode;
+}
+
+void LibEpdSetMemory_CMockIgnore(void)
+{
+  Mock.LibEpdSetMemory_IgnoreBool = (int)1;
+}
+
+void LibEpdSetMemory_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char mode)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetMemory_CALL_INSTANCE));
+  CMOCK_LibEpdSetMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetMemory_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetMemory_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetMemory_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetMemory(cmock_call_instance, mode);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetMemory_StubWithCallback(CMOCK_LibEpdSetMemory_CALLBACK Callback)
+{
+  Mock.LibEpdSetMemory_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdEnterStopMode(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdEnterStopMode_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdEnterStopMode);
+  cmock_call_instance = (CMOCK_LibEpdEnterStopMode_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdEnterStopMode_CallInstance);
+  Mock.LibEpdEnterStopMode_CallInstance = CMock_Guts_MemNext(Mock.LibEpdEnterStopMode_CallInstance);
+  if (Mock.LibEpdEnterStopMode_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdEnterStopMode_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdEnterStopMode_CallbackFunctionPointer(Mock.LibEpdEnterStopMode_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdEnterStopMode_CMockIgnore(void)
+{
+  Mock.LibEpdEnterStopMode_IgnoreBool = (int)1;
+}
+
+void LibEpdEnterStopMode_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdEnterStopMode_CALL_INSTANCE));
+  CMOCK_LibEpdEnterStopMode_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdEnterStopMode_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdEnterStopMode_CallInstance = CMock_Guts_MemChain(Mock.LibEpdEnterStopMode_CallInstance, cmock_guts_index);
+  Mock.LibEpdEnterStopMode_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdEnterStopMode_StubWithCallback(CMOCK_LibEpdEnterStopMode_CALLBACK Callback)
+{
+  Mock.LibEpdEnterStopMode_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdUpdate(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdUpdate_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdUpdate);
+  cmock_call_instance = (CMOCK_LibEpdUpdate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdUpdate_CallInstance);
+  Mock.LibEpdUpdate_CallInstance = CMock_Guts_MemNext(Mock.LibEpdUpdate_CallInstance);
+  if (Mock.LibEpdUpdate_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdUpdate_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdUpdate_CallbackFunctionPointer(Mock.LibEpdUpdate_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdUpdate_CMockIgnore(void)
+{
+  Mock.LibEpdUpdate_IgnoreBool = (int)1;
+}
+
+void LibEpdUpdate_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdUpdate_CALL_INSTANCE));
+  CMOCK_LibEpdUpdate_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdUpdate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdUpdate_CallInstance = CMock_Guts_MemChain(Mock.LibEpdUpdate_CallInstance, cmock_guts_index);
+  Mock.LibEpdUpdate_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdUpdate_StubWithCallback(CMOCK_LibEpdUpdate_CALLBACK Callback)
+{
+  Mock.LibEpdUpdate_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdScreenRotation(unsigned char mode)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdScreenRotation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdScreenRotation);
+  cmock_call_instance = (CMOCK_LibEpdScreenRotation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdScreenRotation_CallInstance);
+  Mock.LibEpdScreenRotation_CallInstance = CMock_Guts_MemNext(Mock.LibEpdScreenRotation_CallInstance);
+  if (Mock.LibEpdScreenRotation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdScreenRotation_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdScreenRotation_CallbackFunctionPointer(mode, Mock.LibEpdScreenRotation_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdScreenRotation,CMockString_mode);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_mode, mode, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdScreenRotation(CMOCK_LibEpdScreenRotation_CALL_INSTANCE* cmock_call_instance, unsigned char mode)
+{
+  cmock_call_instance->Expected_mode = mode;
+}
+
+void LibEpdScreenRotation_CMockIgnore(void)
+{
+  Mock.LibEpdScreenRotation_IgnoreBool = (int)1;
+}
+
+void LibEpdScreenRotation_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char mode)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdScreenRotation_CALL_INSTANCE));
+  CMOCK_LibEpdScreenRotation_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdScreenRotation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdScreenRotation_CallInstance = CMock_Guts_MemChain(Mock.LibEpdScreenRotation_CallInstance, cmock_guts_index);
+  Mock.LibEpdScreenRotation_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdScreenRotation(cmock_call_instance, mode);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdScreenRotation_StubWithCallback(CMOCK_LibEpdScreenRotation_CALLBACK Callback)
+{
+  Mock.LibEpdScreenRotation_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetOrientation(int orientation)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetOrientation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetOrientation);
+  cmock_call_instance = (CMOCK_LibEpdSetOrientation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetOrientation_CallInstance);
+  Mock.LibEpdSetOrientation_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetOrientation_CallInstance);
+  if (Mock.LibEpdSetOrientation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetOrientation_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetOrientation_CallbackFunctionPointer(orientation, Mock.LibEpdSetOrientation_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetOrientation,CMockString_orientation);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_orientation, orientation, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetOrientation(CMOCK_LibEpdSetOrientation_CALL_INSTANCE* cmock_call_instance, int orientation)
+{
+  cmock_call_instance->Expected_orientation = orientation;
+}
+
+void LibEpdSetOrientation_CMockIgnore(void)
+{
+  Mock.LibEpdSetOrientation_IgnoreBool = (int)1;
+}
+
+void LibEpdSetOrientation_CMockExpect(UNITY_LINE_TYPE cmock_line, int orientation)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetOrientation_CALL_INSTANCE));
+  CMOCK_LibEpdSetOrientation_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetOrientation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetOrientation_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetOrientation_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetOrientation_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetOrientation(cmock_call_instance, orientation);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetOrientation_StubWithCallback(CMOCK_LibEpdSetOrientation_CALLBACK Callback)
+{
+  Mock.LibEpdSetOrientation_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdGetOrientation(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdGetOrientation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdGetOrientation);
+  cmock_call_instance = (CMOCK_LibEpdGetOrientation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdGetOrientation_CallInstance);
+  Mock.LibEpdGetOrientation_CallInstance = CMock_Guts_MemNext(Mock.LibEpdGetOrientation_CallInstance);
+  if (Mock.LibEpdGetOrientation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdGetOrientation_FinalReturn;
+    Mock.LibEpdGetOrientation_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdGetOrientation_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdGetOrientation_CallbackFunctionPointer(Mock.LibEpdGetOrientation_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdGetOrientation_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdGetOrientation_CALL_INSTANCE));
+  CMOCK_LibEpdGetOrientation_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdGetOrientation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdGetOrientation_CallInstance = CMock_Guts_MemChain(Mock.LibEpdGetOrientation_CallInstance, cmock_guts_index);
+  Mock.LibEpdGetOrientation_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdGetOrientation_IgnoreBool = (int)1;
+}
+
+void LibEpdGetOrientation_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdGetOrientation_CALL_INSTANCE));
+  CMOCK_LibEpdGetOrientation_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdGetOrientation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdGetOrientation_CallInstance = CMock_Guts_MemChain(Mock.LibEpdGetOrientation_CallInstance, cmock_guts_index);
+  Mock.LibEpdGetOrientation_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdGetOrientation_StubWithCallback(CMOCK_LibEpdGetOrientation_CALLBACK Callback)
+{
+  Mock.LibEpdGetOrientation_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdTextNeedsHost(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdTextNeedsHost);
+  cmock_call_instance = (CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdTextNeedsHost_CallInstance);
+  Mock.LibEpdTextNeedsHost_CallInstance = CMock_Guts_MemNext(Mock.LibEpdTextNeedsHost_CallInstance);
+  if (Mock.LibEpdTextNeedsHost_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdTextNeedsHost_FinalReturn;
+    Mock.LibEpdTextNeedsHost_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdTextNeedsHost_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdTextNeedsHost_CallbackFunctionPointer(Mock.LibEpdTextNeedsHost_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void LibEpdTextNeedsHost_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE));
+  CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdTextNeedsHost_CallInstance = CMock_Guts_MemChain(Mock.LibEpdTextNeedsHost_CallInstance, cmock_guts_index);
+  Mock.LibEpdTextNeedsHost_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdTextNeedsHost_IgnoreBool = (int)1;
+}
+
+void LibEpdTextNeedsHost_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE));
+  CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdTextNeedsHost_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdTextNeedsHost_CallInstance = CMock_Guts_MemChain(Mock.LibEpdTextNeedsHost_CallInstance, cmock_guts_index);
+  Mock.LibEpdTextNeedsHost_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdTextNeedsHost_StubWithCallback(CMOCK_LibEpdTextNeedsHost_CALLBACK Callback)
+{
+  Mock.LibEpdTextNeedsHost_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdLoadFont(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdLoadFont_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdLoadFont);
+  cmock_call_instance = (CMOCK_LibEpdLoadFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdLoadFont_CallInstance);
+  Mock.LibEpdLoadFont_CallInstance = CMock_Guts_MemNext(Mock.LibEpdLoadFont_CallInstance);
+  if (Mock.LibEpdLoadFont_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdLoadFont_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdLoadFont_CallbackFunctionPointer(Mock.LibEpdLoadFont_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdLoadFont_CMockIgnore(void)
+{
+  Mock.LibEpdLoadFont_IgnoreBool = (int)1;
+}
+
+void LibEpdLoadFont_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdLoadFont_CALL_INSTANCE));
+  CMOCK_LibEpdLoadFont_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdLoadFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdLoadFont_CallInstance = CMock_Guts_MemChain(Mock.LibEpdLoadFont_CallInstance, cmock_guts_index);
+  Mock.LibEpdLoadFont_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdLoadFont_StubWithCallback(CMOCK_LibEpdLoadFont_CALLBACK Callback)
+{
+  Mock.LibEpdLoadFont_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdLoadPic(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdLoadPic_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdLoadPic);
+  cmock_call_instance = (CMOCK_LibEpdLoadPic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdLoadPic_CallInstance);
+  Mock.LibEpdLoadPic_CallInstance = CMock_Guts_MemNext(Mock.LibEpdLoadPic_CallInstance);
+  if (Mock.LibEpdLoadPic_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdLoadPic_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdLoadPic_CallbackFunctionPointer(Mock.LibEpdLoadPic_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdLoadPic_CMockIgnore(void)
+{
+  Mock.LibEpdLoadPic_IgnoreBool = (int)1;
+}
+
+void LibEpdLoadPic_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdLoadPic_CALL_INSTANCE));
+  CMOCK_LibEpdLoadPic_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdLoadPic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdLoadPic_CallInstance = CMock_Guts_MemChain(Mock.LibEpdLoadPic_CallInstance, cmock_guts_index);
+  Mock.LibEpdLoadPic_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdLoadPic_StubWithCallback(CMOCK_LibEpdLoadPic_CALLBACK Callback)
+{
+  Mock.LibEpdLoadPic_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetColor(unsigned char color, unsigned char bkcolor)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetColor_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetColor);
+  cmock_call_instance = (CMOCK_LibEpdSetColor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetColor_CallInstance);
+  Mock.LibEpdSetColor_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetColor_CallInstance);
+  if (Mock.LibEpdSetColor_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetColor_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetColor_CallbackFunctionPointer(color, bkcolor, Mock.LibEpdSetColor_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetColor,CMockString_color);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_color, color, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetColor,CMockString_bkcolor);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_bkcolor, bkcolor, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetColor(CMOCK_LibEpdSetColor_CALL_INSTANCE* cmock_call_instance, unsigned char color, unsigned char bkcolor)
+{
+  cmock_call_instance->Expected_color = color;
+  cmock_call_instance->Expected_bkcolor = bkcolor;
+}
+
+void LibEpdSetColor_CMockIgnore(void)
+{
+  Mock.LibEpdSetColor_IgnoreBool = (int)1;
+}
+
+void LibEpdSetColor_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char color, unsigned char bkcolor)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetColor_CALL_INSTANCE));
+  CMOCK_LibEpdSetColor_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetColor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetColor_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetColor_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetColor_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetColor(cmock_call_instance, color, bkcolor);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetColor_StubWithCallback(CMOCK_LibEpdSetColor_CALLBACK Callback)
+{
+  Mock.LibEpdSetColor_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetEnFont(unsigned char font)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetEnFont_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetEnFont);
+  cmock_call_instance = (CMOCK_LibEpdSetEnFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetEnFont_CallInstance);
+  Mock.LibEpdSetEnFont_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetEnFont_CallInstance);
+  if (Mock.LibEpdSetEnFont_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetEnFont_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetEnFont_CallbackFunctionPointer(font, Mock.LibEpdSetEnFont_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetEnFont,CMockString_font);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_font, font, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetEnFont(CMOCK_LibEpdSetEnFont_CALL_INSTANCE* cmock_call_instance, unsigned char font)
+{
+  cmock_call_instance->Expected_font = font;
+}
+
+void LibEpdSetEnFont_CMockIgnore(void)
+{
+  Mock.LibEpdSetEnFont_IgnoreBool = (int)1;
+}
+
+void LibEpdSetEnFont_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char font)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetEnFont_CALL_INSTANCE));
+  CMOCK_LibEpdSetEnFont_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetEnFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetEnFont_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetEnFont_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetEnFont_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetEnFont(cmock_call_instance, font);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetEnFont_StubWithCallback(CMOCK_LibEpdSetEnFont_CALLBACK Callback)
+{
+  Mock.LibEpdSetEnFont_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetChFont(unsigned char font)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetChFont_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetChFont);
+  cmock_call_instance = (CMOCK_LibEpdSetChFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetChFont_CallInstance);
+  Mock.LibEpdSetChFont_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetChFont_CallInstance);
+  if (Mock.LibEpdSetChFont_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetChFont_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetChFont_CallbackFunctionPointer(font, Mock.LibEpdSetChFont_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetChFont,CMockString_font);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_font, font, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetChFont(CMOCK_LibEpdSetChFont_CALL_INSTANCE* cmock_call_instance, unsigned char font)
+{
+  cmock_call_instance->Expected_font = font;
+}
+
+void LibEpdSetChFont_CMockIgnore(void)
+{
+  Mock.LibEpdSetChFont_IgnoreBool = (int)1;
+}
+
+void LibEpdSetChFont_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char font)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetChFont_CALL_INSTANCE));
+  CMOCK_LibEpdSetChFont_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetChFont_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetChFont_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetChFont_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetChFont_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetChFont(cmock_call_instance, font);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetChFont_StubWithCallback(CMOCK_LibEpdSetChFont_CALLBACK Callback)
+{
+  Mock.LibEpdSetChFont_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDrawPixel(int x0, int y0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDrawPixel_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawPixel);
+  cmock_call_instance = (CMOCK_LibEpdDrawPixel_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDrawPixel_CallInstance);
+  Mock.LibEpdDrawPixel_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDrawPixel_CallInstance);
+  if (Mock.LibEpdDrawPixel_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDrawPixel_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDrawPixel_CallbackFunctionPointer(x0, y0, Mock.LibEpdDrawPixel_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawPixel,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawPixel,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDrawPixel(CMOCK_LibEpdDrawPixel_CALL_INSTANCE* cmock_call_instance, int x0, int y0)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+}
+
+void LibEpdDrawPixel_CMockIgnore(void)
+{
+  Mock.LibEpdDrawPixel_IgnoreBool = (int)1;
+}
+
+void LibEpdDrawPixel_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrawPixel_CALL_INSTANCE));
+  CMOCK_LibEpdDrawPixel_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrawPixel_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrawPixel_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrawPixel_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrawPixel_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDrawPixel(cmock_call_instance, x0, y0);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDrawPixel_StubWithCallback(CMOCK_LibEpdDrawPixel_CALLBACK Callback)
+{
+  Mock.LibEpdDrawPixel_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDrawLine(int x0, int y0, int x1, int y1)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDrawLine_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawLine);
+  cmock_call_instance = (CMOCK_LibEpdDrawLine_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDrawLine_CallInstance);
+  Mock.LibEpdDrawLine_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDrawLine_CallInstance);
+  if (Mock.LibEpdDrawLine_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDrawLine_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDrawLine_CallbackFunctionPointer(x0, y0, x1, y1, Mock.LibEpdDrawLine_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawLine,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawLine,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawLine,CMockString_x1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x1, x1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawLine,CMockString_y1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y1, y1, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDrawLine(CMOCK_LibEpdDrawLine_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int x1, int y1)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_x1 = x1;
+  cmock_call_instance->Expected_y1 = y1;
+}
+
+void LibEpdDrawLine_CMockIgnore(void)
+{
+  Mock.LibEpdDrawLine_IgnoreBool = (int)1;
+}
+
+void LibEpdDrawLine_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrawLine_CALL_INSTANCE));
+  CMOCK_LibEpdDrawLine_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrawLine_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrawLine_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrawLine_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrawLine_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDrawLine(cmock_call_instance, x0, y0, x1, y1);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDrawLine_StubWithCallback(CMOCK_LibEpdDrawLine_CALLBACK Callback)
+{
+  Mock.LibEpdDrawLine_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdFillRect(int x0, int y0, int x1, int y1)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdFillRect_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillRect);
+  cmock_call_instance = (CMOCK_LibEpdFillRect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdFillRect_CallInstance);
+  Mock.LibEpdFillRect_CallInstance = CMock_Guts_MemNext(Mock.LibEpdFillRect_CallInstance);
+  if (Mock.LibEpdFillRect_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdFillRect_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdFillRect_CallbackFunctionPointer(x0, y0, x1, y1, Mock.LibEpdFillRect_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillRect,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillRect,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillRect,CMockString_x1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x1, x1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillRect,CMockString_y1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y1, y1, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdFillRect(CMOCK_LibEpdFillRect_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int x1, int y1)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_x1 = x1;
+  cmock_call_instance->Expected_y1 = y1;
+}
+
+void LibEpdFillRect_CMockIgnore(void)
+{
+  Mock.LibEpdFillRect_IgnoreBool = (int)1;
+}
+
+void LibEpdFillRect_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFillRect_CALL_INSTANCE));
+  CMOCK_LibEpdFillRect_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFillRect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFillRect_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFillRect_CallInstance, cmock_guts_index);
+  Mock.LibEpdFillRect_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdFillRect(cmock_call_instance, x0, y0, x1, y1);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdFillRect_StubWithCallback(CMOCK_LibEpdFillRect_CALLBACK Callback)
+{
+  Mock.LibEpdFillRect_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDrawCircle(int x0, int y0, int r)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDrawCircle_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawCircle);
+  cmock_call_instance = (CMOCK_LibEpdDrawCircle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDrawCircle_CallInstance);
+  Mock.LibEpdDrawCircle_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDrawCircle_CallInstance);
+  if (Mock.LibEpdDrawCircle_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDrawCircle_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDrawCircle_CallbackFunctionPointer(x0, y0, r, Mock.LibEpdDrawCircle_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawCircle,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawCircle,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawCircle,CMockString_r);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_r, r, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDrawCircle(CMOCK_LibEpdDrawCircle_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int r)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_r = r;
+}
+
+void LibEpdDrawCircle_CMockIgnore(void)
+{
+  Mock.LibEpdDrawCircle_IgnoreBool = (int)1;
+}
+
+void LibEpdDrawCircle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int r)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrawCircle_CALL_INSTANCE));
+  CMOCK_LibEpdDrawCircle_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrawCircle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrawCircle_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrawCircle_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrawCircle_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDrawCircle(cmock_call_instance, x0, y0, r);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDrawCircle_StubWithCallback(CMOCK_LibEpdDrawCircle_CALLBACK Callback)
+{
+  Mock.LibEpdDrawCircle_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdFillCircle(int x0, int y0, int r)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdFillCircle_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillCircle);
+  cmock_call_instance = (CMOCK_LibEpdFillCircle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdFillCircle_CallInstance);
+  Mock.LibEpdFillCircle_CallInstance = CMock_Guts_MemNext(Mock.LibEpdFillCircle_CallInstance);
+  if (Mock.LibEpdFillCircle_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdFillCircle_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdFillCircle_CallbackFunctionPointer(x0, y0, r, Mock.LibEpdFillCircle_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillCircle,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillCircle,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillCircle,CMockString_r);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_r, r, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdFillCircle(CMOCK_LibEpdFillCircle_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int r)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_r = r;
+}
+
+void LibEpdFillCircle_CMockIgnore(void)
+{
+  Mock.LibEpdFillCircle_IgnoreBool = (int)1;
+}
+
+void LibEpdFillCircle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int r)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFillCircle_CALL_INSTANCE));
+  CMOCK_LibEpdFillCircle_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFillCircle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFillCircle_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFillCircle_CallInstance, cmock_guts_index);
+  Mock.LibEpdFillCircle_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdFillCircle(cmock_call_instance, x0, y0, r);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdFillCircle_StubWithCallback(CMOCK_LibEpdFillCircle_CALLBACK Callback)
+{
+  Mock.LibEpdFillCircle_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDrawTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDrawTriangle_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDrawTriangle);
+  cmock_call_instance = (CMOCK_LibEpdDrawTriangle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDrawTriangle_CallInstance);
+  Mock.LibEpdDrawTriangle_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDrawTriangle_CallInstance);
+  if (Mock.LibEpdDrawTriangle_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDrawTriangle_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDrawTriangle_CallbackFunctionPointer(x0, y0, x1, y1, x2, y2, Mock.LibEpdDrawTriangle_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_x1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x1, x1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_y1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y1, y1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_x2);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x2, x2, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDrawTriangle,CMockString_y2);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y2, y2, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDrawTriangle(CMOCK_LibEpdDrawTriangle_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_x1 = x1;
+  cmock_call_instance->Expected_y1 = y1;
+  cmock_call_instance->Expected_x2 = x2;
+  cmock_call_instance->Expected_y2 = y2;
+}
+
+void LibEpdDrawTriangle_CMockIgnore(void)
+{
+  Mock.LibEpdDrawTriangle_IgnoreBool = (int)1;
+}
+
+void LibEpdDrawTriangle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDrawTriangle_CALL_INSTANCE));
+  CMOCK_LibEpdDrawTriangle_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDrawTriangle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDrawTriangle_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDrawTriangle_CallInstance, cmock_guts_index);
+  Mock.LibEpdDrawTriangle_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDrawTriangle(cmock_call_instance, x0, y0, x1, y1, x2, y2);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDrawTriangle_StubWithCallback(CMOCK_LibEpdDrawTriangle_CALLBACK Callback)
+{
+  Mock.LibEpdDrawTriangle_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdFillTriangle_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdFillTriangle);
+  cmock_call_instance = (CMOCK_LibEpdFillTriangle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdFillTriangle_CallInstance);
+  Mock.LibEpdFillTriangle_CallInstance = CMock_Guts_MemNext(Mock.LibEpdFillTriangle_CallInstance);
+  if (Mock.LibEpdFillTriangle_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdFillTriangle_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdFillTriangle_CallbackFunctionPointer(x0, y0, x1, y1, x2, y2, Mock.LibEpdFillTriangle_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_x1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x1, x1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_y1);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y1, y1, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_x2);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x2, x2, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFillTriangle,CMockString_y2);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y2, y2, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdFillTriangle(CMOCK_LibEpdFillTriangle_CALL_INSTANCE* cmock_call_instance, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+  cmock_call_instance->Expected_x1 = x1;
+  cmock_call_instance->Expected_y1 = y1;
+  cmock_call_instance->Expected_x2 = x2;
+  cmock_call_instance->Expected_y2 = y2;
+}
+
+void LibEpdFillTriangle_CMockIgnore(void)
+{
+  Mock.LibEpdFillTriangle_IgnoreBool = (int)1;
+}
+
+void LibEpdFillTriangle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFillTriangle_CALL_INSTANCE));
+  CMOCK_LibEpdFillTriangle_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFillTriangle_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFillTriangle_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFillTriangle_CallInstance, cmock_guts_index);
+  Mock.LibEpdFillTriangle_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdFillTriangle(cmock_call_instance, x0, y0, x1, y1, x2, y2);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdFillTriangle_StubWithCallback(CMOCK_LibEpdFillTriangle_CALLBACK Callback)
+{
+  Mock.LibEpdFillTriangle_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdClear(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdClear_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdClear);
+  cmock_call_instance = (CMOCK_LibEpdClear_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdClear_CallInstance);
+  Mock.LibEpdClear_CallInstance = CMock_Guts_MemNext(Mock.LibEpdClear_CallInstance);
+  if (Mock.LibEpdClear_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdClear_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdClear_CallbackFunctionPointer(Mock.LibEpdClear_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdClear_CMockIgnore(void)
+{
+  Mock.LibEpdClear_IgnoreBool = (int)1;
+}
+
+void LibEpdClear_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdClear_CALL_INSTANCE));
+  CMOCK_LibEpdClear_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdClear_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdClear_CallInstance = CMock_Guts_MemChain(Mock.LibEpdClear_CallInstance, cmock_guts_index);
+  Mock.LibEpdClear_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdClear_StubWithCallback(CMOCK_LibEpdClear_CALLBACK Callback)
+{
+  Mock.LibEpdClear_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDispChar(unsigned char ch, int x0, int y0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDispChar_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispChar);
+  cmock_call_instance = (CMOCK_LibEpdDispChar_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDispChar_CallInstance);
+  Mock.LibEpdDispChar_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDispChar_CallInstance);
+  if (Mock.LibEpdDispChar_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDispChar_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDispChar_CallbackFunctionPointer(ch, x0, y0, Mock.LibEpdDispChar_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispChar,CMockString_ch);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ch, ch, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispChar,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispChar,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDispChar(CMOCK_LibEpdDispChar_CALL_INSTANCE* cmock_call_instance, unsigned char ch, int x0, int y0)
+{
+  cmock_call_instance->Expected_ch = ch;
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+}
+
+void LibEpdDispChar_CMockIgnore(void)
+{
+  Mock.LibEpdDispChar_IgnoreBool = (int)1;
+}
+
+void LibEpdDispChar_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char ch, int x0, int y0)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDispChar_CALL_INSTANCE));
+  CMOCK_LibEpdDispChar_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDispChar_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDispChar_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDispChar_CallInstance, cmock_guts_index);
+  Mock.LibEpdDispChar_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDispChar(cmock_call_instance, ch, x0, y0);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDispChar_StubWithCallback(CMOCK_LibEpdDispChar_CALLBACK Callback)
+{
+  Mock.LibEpdDispChar_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDispString(const void* p, int x0, int y0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDispString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispString);
+  cmock_call_instance = (CMOCK_LibEpdDispString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDispString_CallInstance);
+  Mock.LibEpdDispString_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDispString_CallInstance);
+  if (Mock.LibEpdDispString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDispString_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDispString_CallbackFunctionPointer(p, x0, y0, Mock.LibEpdDispString_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispString,CMockString_p);
+    if (cmock_call_instance->Expected_p == NULL)
+      { UNITY_TEST_ASSERT_NULL(p, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_p, p, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispString,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispString,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDispString(CMOCK_LibEpdDispString_CALL_INSTANCE* cmock_call_instance, const void* p, int x0, int y0)
+{
+  cmock_call_instance->Expected_p = (void*)p;
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+}
+
+void LibEpdDispString_CMockIgnore(void)
+{
+  Mock.LibEpdDispString_IgnoreBool = (int)1;
+}
+
+void LibEpdDispString_CMockExpect(UNITY_LINE_TYPE cmock_line, const void* p, int x0, int y0)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDispString_CALL_INSTANCE));
+  CMOCK_LibEpdDispString_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDispString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDispString_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDispString_CallInstance, cmock_guts_index);
+  Mock.LibEpdDispString_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDispString(cmock_call_instance, p, x0, y0);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDispString_StubWithCallback(CMOCK_LibEpdDispString_CALLBACK Callback)
+{
+  Mock.LibEpdDispString_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdDispStringUtf8(const char* utf8, int x0, int y0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispStringUtf8);
+  cmock_call_instance = (CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDispStringUtf8_CallInstance);
+  Mock.LibEpdDispStringUtf8_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDispStringUtf8_CallInstance);
+  if (Mock.LibEpdDispStringUtf8_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdDispStringUtf8_FinalReturn;
+    Mock.LibEpdDispStringUtf8_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdDispStringUtf8_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdDispStringUtf8_CallbackFunctionPointer(utf8, x0, y0, Mock.LibEpdDispStringUtf8_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispStringUtf8,CMockString_utf8);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_utf8, utf8, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispStringUtf8,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispStringUtf8,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdDispStringUtf8(CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE* cmock_call_instance, const char* utf8, int x0, int y0)
+{
+  cmock_call_instance->Expected_utf8 = (char*)utf8;
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+}
+
+void LibEpdDispStringUtf8_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE));
+  CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDispStringUtf8_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDispStringUtf8_CallInstance, cmock_guts_index);
+  Mock.LibEpdDispStringUtf8_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdDispStringUtf8_IgnoreBool = (int)1;
+}
+
+void LibEpdDispStringUtf8_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const char* utf8, int x0, int y0, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE));
+  CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDispStringUtf8_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDispStringUtf8_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDispStringUtf8_CallInstance, cmock_guts_index);
+  Mock.LibEpdDispStringUtf8_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDispStringUtf8(cmock_call_instance, utf8, x0, y0);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDispStringUtf8_StubWithCallback(CMOCK_LibEpdDispStringUtf8_CALLBACK Callback)
+{
+  Mock.LibEpdDispStringUtf8_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdDispBitmap(const void* p, int x0, int y0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdDispBitmap_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdDispBitmap);
+  cmock_call_instance = (CMOCK_LibEpdDispBitmap_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdDispBitmap_CallInstance);
+  Mock.LibEpdDispBitmap_CallInstance = CMock_Guts_MemNext(Mock.LibEpdDispBitmap_CallInstance);
+  if (Mock.LibEpdDispBitmap_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdDispBitmap_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdDispBitmap_CallbackFunctionPointer(p, x0, y0, Mock.LibEpdDispBitmap_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispBitmap,CMockString_p);
+    if (cmock_call_instance->Expected_p == NULL)
+      { UNITY_TEST_ASSERT_NULL(p, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_p, p, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispBitmap,CMockString_x0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_x0, x0, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdDispBitmap,CMockString_y0);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_y0, y0, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdDispBitmap(CMOCK_LibEpdDispBitmap_CALL_INSTANCE* cmock_call_instance, const void* p, int x0, int y0)
+{
+  cmock_call_instance->Expected_p = (void*)p;
+  cmock_call_instance->Expected_x0 = x0;
+  cmock_call_instance->Expected_y0 = y0;
+}
+
+void LibEpdDispBitmap_CMockIgnore(void)
+{
+  Mock.LibEpdDispBitmap_IgnoreBool = (int)1;
+}
+
+void LibEpdDispBitmap_CMockExpect(UNITY_LINE_TYPE cmock_line, const void* p, int x0, int y0)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdDispBitmap_CALL_INSTANCE));
+  CMOCK_LibEpdDispBitmap_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdDispBitmap_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdDispBitmap_CallInstance = CMock_Guts_MemChain(Mock.LibEpdDispBitmap_CallInstance, cmock_guts_index);
+  Mock.LibEpdDispBitmap_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdDispBitmap(cmock_call_instance, p, x0, y0);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdDispBitmap_StubWithCallback(CMOCK_LibEpdDispBitmap_CALLBACK Callback)
+{
+  Mock.LibEpdDispBitmap_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdFrameLen(const unsigned char* ptr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdFrameLen_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdFrameLen);
+  cmock_call_instance = (CMOCK_LibEpdFrameLen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdFrameLen_CallInstance);
+  Mock.LibEpdFrameLen_CallInstance = CMock_Guts_MemNext(Mock.LibEpdFrameLen_CallInstance);
+  if (Mock.LibEpdFrameLen_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdFrameLen_FinalReturn;
+    Mock.LibEpdFrameLen_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdFrameLen_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdFrameLen_CallbackFunctionPointer(ptr, Mock.LibEpdFrameLen_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFrameLen,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdFrameLen(CMOCK_LibEpdFrameLen_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+}
+
+void LibEpdFrameLen_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFrameLen_CALL_INSTANCE));
+  CMOCK_LibEpdFrameLen_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFrameLen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFrameLen_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFrameLen_CallInstance, cmock_guts_index);
+  Mock.LibEpdFrameLen_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdFrameLen_IgnoreBool = (int)1;
+}
+
+void LibEpdFrameLen_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFrameLen_CALL_INSTANCE));
+  CMOCK_LibEpdFrameLen_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFrameLen_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFrameLen_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFrameLen_CallInstance, cmock_guts_index);
+  Mock.LibEpdFrameLen_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdFrameLen(cmock_call_instance, ptr);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdFrameLen_StubWithCallback(CMOCK_LibEpdFrameLen_CALLBACK Callback)
+{
+  Mock.LibEpdFrameLen_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdFrameValid(const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdFrameValid_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdFrameValid);
+  cmock_call_instance = (CMOCK_LibEpdFrameValid_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdFrameValid_CallInstance);
+  Mock.LibEpdFrameValid_CallInstance = CMock_Guts_MemNext(Mock.LibEpdFrameValid_CallInstance);
+  if (Mock.LibEpdFrameValid_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdFrameValid_FinalReturn;
+    Mock.LibEpdFrameValid_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdFrameValid_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdFrameValid_CallbackFunctionPointer(ptr, n, Mock.LibEpdFrameValid_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFrameValid,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdFrameValid,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdFrameValid(CMOCK_LibEpdFrameValid_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdFrameValid_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFrameValid_CALL_INSTANCE));
+  CMOCK_LibEpdFrameValid_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFrameValid_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFrameValid_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFrameValid_CallInstance, cmock_guts_index);
+  Mock.LibEpdFrameValid_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdFrameValid_IgnoreBool = (int)1;
+}
+
+void LibEpdFrameValid_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdFrameValid_CALL_INSTANCE));
+  CMOCK_LibEpdFrameValid_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdFrameValid_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdFrameValid_CallInstance = CMock_Guts_MemChain(Mock.LibEpdFrameValid_CallInstance, cmock_guts_index);
+  Mock.LibEpdFrameValid_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdFrameValid(cmock_call_instance, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdFrameValid_StubWithCallback(CMOCK_LibEpdFrameValid_CALLBACK Callback)
+{
+  Mock.LibEpdFrameValid_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSendFrames(const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSendFrames_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSendFrames);
+  cmock_call_instance = (CMOCK_LibEpdSendFrames_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSendFrames_CallInstance);
+  Mock.LibEpdSendFrames_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSendFrames_CallInstance);
+  if (Mock.LibEpdSendFrames_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSendFrames_FinalReturn;
+    Mock.LibEpdSendFrames_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSendFrames_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSendFrames_CallbackFunctionPointer(ptr, n, Mock.LibEpdSendFrames_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSendFrames,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSendFrames,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSendFrames(CMOCK_LibEpdSendFrames_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdSendFrames_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSendFrames_CALL_INSTANCE));
+  CMOCK_LibEpdSendFrames_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSendFrames_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSendFrames_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSendFrames_CallInstance, cmock_guts_index);
+  Mock.LibEpdSendFrames_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSendFrames_IgnoreBool = (int)1;
+}
+
+void LibEpdSendFrames_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSendFrames_CALL_INSTANCE));
+  CMOCK_LibEpdSendFrames_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSendFrames_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSendFrames_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSendFrames_CallInstance, cmock_guts_index);
+  Mock.LibEpdSendFrames_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSendFrames(cmock_call_instance, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSendFrames_StubWithCallback(CMOCK_LibEpdSendFrames_CALLBACK Callback)
+{
+  Mock.LibEpdSendFrames_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSetLayer(int layer, const lib_epd_layer_t* ops)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSetLayer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSetLayer);
+  cmock_call_instance = (CMOCK_LibEpdSetLayer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSetLayer_CallInstance);
+  Mock.LibEpdSetLayer_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSetLayer_CallInstance);
+  if (Mock.LibEpdSetLayer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSetLayer_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSetLayer_CallbackFunctionPointer(layer, ops, Mock.LibEpdSetLayer_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetLayer,CMockString_layer);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_layer, layer, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSetLayer,CMockString_ops);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_ops), (void*)(ops), sizeof(lib_epd_layer_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSetLayer(CMOCK_LibEpdSetLayer_CALL_INSTANCE* cmock_call_instance, int layer, const lib_epd_layer_t* ops)
+{
+  cmock_call_instance->Expected_layer = layer;
+  cmock_call_instance->Expected_ops = (lib_epd_layer_t*)ops;
+}
+
+void LibEpdSetLayer_CMockIgnore(void)
+{
+  Mock.LibEpdSetLayer_IgnoreBool = (int)1;
+}
+
+void LibEpdSetLayer_CMockExpect(UNITY_LINE_TYPE cmock_line, int layer, const lib_epd_layer_t* ops)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSetLayer_CALL_INSTANCE));
+  CMOCK_LibEpdSetLayer_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSetLayer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSetLayer_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSetLayer_CallInstance, cmock_guts_index);
+  Mock.LibEpdSetLayer_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSetLayer(cmock_call_instance, layer, ops);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSetLayer_StubWithCallback(CMOCK_LibEpdSetLayer_CALLBACK Callback)
+{
+  Mock.LibEpdSetLayer_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdWrite(const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWrite);
+  cmock_call_instance = (CMOCK_LibEpdWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWrite_CallInstance);
+  Mock.LibEpdWrite_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWrite_CallInstance);
+  if (Mock.LibEpdWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdWrite_FinalReturn;
+    Mock.LibEpdWrite_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdWrite_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdWrite_CallbackFunctionPointer(ptr, n, Mock.LibEpdWrite_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWrite,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWrite,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdWrite(CMOCK_LibEpdWrite_CALL_INSTANCE* cmock_call_instance, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWrite_CALL_INSTANCE));
+  CMOCK_LibEpdWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWrite_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWrite_CallInstance, cmock_guts_index);
+  Mock.LibEpdWrite_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdWrite_IgnoreBool = (int)1;
+}
+
+void LibEpdWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWrite_CALL_INSTANCE));
+  CMOCK_LibEpdWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWrite_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWrite_CallInstance, cmock_guts_index);
+  Mock.LibEpdWrite_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdWrite(cmock_call_instance, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWrite_StubWithCallback(CMOCK_LibEpdWrite_CALLBACK Callback)
+{
+  Mock.LibEpdWrite_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdWriteAfter(int layer, const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdWriteAfter_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdWriteAfter);
+  cmock_call_instance = (CMOCK_LibEpdWriteAfter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdWriteAfter_CallInstance);
+  Mock.LibEpdWriteAfter_CallInstance = CMock_Guts_MemNext(Mock.LibEpdWriteAfter_CallInstance);
+  if (Mock.LibEpdWriteAfter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdWriteAfter_FinalReturn;
+    Mock.LibEpdWriteAfter_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdWriteAfter_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdWriteAfter_CallbackFunctionPointer(layer, ptr, n, Mock.LibEpdWriteAfter_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWriteAfter,CMockString_layer);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_layer, layer, cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWriteAfter,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdWriteAfter,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdWriteAfter(CMOCK_LibEpdWriteAfter_CALL_INSTANCE* cmock_call_instance, int layer, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_layer = layer;
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdWriteAfter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWriteAfter_CALL_INSTANCE));
+  CMOCK_LibEpdWriteAfter_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWriteAfter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWriteAfter_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWriteAfter_CallInstance, cmock_guts_index);
+  Mock.LibEpdWriteAfter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdWriteAfter_IgnoreBool = (int)1;
+}
+
+void LibEpdWriteAfter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int layer, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdWriteAfter_CALL_INSTANCE));
+  CMOCK_LibEpdWriteAfter_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdWriteAfter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdWriteAfter_CallInstance = CMock_Guts_MemChain(Mock.LibEpdWriteAfter_CallInstance, cmock_guts_index);
+  Mock.LibEpdWriteAfter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdWriteAfter(cmock_call_instance, layer, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdWriteAfter_StubWithCallback(CMOCK_LibEpdWriteAfter_CALLBACK Callback)
+{
+  Mock.LibEpdWriteAfter_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSceneInit(lib_epd_scene_t* scene)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneInit);
+  cmock_call_instance = (CMOCK_LibEpdSceneInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneInit_CallInstance);
+  Mock.LibEpdSceneInit_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneInit_CallInstance);
+  if (Mock.LibEpdSceneInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSceneInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSceneInit_CallbackFunctionPointer(scene, Mock.LibEpdSceneInit_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneInit,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSceneInit(CMOCK_LibEpdSceneInit_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* scene)
+{
+  cmock_call_instance->Expected_scene = scene;
+}
+
+void LibEpdSceneInit_CMockIgnore(void)
+{
+  Mock.LibEpdSceneInit_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneInit_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneInit_CALL_INSTANCE));
+  CMOCK_LibEpdSceneInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneInit_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneInit_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneInit_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneInit(cmock_call_instance, scene);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneInit_StubWithCallback(CMOCK_LibEpdSceneInit_CALLBACK Callback)
+{
+  Mock.LibEpdSceneInit_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSceneFree(lib_epd_scene_t* scene)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneFree_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneFree);
+  cmock_call_instance = (CMOCK_LibEpdSceneFree_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneFree_CallInstance);
+  Mock.LibEpdSceneFree_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneFree_CallInstance);
+  if (Mock.LibEpdSceneFree_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSceneFree_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSceneFree_CallbackFunctionPointer(scene, Mock.LibEpdSceneFree_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneFree,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSceneFree(CMOCK_LibEpdSceneFree_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* scene)
+{
+  cmock_call_instance->Expected_scene = scene;
+}
+
+void LibEpdSceneFree_CMockIgnore(void)
+{
+  Mock.LibEpdSceneFree_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneFree_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneFree_CALL_INSTANCE));
+  CMOCK_LibEpdSceneFree_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneFree_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneFree_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneFree_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneFree_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneFree(cmock_call_instance, scene);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneFree_StubWithCallback(CMOCK_LibEpdSceneFree_CALLBACK Callback)
+{
+  Mock.LibEpdSceneFree_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSceneReset(lib_epd_scene_t* scene)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneReset_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneReset);
+  cmock_call_instance = (CMOCK_LibEpdSceneReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneReset_CallInstance);
+  Mock.LibEpdSceneReset_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneReset_CallInstance);
+  if (Mock.LibEpdSceneReset_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSceneReset_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSceneReset_CallbackFunctionPointer(scene, Mock.LibEpdSceneReset_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneReset,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSceneReset(CMOCK_LibEpdSceneReset_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* scene)
+{
+  cmock_call_instance->Expected_scene = scene;
+}
+
+void LibEpdSceneReset_CMockIgnore(void)
+{
+  Mock.LibEpdSceneReset_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneReset_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneReset_CALL_INSTANCE));
+  CMOCK_LibEpdSceneReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneReset_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneReset_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneReset_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneReset(cmock_call_instance, scene);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneReset_StubWithCallback(CMOCK_LibEpdSceneReset_CALLBACK Callback)
+{
+  Mock.LibEpdSceneReset_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSceneAppend(lib_epd_scene_t* scene, const unsigned char* ptr, int n)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneAppend_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneAppend);
+  cmock_call_instance = (CMOCK_LibEpdSceneAppend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneAppend_CallInstance);
+  Mock.LibEpdSceneAppend_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneAppend_CallInstance);
+  if (Mock.LibEpdSceneAppend_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSceneAppend_FinalReturn;
+    Mock.LibEpdSceneAppend_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSceneAppend_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSceneAppend_CallbackFunctionPointer(scene, ptr, n, Mock.LibEpdSceneAppend_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneAppend,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneAppend,CMockString_ptr);
+    if (cmock_call_instance->Expected_ptr == NULL)
+      { UNITY_TEST_ASSERT_NULL(ptr, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_ptr, ptr, 1, cmock_line, CMockStringMismatch); }
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneAppend,CMockString_n);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_n, n, cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSceneAppend(CMOCK_LibEpdSceneAppend_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* scene, const unsigned char* ptr, int n)
+{
+  cmock_call_instance->Expected_scene = scene;
+  cmock_call_instance->Expected_ptr = (unsigned char*)ptr;
+  cmock_call_instance->Expected_n = n;
+}
+
+void LibEpdSceneAppend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneAppend_CALL_INSTANCE));
+  CMOCK_LibEpdSceneAppend_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneAppend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneAppend_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneAppend_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneAppend_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSceneAppend_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneAppend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene, const unsigned char* ptr, int n, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneAppend_CALL_INSTANCE));
+  CMOCK_LibEpdSceneAppend_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneAppend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneAppend_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneAppend_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneAppend_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneAppend(cmock_call_instance, scene, ptr, n);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneAppend_StubWithCallback(CMOCK_LibEpdSceneAppend_CALLBACK Callback)
+{
+  Mock.LibEpdSceneAppend_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSceneCopy(lib_epd_scene_t* dst, const lib_epd_scene_t* src)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneCopy_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneCopy);
+  cmock_call_instance = (CMOCK_LibEpdSceneCopy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneCopy_CallInstance);
+  Mock.LibEpdSceneCopy_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneCopy_CallInstance);
+  if (Mock.LibEpdSceneCopy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSceneCopy_FinalReturn;
+    Mock.LibEpdSceneCopy_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSceneCopy_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSceneCopy_CallbackFunctionPointer(dst, src, Mock.LibEpdSceneCopy_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneCopy,CMockString_dst);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_dst), (void*)(dst), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneCopy,CMockString_src);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_src), (void*)(src), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSceneCopy(CMOCK_LibEpdSceneCopy_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* dst, const lib_epd_scene_t* src)
+{
+  cmock_call_instance->Expected_dst = dst;
+  cmock_call_instance->Expected_src = (lib_epd_scene_t*)src;
+}
+
+void LibEpdSceneCopy_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneCopy_CALL_INSTANCE));
+  CMOCK_LibEpdSceneCopy_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneCopy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneCopy_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneCopy_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneCopy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSceneCopy_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneCopy_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* dst, const lib_epd_scene_t* src, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneCopy_CALL_INSTANCE));
+  CMOCK_LibEpdSceneCopy_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneCopy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneCopy_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneCopy_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneCopy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneCopy(cmock_call_instance, dst, src);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneCopy_StubWithCallback(CMOCK_LibEpdSceneCopy_CALLBACK Callback)
+{
+  Mock.LibEpdSceneCopy_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSceneBegin(lib_epd_scene_t* scene)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneBegin_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneBegin);
+  cmock_call_instance = (CMOCK_LibEpdSceneBegin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneBegin_CallInstance);
+  Mock.LibEpdSceneBegin_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneBegin_CallInstance);
+  if (Mock.LibEpdSceneBegin_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSceneBegin_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSceneBegin_CallbackFunctionPointer(scene, Mock.LibEpdSceneBegin_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneBegin,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LibEpdSceneBegin(CMOCK_LibEpdSceneBegin_CALL_INSTANCE* cmock_call_instance, lib_epd_scene_t* scene)
+{
+  cmock_call_instance->Expected_scene = scene;
+}
+
+void LibEpdSceneBegin_CMockIgnore(void)
+{
+  Mock.LibEpdSceneBegin_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneBegin_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneBegin_CALL_INSTANCE));
+  CMOCK_LibEpdSceneBegin_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneBegin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneBegin_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneBegin_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneBegin_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneBegin(cmock_call_instance, scene);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneBegin_StubWithCallback(CMOCK_LibEpdSceneBegin_CALLBACK Callback)
+{
+  Mock.LibEpdSceneBegin_CallbackFunctionPointer = Callback;
+}
+
+void LibEpdSceneEnd(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneEnd_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneEnd);
+  cmock_call_instance = (CMOCK_LibEpdSceneEnd_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneEnd_CallInstance);
+  Mock.LibEpdSceneEnd_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneEnd_CallInstance);
+  if (Mock.LibEpdSceneEnd_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.LibEpdSceneEnd_CallbackFunctionPointer != NULL)
+  {
+    Mock.LibEpdSceneEnd_CallbackFunctionPointer(Mock.LibEpdSceneEnd_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneEnd_CMockIgnore(void)
+{
+  Mock.LibEpdSceneEnd_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneEnd_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneEnd_CALL_INSTANCE));
+  CMOCK_LibEpdSceneEnd_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneEnd_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneEnd_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneEnd_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneEnd_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneEnd_StubWithCallback(CMOCK_LibEpdSceneEnd_CALLBACK Callback)
+{
+  Mock.LibEpdSceneEnd_CallbackFunctionPointer = Callback;
+}
+
+int LibEpdSceneSend(const lib_epd_scene_t* scene)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LibEpdSceneSend_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LibEpdSceneSend);
+  cmock_call_instance = (CMOCK_LibEpdSceneSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LibEpdSceneSend_CallInstance);
+  Mock.LibEpdSceneSend_CallInstance = CMock_Guts_MemNext(Mock.LibEpdSceneSend_CallInstance);
+  if (Mock.LibEpdSceneSend_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LibEpdSceneSend_FinalReturn;
+    Mock.LibEpdSceneSend_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.LibEpdSceneSend_CallbackFunctionPointer != NULL)
+  {
+    return Mock.LibEpdSceneSend_CallbackFunctionPointer(scene, Mock.LibEpdSceneSend_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  {
+    UNITY_SET_DETAILS(CMockString_LibEpdSceneSend,CMockString_scene);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_scene), (void*)(scene), sizeof(lib_epd_scene_t), cmock_line, CMockStringMismatch);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LibEpdSceneSend(CMOCK_LibEpdSceneSend_CALL_INSTANCE* cmock_call_instance, const lib_epd_scene_t* scene)
+{
+  cmock_call_instance->Expected_scene = (lib_epd_scene_t*)scene;
+}
+
+void LibEpdSceneSend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneSend_CALL_INSTANCE));
+  CMOCK_LibEpdSceneSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneSend_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneSend_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneSend_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LibEpdSceneSend_IgnoreBool = (int)1;
+}
+
+void LibEpdSceneSend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const lib_epd_scene_t* scene, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LibEpdSceneSend_CALL_INSTANCE));
+  CMOCK_LibEpdSceneSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_LibEpdSceneSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LibEpdSceneSend_CallInstance = CMock_Guts_MemChain(Mock.LibEpdSceneSend_CallInstance, cmock_guts_index);
+  Mock.LibEpdSceneSend_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  CMockExpectParameters_LibEpdSceneSend(cmock_call_instance, scene);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void LibEpdSceneSend_StubWithCallback(CMOCK_LibEpdSceneSend_CALLBACK Callback)
+{
+  Mock.LibEpdSceneSend_CallbackFunctionPointer = Callback;
+}
+
@@ -0,0 +1,372 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_LIB_EPD_H
+#define _MOCK_LIB_EPD_H
+
+#include "lib_epd.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_lib_epd_Init(void);
+void mock_lib_epd_Destroy(void);
+void mock_lib_epd_Verify(void);
+
+
+
+
+#define LibEpdInit_Ignore() LibEpdInit_CMockIgnore()
+void LibEpdInit_CMockIgnore(void);
+#define LibEpdInit_Expect() LibEpdInit_CMockExpect(__LINE__)
+void LibEpdInit_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdInit_CALLBACK)(int cmock_num_calls);
+void LibEpdInit_StubWithCallback(CMOCK_LibEpdInit_CALLBACK Callback);
+#define LibEpdInitSpeed_IgnoreAndReturn(cmock_retval) LibEpdInitSpeed_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdInitSpeed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdInitSpeed_ExpectAndReturn(speed, cmock_retval) LibEpdInitSpeed_CMockExpectAndReturn(__LINE__, speed, cmock_retval)
+void LibEpdInitSpeed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int speed, int cmock_to_return);
+typedef int (* CMOCK_LibEpdInitSpeed_CALLBACK)(int speed, int cmock_num_calls);
+void LibEpdInitSpeed_StubWithCallback(CMOCK_LibEpdInitSpeed_CALLBACK Callback);
+#define LibEpdInitDev_IgnoreAndReturn(cmock_retval) LibEpdInitDev_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdInitDev_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdInitDev_ExpectAndReturn(dev_name, speed, cmock_retval) LibEpdInitDev_CMockExpectAndReturn(__LINE__, dev_name, speed, cmock_retval)
+void LibEpdInitDev_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const char* dev_name, int speed, int cmock_to_return);
+typedef int (* CMOCK_LibEpdInitDev_CALLBACK)(const char* dev_name, int speed, int cmock_num_calls);
+void LibEpdInitDev_StubWithCallback(CMOCK_LibEpdInitDev_CALLBACK Callback);
+#define LibEpdSetLowLatency_IgnoreAndReturn(cmock_retval) LibEpdSetLowLatency_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSetLowLatency_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSetLowLatency_ExpectAndReturn(on, cmock_retval) LibEpdSetLowLatency_CMockExpectAndReturn(__LINE__, on, cmock_retval)
+void LibEpdSetLowLatency_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int on, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSetLowLatency_CALLBACK)(int on, int cmock_num_calls);
+void LibEpdSetLowLatency_StubWithCallback(CMOCK_LibEpdSetLowLatency_CALLBACK Callback);
+#define LibEpdDrain_IgnoreAndReturn(cmock_retval) LibEpdDrain_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdDrain_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return);
+#define LibEpdDrain_ExpectAndReturn(cmock_retval) LibEpdDrain_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdDrain_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long long cmock_to_return);
+typedef long long (* CMOCK_LibEpdDrain_CALLBACK)(int cmock_num_calls);
+void LibEpdDrain_StubWithCallback(CMOCK_LibEpdDrain_CALLBACK Callback);
+#define LibEpdGetState_Ignore() LibEpdGetState_CMockIgnore()
+void LibEpdGetState_CMockIgnore(void);
+#define LibEpdGetState_Expect(state) LibEpdGetState_CMockExpect(__LINE__, state)
+void LibEpdGetState_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_state_t* state);
+typedef void (* CMOCK_LibEpdGetState_CALLBACK)(lib_epd_state_t* state, int cmock_num_calls);
+void LibEpdGetState_StubWithCallback(CMOCK_LibEpdGetState_CALLBACK Callback);
+#define LibEpdSetState_Ignore() LibEpdSetState_CMockIgnore()
+void LibEpdSetState_CMockIgnore(void);
+#define LibEpdSetState_Expect(state) LibEpdSetState_CMockExpect(__LINE__, state)
+void LibEpdSetState_CMockExpect(UNITY_LINE_TYPE cmock_line, const lib_epd_state_t* state);
+typedef void (* CMOCK_LibEpdSetState_CALLBACK)(const lib_epd_state_t* state, int cmock_num_calls);
+void LibEpdSetState_StubWithCallback(CMOCK_LibEpdSetState_CALLBACK Callback);
+#define LibEpdGetSentState_Ignore() LibEpdGetSentState_CMockIgnore()
+void LibEpdGetSentState_CMockIgnore(void);
+#define LibEpdGetSentState_Expect(state) LibEpdGetSentState_CMockExpect(__LINE__, state)
+void LibEpdGetSentState_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_state_t* state);
+typedef void (* CMOCK_LibEpdGetSentState_CALLBACK)(lib_epd_state_t* state, int cmock_num_calls);
+void LibEpdGetSentState_StubWithCallback(CMOCK_LibEpdGetSentState_CALLBACK Callback);
+#define LibEpdSetSentState_Ignore() LibEpdSetSentState_CMockIgnore()
+void LibEpdSetSentState_CMockIgnore(void);
+#define LibEpdSetSentState_Expect(state) LibEpdSetSentState_CMockExpect(__LINE__, state)
+void LibEpdSetSentState_CMockExpect(UNITY_LINE_TYPE cmock_line, const lib_epd_state_t* state);
+typedef void (* CMOCK_LibEpdSetSentState_CALLBACK)(const lib_epd_state_t* state, int cmock_num_calls);
+void LibEpdSetSentState_StubWithCallback(CMOCK_LibEpdSetSentState_CALLBACK Callback);
+#define LibEpdNoteSent_Ignore() LibEpdNoteSent_CMockIgnore()
+void LibEpdNoteSent_CMockIgnore(void);
+#define LibEpdNoteSent_Expect(ptr, n) LibEpdNoteSent_CMockExpect(__LINE__, ptr, n)
+void LibEpdNoteSent_CMockExpect(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n);
+typedef void (* CMOCK_LibEpdNoteSent_CALLBACK)(const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdNoteSent_StubWithCallback(CMOCK_LibEpdNoteSent_CALLBACK Callback);
+#define LibEpdClose_Ignore() LibEpdClose_CMockIgnore()
+void LibEpdClose_CMockIgnore(void);
+#define LibEpdClose_Expect() LibEpdClose_CMockExpect(__LINE__)
+void LibEpdClose_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdClose_CALLBACK)(int cmock_num_calls);
+void LibEpdClose_StubWithCallback(CMOCK_LibEpdClose_CALLBACK Callback);
+#define LibEpdReset_Ignore() LibEpdReset_CMockIgnore()
+void LibEpdReset_CMockIgnore(void);
+#define LibEpdReset_Expect() LibEpdReset_CMockExpect(__LINE__)
+void LibEpdReset_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdReset_CALLBACK)(int cmock_num_calls);
+void LibEpdReset_StubWithCallback(CMOCK_LibEpdReset_CALLBACK Callback);
+#define LibEpdWakeup_Ignore() LibEpdWakeup_CMockIgnore()
+void LibEpdWakeup_CMockIgnore(void);
+#define LibEpdWakeup_Expect() LibEpdWakeup_CMockExpect(__LINE__)
+void LibEpdWakeup_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdWakeup_CALLBACK)(int cmock_num_calls);
+void LibEpdWakeup_StubWithCallback(CMOCK_LibEpdWakeup_CALLBACK Callback);
+#define LibEpdSetWakeupGpio_IgnoreAndReturn(cmock_retval) LibEpdSetWakeupGpio_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSetWakeupGpio_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSetWakeupGpio_ExpectAndReturn(gpio, cmock_retval) LibEpdSetWakeupGpio_CMockExpectAndReturn(__LINE__, gpio, cmock_retval)
+void LibEpdSetWakeupGpio_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int gpio, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSetWakeupGpio_CALLBACK)(int gpio, int cmock_num_calls);
+void LibEpdSetWakeupGpio_StubWithCallback(CMOCK_LibEpdSetWakeupGpio_CALLBACK Callback);
+#define LibEpdWakeupWired_IgnoreAndReturn(cmock_retval) LibEpdWakeupWired_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdWakeupWired_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdWakeupWired_ExpectAndReturn(cmock_retval) LibEpdWakeupWired_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdWakeupWired_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_LibEpdWakeupWired_CALLBACK)(int cmock_num_calls);
+void LibEpdWakeupWired_StubWithCallback(CMOCK_LibEpdWakeupWired_CALLBACK Callback);
+#define LibEpdHandshake_IgnoreAndReturn(cmock_retval) LibEpdHandshake_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdHandshake_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdHandshake_ExpectAndReturn(cmock_retval) LibEpdHandshake_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdHandshake_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_LibEpdHandshake_CALLBACK)(int cmock_num_calls);
+void LibEpdHandshake_StubWithCallback(CMOCK_LibEpdHandshake_CALLBACK Callback);
+#define LibEpdWaitReady_IgnoreAndReturn(cmock_retval) LibEpdWaitReady_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdWaitReady_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdWaitReady_ExpectAndReturn(cmock_retval) LibEpdWaitReady_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdWaitReady_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_LibEpdWaitReady_CALLBACK)(int cmock_num_calls);
+void LibEpdWaitReady_StubWithCallback(CMOCK_LibEpdWaitReady_CALLBACK Callback);
+#define LibEpdWaitReadyUs_IgnoreAndReturn(cmock_retval) LibEpdWaitReadyUs_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdWaitReadyUs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdWaitReadyUs_ExpectAndReturn(timeout_us, cmock_retval) LibEpdWaitReadyUs_CMockExpectAndReturn(__LINE__, timeout_us, cmock_retval)
+void LibEpdWaitReadyUs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, long timeout_us, int cmock_to_return);
+typedef int (* CMOCK_LibEpdWaitReadyUs_CALLBACK)(long timeout_us, int cmock_num_calls);
+void LibEpdWaitReadyUs_StubWithCallback(CMOCK_LibEpdWaitReadyUs_CALLBACK Callback);
+#define LibEpdSetBaud_Ignore() LibEpdSetBaud_CMockIgnore()
+void LibEpdSetBaud_CMockIgnore(void);
+#define LibEpdSetBaud_Expect(baud) LibEpdSetBaud_CMockExpect(__LINE__, baud)
+void LibEpdSetBaud_CMockExpect(UNITY_LINE_TYPE cmock_line, long baud);
+typedef void (* CMOCK_LibEpdSetBaud_CALLBACK)(long baud, int cmock_num_calls);
+void LibEpdSetBaud_StubWithCallback(CMOCK_LibEpdSetBaud_CALLBACK Callback);
+#define lib_epd_read_baud_Ignore() lib_epd_read_baud_CMockIgnore()
+void lib_epd_read_baud_CMockIgnore(void);
+#define lib_epd_read_baud_Expect() lib_epd_read_baud_CMockExpect(__LINE__)
+void lib_epd_read_baud_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_lib_epd_read_baud_CALLBACK)(int cmock_num_calls);
+void lib_epd_read_baud_StubWithCallback(CMOCK_lib_epd_read_baud_CALLBACK Callback);
+#define LibEpdSetMemory_Ignore() LibEpdSetMemory_CMockIgnore()
+void LibEpdSetMemory_CMockIgnore(void);
+#define LibEpdSetMemory_Expect(mode) LibEpdSetMemory_CMockExpect(__LINE__, mode)
+void LibEpdSetMemory_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char mode);
+typedef void (* CMOCK_LibEpdSetMemory_CALLBACK)(unsigned char mode, int cmock_num_calls);
+void LibEpdSetMemory_StubWithCallback(CMOCK_LibEpdSetMemory_CALLBACK Callback);
+#define LibEpdEnterStopMode_Ignore() LibEpdEnterStopMode_CMockIgnore()
+void LibEpdEnterStopMode_CMockIgnore(void);
+#define LibEpdEnterStopMode_Expect() LibEpdEnterStopMode_CMockExpect(__LINE__)
+void LibEpdEnterStopMode_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdEnterStopMode_CALLBACK)(int cmock_num_calls);
+void LibEpdEnterStopMode_StubWithCallback(CMOCK_LibEpdEnterStopMode_CALLBACK Callback);
+#define LibEpdUpdate_Ignore() LibEpdUpdate_CMockIgnore()
+void LibEpdUpdate_CMockIgnore(void);
+#define LibEpdUpdate_Expect() LibEpdUpdate_CMockExpect(__LINE__)
+void LibEpdUpdate_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdUpdate_CALLBACK)(int cmock_num_calls);
+void LibEpdUpdate_StubWithCallback(CMOCK_LibEpdUpdate_CALLBACK Callback);
+#define LibEpdScreenRotation_Ignore() LibEpdScreenRotation_CMockIgnore()
+void LibEpdScreenRotation_CMockIgnore(void);
+#define LibEpdScreenRotation_Expect(mode) LibEpdScreenRotation_CMockExpect(__LINE__, mode)
+void LibEpdScreenRotation_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char mode);
+typedef void (* CMOCK_LibEpdScreenRotation_CALLBACK)(unsigned char mode, int cmock_num_calls);
+void LibEpdScreenRotation_StubWithCallback(CMOCK_LibEpdScreenRotation_CALLBACK Callback);
+#define LibEpdSetOrientation_Ignore() LibEpdSetOrientation_CMockIgnore()
+void LibEpdSetOrientation_CMockIgnore(void);
+#define LibEpdSetOrientation_Expect(orientation) LibEpdSetOrientation_CMockExpect(__LINE__, orientation)
+void LibEpdSetOrientation_CMockExpect(UNITY_LINE_TYPE cmock_line, int orientation);
+typedef void (* CMOCK_LibEpdSetOrientation_CALLBACK)(int orientation, int cmock_num_calls);
+void LibEpdSetOrientation_StubWithCallback(CMOCK_LibEpdSetOrientation_CALLBACK Callback);
+#define LibEpdGetOrientation_IgnoreAndReturn(cmock_retval) LibEpdGetOrientation_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdGetOrientation_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdGetOrientation_ExpectAndReturn(cmock_retval) LibEpdGetOrientation_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdGetOrientation_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_LibEpdGetOrientation_CALLBACK)(int cmock_num_calls);
+void LibEpdGetOrientation_StubWithCallback(CMOCK_LibEpdGetOrientation_CALLBACK Callback);
+#define LibEpdTextNeedsHost_IgnoreAndReturn(cmock_retval) LibEpdTextNeedsHost_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdTextNeedsHost_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdTextNeedsHost_ExpectAndReturn(cmock_retval) LibEpdTextNeedsHost_CMockExpectAndReturn(__LINE__, cmock_retval)
+void LibEpdTextNeedsHost_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_LibEpdTextNeedsHost_CALLBACK)(int cmock_num_calls);
+void LibEpdTextNeedsHost_StubWithCallback(CMOCK_LibEpdTextNeedsHost_CALLBACK Callback);
+#define LibEpdLoadFont_Ignore() LibEpdLoadFont_CMockIgnore()
+void LibEpdLoadFont_CMockIgnore(void);
+#define LibEpdLoadFont_Expect() LibEpdLoadFont_CMockExpect(__LINE__)
+void LibEpdLoadFont_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdLoadFont_CALLBACK)(int cmock_num_calls);
+void LibEpdLoadFont_StubWithCallback(CMOCK_LibEpdLoadFont_CALLBACK Callback);
+#define LibEpdLoadPic_Ignore() LibEpdLoadPic_CMockIgnore()
+void LibEpdLoadPic_CMockIgnore(void);
+#define LibEpdLoadPic_Expect() LibEpdLoadPic_CMockExpect(__LINE__)
+void LibEpdLoadPic_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdLoadPic_CALLBACK)(int cmock_num_calls);
+void LibEpdLoadPic_StubWithCallback(CMOCK_LibEpdLoadPic_CALLBACK Callback);
+#define LibEpdSetColor_Ignore() LibEpdSetColor_CMockIgnore()
+void LibEpdSetColor_CMockIgnore(void);
+#define LibEpdSetColor_Expect(color, bkcolor) LibEpdSetColor_CMockExpect(__LINE__, color, bkcolor)
+void LibEpdSetColor_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char color, unsigned char bkcolor);
+typedef void (* CMOCK_LibEpdSetColor_CALLBACK)(unsigned char color, unsigned char bkcolor, int cmock_num_calls);
+void LibEpdSetColor_StubWithCallback(CMOCK_LibEpdSetColor_CALLBACK Callback);
+#define LibEpdSetEnFont_Ignore() LibEpdSetEnFont_CMockIgnore()
+void LibEpdSetEnFont_CMockIgnore(void);
+#define LibEpdSetEnFont_Expect(font) LibEpdSetEnFont_CMockExpect(__LINE__, font)
+void LibEpdSetEnFont_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char font);
+typedef void (* CMOCK_LibEpdSetEnFont_CALLBACK)(unsigned char font, int cmock_num_calls);
+void LibEpdSetEnFont_StubWithCallback(CMOCK_LibEpdSetEnFont_CALLBACK Callback);
+#define LibEpdSetChFont_Ignore() LibEpdSetChFont_CMockIgnore()
+void LibEpdSetChFont_CMockIgnore(void);
+#define LibEpdSetChFont_Expect(font) LibEpdSetChFont_CMockExpect(__LINE__, font)
+void LibEpdSetChFont_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char font);
+typedef void (* CMOCK_LibEpdSetChFont_CALLBACK)(unsigned char font, int cmock_num_calls);
+void LibEpdSetChFont_StubWithCallback(CMOCK_LibEpdSetChFont_CALLBACK Callback);
+#define LibEpdDrawPixel_Ignore() LibEpdDrawPixel_CMockIgnore()
+void LibEpdDrawPixel_CMockIgnore(void);
+#define LibEpdDrawPixel_Expect(x0, y0) LibEpdDrawPixel_CMockExpect(__LINE__, x0, y0)
+void LibEpdDrawPixel_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0);
+typedef void (* CMOCK_LibEpdDrawPixel_CALLBACK)(int x0, int y0, int cmock_num_calls);
+void LibEpdDrawPixel_StubWithCallback(CMOCK_LibEpdDrawPixel_CALLBACK Callback);
+#define LibEpdDrawLine_Ignore() LibEpdDrawLine_CMockIgnore()
+void LibEpdDrawLine_CMockIgnore(void);
+#define LibEpdDrawLine_Expect(x0, y0, x1, y1) LibEpdDrawLine_CMockExpect(__LINE__, x0, y0, x1, y1)
+void LibEpdDrawLine_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1);
+typedef void (* CMOCK_LibEpdDrawLine_CALLBACK)(int x0, int y0, int x1, int y1, int cmock_num_calls);
+void LibEpdDrawLine_StubWithCallback(CMOCK_LibEpdDrawLine_CALLBACK Callback);
+#define LibEpdFillRect_Ignore() LibEpdFillRect_CMockIgnore()
+void LibEpdFillRect_CMockIgnore(void);
+#define LibEpdFillRect_Expect(x0, y0, x1, y1) LibEpdFillRect_CMockExpect(__LINE__, x0, y0, x1, y1)
+void LibEpdFillRect_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1);
+typedef void (* CMOCK_LibEpdFillRect_CALLBACK)(int x0, int y0, int x1, int y1, int cmock_num_calls);
+void LibEpdFillRect_StubWithCallback(CMOCK_LibEpdFillRect_CALLBACK Callback);
+#define LibEpdDrawCircle_Ignore() LibEpdDrawCircle_CMockIgnore()
+void LibEpdDrawCircle_CMockIgnore(void);
+#define LibEpdDrawCircle_Expect(x0, y0, r) LibEpdDrawCircle_CMockExpect(__LINE__, x0, y0, r)
+void LibEpdDrawCircle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int r);
+typedef void (* CMOCK_LibEpdDrawCircle_CALLBACK)(int x0, int y0, int r, int cmock_num_calls);
+void LibEpdDrawCircle_StubWithCallback(CMOCK_LibEpdDrawCircle_CALLBACK Callback);
+#define LibEpdFillCircle_Ignore() LibEpdFillCircle_CMockIgnore()
+void LibEpdFillCircle_CMockIgnore(void);
+#define LibEpdFillCircle_Expect(x0, y0, r) LibEpdFillCircle_CMockExpect(__LINE__, x0, y0, r)
+void LibEpdFillCircle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int r);
+typedef void (* CMOCK_LibEpdFillCircle_CALLBACK)(int x0, int y0, int r, int cmock_num_calls);
+void LibEpdFillCircle_StubWithCallback(CMOCK_LibEpdFillCircle_CALLBACK Callback);
+#define LibEpdDrawTriangle_Ignore() LibEpdDrawTriangle_CMockIgnore()
+void LibEpdDrawTriangle_CMockIgnore(void);
+#define LibEpdDrawTriangle_Expect(x0, y0, x1, y1, x2, y2) LibEpdDrawTriangle_CMockExpect(__LINE__, x0, y0, x1, y1, x2, y2)
+void LibEpdDrawTriangle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1, int x2, int y2);
+typedef void (* CMOCK_LibEpdDrawTriangle_CALLBACK)(int x0, int y0, int x1, int y1, int x2, int y2, int cmock_num_calls);
+void LibEpdDrawTriangle_StubWithCallback(CMOCK_LibEpdDrawTriangle_CALLBACK Callback);
+#define LibEpdFillTriangle_Ignore() LibEpdFillTriangle_CMockIgnore()
+void LibEpdFillTriangle_CMockIgnore(void);
+#define LibEpdFillTriangle_Expect(x0, y0, x1, y1, x2, y2) LibEpdFillTriangle_CMockExpect(__LINE__, x0, y0, x1, y1, x2, y2)
+void LibEpdFillTriangle_CMockExpect(UNITY_LINE_TYPE cmock_line, int x0, int y0, int x1, int y1, int x2, int y2);
+typedef void (* CMOCK_LibEpdFillTriangle_CALLBACK)(int x0, int y0, int x1, int y1, int x2, int y2, int cmock_num_calls);
+void LibEpdFillTriangle_StubWithCallback(CMOCK_LibEpdFillTriangle_CALLBACK Callback);
+#define LibEpdClear_Ignore() LibEpdClear_CMockIgnore()
+void LibEpdClear_CMockIgnore(void);
+#define LibEpdClear_Expect() LibEpdClear_CMockExpect(__LINE__)
+void LibEpdClear_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdClear_CALLBACK)(int cmock_num_calls);
+void LibEpdClear_StubWithCallback(CMOCK_LibEpdClear_CALLBACK Callback);
+#define LibEpdDispChar_Ignore() LibEpdDispChar_CMockIgnore()
+void LibEpdDispChar_CMockIgnore(void);
+#define LibEpdDispChar_Expect(ch, x0, y0) LibEpdDispChar_CMockExpect(__LINE__, ch, x0, y0)
+void LibEpdDispChar_CMockExpect(UNITY_LINE_TYPE cmock_line, unsigned char ch, int x0, int y0);
+typedef void (* CMOCK_LibEpdDispChar_CALLBACK)(unsigned char ch, int x0, int y0, int cmock_num_calls);
+void LibEpdDispChar_StubWithCallback(CMOCK_LibEpdDispChar_CALLBACK Callback);
+#define LibEpdDispString_Ignore() LibEpdDispString_CMockIgnore()
+void LibEpdDispString_CMockIgnore(void);
+#define LibEpdDispString_Expect(p, x0, y0) LibEpdDispString_CMockExpect(__LINE__, p, x0, y0)
+void LibEpdDispString_CMockExpect(UNITY_LINE_TYPE cmock_line, const void* p, int x0, int y0);
+typedef void (* CMOCK_LibEpdDispString_CALLBACK)(const void* p, int x0, int y0, int cmock_num_calls);
+void LibEpdDispString_StubWithCallback(CMOCK_LibEpdDispString_CALLBACK Callback);
+#define LibEpdDispStringUtf8_IgnoreAndReturn(cmock_retval) LibEpdDispStringUtf8_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdDispStringUtf8_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdDispStringUtf8_ExpectAndReturn(utf8, x0, y0, cmock_retval) LibEpdDispStringUtf8_CMockExpectAndReturn(__LINE__, utf8, x0, y0, cmock_retval)
+void LibEpdDispStringUtf8_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const char* utf8, int x0, int y0, int cmock_to_return);
+typedef int (* CMOCK_LibEpdDispStringUtf8_CALLBACK)(const char* utf8, int x0, int y0, int cmock_num_calls);
+void LibEpdDispStringUtf8_StubWithCallback(CMOCK_LibEpdDispStringUtf8_CALLBACK Callback);
+#define LibEpdDispBitmap_Ignore() LibEpdDispBitmap_CMockIgnore()
+void LibEpdDispBitmap_CMockIgnore(void);
+#define LibEpdDispBitmap_Expect(p, x0, y0) LibEpdDispBitmap_CMockExpect(__LINE__, p, x0, y0)
+void LibEpdDispBitmap_CMockExpect(UNITY_LINE_TYPE cmock_line, const void* p, int x0, int y0);
+typedef void (* CMOCK_LibEpdDispBitmap_CALLBACK)(const void* p, int x0, int y0, int cmock_num_calls);
+void LibEpdDispBitmap_StubWithCallback(CMOCK_LibEpdDispBitmap_CALLBACK Callback);
+#define LibEpdFrameLen_IgnoreAndReturn(cmock_retval) LibEpdFrameLen_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdFrameLen_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdFrameLen_ExpectAndReturn(ptr, cmock_retval) LibEpdFrameLen_CMockExpectAndReturn(__LINE__, ptr, cmock_retval)
+void LibEpdFrameLen_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int cmock_to_return);
+typedef int (* CMOCK_LibEpdFrameLen_CALLBACK)(const unsigned char* ptr, int cmock_num_calls);
+void LibEpdFrameLen_StubWithCallback(CMOCK_LibEpdFrameLen_CALLBACK Callback);
+#define LibEpdFrameValid_IgnoreAndReturn(cmock_retval) LibEpdFrameValid_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdFrameValid_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdFrameValid_ExpectAndReturn(ptr, n, cmock_retval) LibEpdFrameValid_CMockExpectAndReturn(__LINE__, ptr, n, cmock_retval)
+void LibEpdFrameValid_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_LibEpdFrameValid_CALLBACK)(const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdFrameValid_StubWithCallback(CMOCK_LibEpdFrameValid_CALLBACK Callback);
+#define LibEpdSendFrames_IgnoreAndReturn(cmock_retval) LibEpdSendFrames_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSendFrames_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSendFrames_ExpectAndReturn(ptr, n, cmock_retval) LibEpdSendFrames_CMockExpectAndReturn(__LINE__, ptr, n, cmock_retval)
+void LibEpdSendFrames_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSendFrames_CALLBACK)(const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdSendFrames_StubWithCallback(CMOCK_LibEpdSendFrames_CALLBACK Callback);
+#define LibEpdSetLayer_Ignore() LibEpdSetLayer_CMockIgnore()
+void LibEpdSetLayer_CMockIgnore(void);
+#define LibEpdSetLayer_Expect(layer, ops) LibEpdSetLayer_CMockExpect(__LINE__, layer, ops)
+void LibEpdSetLayer_CMockExpect(UNITY_LINE_TYPE cmock_line, int layer, const lib_epd_layer_t* ops);
+typedef void (* CMOCK_LibEpdSetLayer_CALLBACK)(int layer, const lib_epd_layer_t* ops, int cmock_num_calls);
+void LibEpdSetLayer_StubWithCallback(CMOCK_LibEpdSetLayer_CALLBACK Callback);
+#define LibEpdWrite_IgnoreAndReturn(cmock_retval) LibEpdWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdWrite_ExpectAndReturn(ptr, n, cmock_retval) LibEpdWrite_CMockExpectAndReturn(__LINE__, ptr, n, cmock_retval)
+void LibEpdWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_LibEpdWrite_CALLBACK)(const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdWrite_StubWithCallback(CMOCK_LibEpdWrite_CALLBACK Callback);
+#define LibEpdWriteAfter_IgnoreAndReturn(cmock_retval) LibEpdWriteAfter_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdWriteAfter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdWriteAfter_ExpectAndReturn(layer, ptr, n, cmock_retval) LibEpdWriteAfter_CMockExpectAndReturn(__LINE__, layer, ptr, n, cmock_retval)
+void LibEpdWriteAfter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int layer, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_LibEpdWriteAfter_CALLBACK)(int layer, const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdWriteAfter_StubWithCallback(CMOCK_LibEpdWriteAfter_CALLBACK Callback);
+#define LibEpdSceneInit_Ignore() LibEpdSceneInit_CMockIgnore()
+void LibEpdSceneInit_CMockIgnore(void);
+#define LibEpdSceneInit_Expect(scene) LibEpdSceneInit_CMockExpect(__LINE__, scene)
+void LibEpdSceneInit_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene);
+typedef void (* CMOCK_LibEpdSceneInit_CALLBACK)(lib_epd_scene_t* scene, int cmock_num_calls);
+void LibEpdSceneInit_StubWithCallback(CMOCK_LibEpdSceneInit_CALLBACK Callback);
+#define LibEpdSceneFree_Ignore() LibEpdSceneFree_CMockIgnore()
+void LibEpdSceneFree_CMockIgnore(void);
+#define LibEpdSceneFree_Expect(scene) LibEpdSceneFree_CMockExpect(__LINE__, scene)
+void LibEpdSceneFree_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene);
+typedef void (* CMOCK_LibEpdSceneFree_CALLBACK)(lib_epd_scene_t* scene, int cmock_num_calls);
+void LibEpdSceneFree_StubWithCallback(CMOCK_LibEpdSceneFree_CALLBACK Callback);
+#define LibEpdSceneReset_Ignore() LibEpdSceneReset_CMockIgnore()
+void LibEpdSceneReset_CMockIgnore(void);
+#define LibEpdSceneReset_Expect(scene) LibEpdSceneReset_CMockExpect(__LINE__, scene)
+void LibEpdSceneReset_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene);
+typedef void (* CMOCK_LibEpdSceneReset_CALLBACK)(lib_epd_scene_t* scene, int cmock_num_calls);
+void LibEpdSceneReset_StubWithCallback(CMOCK_LibEpdSceneReset_CALLBACK Callback);
+#define LibEpdSceneAppend_IgnoreAndReturn(cmock_retval) LibEpdSceneAppend_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSceneAppend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSceneAppend_ExpectAndReturn(scene, ptr, n, cmock_retval) LibEpdSceneAppend_CMockExpectAndReturn(__LINE__, scene, ptr, n, cmock_retval)
+void LibEpdSceneAppend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene, const unsigned char* ptr, int n, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSceneAppend_CALLBACK)(lib_epd_scene_t* scene, const unsigned char* ptr, int n, int cmock_num_calls);
+void LibEpdSceneAppend_StubWithCallback(CMOCK_LibEpdSceneAppend_CALLBACK Callback);
+#define LibEpdSceneCopy_IgnoreAndReturn(cmock_retval) LibEpdSceneCopy_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSceneCopy_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSceneCopy_ExpectAndReturn(dst, src, cmock_retval) LibEpdSceneCopy_CMockExpectAndReturn(__LINE__, dst, src, cmock_retval)
+void LibEpdSceneCopy_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* dst, const lib_epd_scene_t* src, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSceneCopy_CALLBACK)(lib_epd_scene_t* dst, const lib_epd_scene_t* src, int cmock_num_calls);
+void LibEpdSceneCopy_StubWithCallback(CMOCK_LibEpdSceneCopy_CALLBACK Callback);
+#define LibEpdSceneBegin_Ignore() LibEpdSceneBegin_CMockIgnore()
+void LibEpdSceneBegin_CMockIgnore(void);
+#define LibEpdSceneBegin_Expect(scene) LibEpdSceneBegin_CMockExpect(__LINE__, scene)
+void LibEpdSceneBegin_CMockExpect(UNITY_LINE_TYPE cmock_line, lib_epd_scene_t* scene);
+typedef void (* CMOCK_LibEpdSceneBegin_CALLBACK)(lib_epd_scene_t* scene, int cmock_num_calls);
+void LibEpdSceneBegin_StubWithCallback(CMOCK_LibEpdSceneBegin_CALLBACK Callback);
+#define LibEpdSceneEnd_Ignore() LibEpdSceneEnd_CMockIgnore()
+void LibEpdSceneEnd_CMockIgnore(void);
+#define LibEpdSceneEnd_Expect() LibEpdSceneEnd_CMockExpect(__LINE__)
+void LibEpdSceneEnd_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_LibEpdSceneEnd_CALLBACK)(int cmock_num_calls);
+void LibEpdSceneEnd_StubWithCallback(CMOCK_LibEpdSceneEnd_CALLBACK Callback);
+#define LibEpdSceneSend_IgnoreAndReturn(cmock_retval) LibEpdSceneSend_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LibEpdSceneSend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define LibEpdSceneSend_ExpectAndReturn(scene, cmock_retval) LibEpdSceneSend_CMockExpectAndReturn(__LINE__, scene, cmock_retval)
+void LibEpdSceneSend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const lib_epd_scene_t* scene, int cmock_to_return);
+typedef int (* CMOCK_LibEpdSceneSend_CALLBACK)(const lib_epd_scene_t* scene, int cmock_num_calls);
+void LibEpdSceneSend_StubWithCallback(CMOCK_LibEpdSceneSend_CALLBACK Callback);
+
+#endif
@@ -0,0 +1,61 @@
+typedef struct
+
+{
+
+    unsigned long writes;
+
+    unsigned long bytes;
+
+    unsigned long drains;
+
+    long drain_us;
+
+    long drain_max_us;
+
+    int serial;
+
+    int low_latency;
+
+} drv_uart_stats_t;
+
+
+
+int DrvUartInit(char *dev_name, int speed, int databits, int stopbits,
+
+        int parity);
+
+int DrvUartOpenPort(char *dev_name, int speed, int databits, int stopbits,
+
+        int parity);
+
+int DrvUartWritePort(int fd, const unsigned char * ptr, int n);
+
+int DrvUartDrainPort(int fd);
+
+void DrvUartFlushPort(int fd);
+
+int DrvUartReadPort(int fd, unsigned char * ptr, int n, long timeout_us);
+
+int DrvUartKill(void);
+
+int DrvUartPutchars(const unsigned char * ptr, int n);
+
+int DrvUartGetChars(unsigned char * ptr);
+
+int DrvUartRead(unsigned char * ptr, int n, long timeout_us);
+
+void DrvUartFlushInput(void);
+
+int DrvUartGetSpeed(void);
+
+int DrvUartBitsPerByte(void);
+
+
+
+int DrvUartSetLowLatency(int on);
+
+int DrvUartOutq(void);
+
+long long DrvUartDrain(void);
+
+void DrvUartGetStats(drv_uart_stats_t * stats);
@@ -0,0 +1,469 @@
+#include "mock_lib_epd.h"
+#include "lib_epd_fb.h"
+#include "common.h"
+#include "unity.h"
+
+
+
+
+
+
+static unsigned char * s_fb;
+
+static int s_colors;
+
+static unsigned char s_drawn[600][800];
+
+
+
+static void _Set(int x, int y, int color)
+
+{
+
+ unsigned char * p = &s_fb[y * (800 / 4) + (x >> 2)];
+
+ int shift = 6 - 2 * (x & 3);
+
+
+
+ *p = (unsigned char) ((*p & ~(0x03 << shift)) | (color << shift));
+
+}
+
+
+
+static void _SetColor(unsigned char color, unsigned char bkcolor, int num_calls)
+
+{
+
+ (void) num_calls;
+
+ UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x00)), (UNITY_INT)(UNITY_INT8 )((color)), (
+
+((void *)0)
+
+), (UNITY_UINT)(23), UNITY_DISPLAY_STYLE_HEX8);
+
+ UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x03)), (UNITY_INT)(UNITY_INT8 )((bkcolor)), (
+
+((void *)0)
+
+), (UNITY_UINT)(24), UNITY_DISPLAY_STYLE_HEX8);
+
+ s_colors++;
+
+}
+
+
+
+static void _DrawPixel(int x, int y, int num_calls)
+
+{
+
+ (void) num_calls;
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((s_drawn[y][x])), (("pixel drawn twice")), (UNITY_UINT)(31), UNITY_DISPLAY_STYLE_INT);
+
+ s_drawn[y][x] = 1;
+
+}
+
+
+
+
+
+static void _FirstCommit(void)
+
+{
+
+ LibEpdSetColor_CMockExpect(38, 0x00, 0x03);
+
+ LibEpdClear_CMockExpect(39);
+
+ LibEpdUpdate_CMockExpect(40);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((LibEpdFbCommit(
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(41), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void setUp(void)
+
+{
+
+ s_fb = LibEpdFbOpen("/epd-fb-test");
+
+ if ((((s_fb)) != 
+
+((void *)0)
+
+)) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(47))));};
+
+ memset(s_fb, 0xFF, ((800 / 4) * 600));
+
+ s_colors = 0;
+
+ memset(s_drawn, 0, sizeof(s_drawn));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+ LibEpdFbClose(1);
+
+}
+
+
+
+void testNothingChangedSendsNothing(void)
+
+{
+
+ lib_epd_fb_stats_t st;
+
+
+
+ _FirstCommit();
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((LibEpdFbCommit(&st))), (
+
+((void *)0)
+
+), (UNITY_UINT)(63), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((st.rows)), (
+
+((void *)0)
+
+), (UNITY_UINT)(64), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((st.spans)), (
+
+((void *)0)
+
+), (UNITY_UINT)(65), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRunOnARowIsALine(void)
+
+{
+
+ lib_epd_fb_stats_t st;
+
+ int x;
+
+
+
+ _FirstCommit();
+
+ for (x = 10; x <= 20; x++)
+
+ {
+
+  _Set(x, 5, 0x00);
+
+ }
+
+ LibEpdSetColor_CMockExpect(78, 0x00, 0x03);
+
+ LibEpdDrawLine_CMockExpect(79, 10, 5, 20, 5);
+
+ LibEpdUpdate_CMockExpect(80);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((LibEpdFbCommit(&st))), (
+
+((void *)0)
+
+), (UNITY_UINT)(81), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.rows)), (
+
+((void *)0)
+
+), (UNITY_UINT)(82), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.words)), (
+
+((void *)0)
+
+), (UNITY_UINT)(83), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((st.spans)), (
+
+((void *)0)
+
+), (UNITY_UINT)(84), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRunsAboveEachOtherMerge(void)
+
+{
+
+ lib_epd_fb_stats_t st;
+
+ int x;
+
+ int y;
+
+
+
+ _FirstCommit();
+
+ for (y = 5; y <= 9; y++)
+
+ {
+
+  for (x = 30; x <= 40; x++)
+
+  {
+
+   _Set(x, y, 0x00);
+
+  }
+
+ }
+
+ _Set(70, 9, 0x00);
+
+ LibEpdSetColor_CMockExpect(102, 0x00, 0x03);
+
+ LibEpdFillRect_CMockExpect(103, 30, 5, 40, 9);
+
+ LibEpdDrawPixel_CMockExpect(104, 70, 9);
+
+ LibEpdUpdate_CMockExpect(105);
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((LibEpdFbCommit(&st))), (
+
+((void *)0)
+
+), (UNITY_UINT)(106), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((st.rows)), (
+
+((void *)0)
+
+), (UNITY_UINT)(107), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((6)), (UNITY_INT)((st.spans)), (
+
+((void *)0)
+
+), (UNITY_UINT)(108), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRunsAreSentColorByColor(void)
+
+{
+
+ lib_epd_fb_stats_t st;
+
+ int x;
+
+
+
+ _FirstCommit();
+
+ for (x = 40; x <= 43; x++)
+
+ {
+
+  _Set(x, 3, 0x02);
+
+  _Set(x, 4, 0x02);
+
+  _Set(x + 4, 3, 0x00);
+
+ }
+
+ LibEpdSetColor_CMockExpect(123, 0x00, 0x03);
+
+ LibEpdDrawLine_CMockExpect(124, 44, 3, 47, 3);
+
+ LibEpdSetColor_CMockExpect(125, 0x02, 0x03);
+
+ LibEpdFillRect_CMockExpect(126, 40, 3, 43, 4);
+
+ LibEpdUpdate_CMockExpect(127);
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((LibEpdFbCommit(&st))), (
+
+((void *)0)
+
+), (UNITY_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((st.spans)), (
+
+((void *)0)
+
+), (UNITY_UINT)(129), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testUnchangedPixelsAreNotRedrawn(void)
+
+{
+
+ int x;
+
+
+
+ _FirstCommit();
+
+ for (x = 100; x <= 110; x++)
+
+ {
+
+  _Set(x, 0, 0x00);
+
+ }
+
+ LibEpdSetColor_CMockIgnore();
+
+ LibEpdDrawLine_CMockIgnore();
+
+ LibEpdUpdate_CMockIgnore();
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((LibEpdFbCommit(
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+
+
+ for (x = 100; x <= 104; x++)
+
+ {
+
+  _Set(x, 0, 0x03);
+
+ }
+
+ LibEpdSetColor_CMockExpect(152, 0x03, 0x03);
+
+ LibEpdDrawLine_CMockExpect(153, 96, 0, 104, 0);
+
+ LibEpdUpdate_CMockExpect(154);
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((LibEpdFbCommit(
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(155), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRectanglesOverTheLimitAreFlushed(void)
+
+{
+
+
+
+ const int rows = 4096 / (800 / 2) + 1;
+
+ int x;
+
+ int y;
+
+
+
+ _FirstCommit();
+
+ for (y = 0; y < 2 * rows; y += 2)
+
+ {
+
+  for (x = 0; x < 800; x += 2)
+
+  {
+
+   _Set(x, y, 0x00);
+
+  }
+
+ }
+
+ LibEpdSetColor_StubWithCallback(_SetColor);
+
+ LibEpdDrawPixel_StubWithCallback(_DrawPixel);
+
+ LibEpdUpdate_CMockExpect(175);
+
+ UnityAssertEqualNumber((UNITY_INT)((rows * (800 / 2))), (UNITY_INT)((LibEpdFbCommit(
+
+((void *)0)
+
+))), (
+
+((void *)0)
+
+), (UNITY_UINT)(176), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((s_colors)), (
+
+((void *)0)
+
+), (UNITY_UINT)(177), UNITY_DISPLAY_STYLE_INT);
+
+
+
+ for (y = 0; y < 600; y++)
+
+ {
+
+  for (x = 0; x < 800; x++)
+
+  {
+
+   UnityAssertEqualNumber((UNITY_INT)((((y < 2 * rows) && ((y & 1) == 0) && ((x & 1) == 0)) ? 1 : 0)), (UNITY_INT)((s_drawn[y][x])), (
+
+  ((void *)0)
+
+  ), (UNITY_UINT)(183), UNITY_DISPLAY_STYLE_INT)
+
+                   ;
+
+  }
+
+ }
+
+}
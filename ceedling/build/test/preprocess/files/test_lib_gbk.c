@@ -0,0 +1,282 @@
+#include "lib_gbk.h"
+#include "common.h"
+#include "unity.h"
+
+
+void setUp(void)
+
+{}
+
+
+
+void tearDown(void)
+
+{}
+
+
+
+void testAsciiIsCopiedAsItIs(void)
+
+{
+
+ const char * text = "A label long enough for the word and vector paths";
+
+ unsigned char gbk[64];
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((strlen(text))), (UNITY_INT)((LibGbkFromUtf8(text, gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(16), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)((text)), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(17));
+
+}
+
+
+
+void testChineseIsConverted(void)
+
+{
+
+ const unsigned char expected[] = { 'a', 0xD6, 0xD0, 0xCE, 0xC4, 0x00 };
+
+ unsigned char gbk[16];
+
+
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((LibGbkFromUtf8("a\xE4\xB8\xAD\xE6\x96\x87", gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(26), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualIntArray(( const void*)((expected)), ( const void*)((gbk)), (UNITY_UINT32)((sizeof(expected))), (
+
+((void *)0)
+
+), (UNITY_UINT)(27), UNITY_DISPLAY_STYLE_UINT8);
+
+ UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0xD6D0)), (UNITY_INT)(UNITY_INT32)((LibGbkFromUnicode(0x4E2D))), (
+
+((void *)0)
+
+), (UNITY_UINT)(28), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void testCutAtCharacterBoundary(void)
+
+{
+
+ unsigned char gbk[8];
+
+
+
+
+
+ memset(gbk, 0x55, sizeof(gbk));
+
+ UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((LibGbkFromUtf8("a\xE4\xB8\xAD\xE6\x96\x87", gbk, 4))), (
+
+((void *)0)
+
+), (UNITY_UINT)(37), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0xD0)), (UNITY_INT)(UNITY_INT8 )((gbk[2])), (
+
+((void *)0)
+
+), (UNITY_UINT)(38), UNITY_DISPLAY_STYLE_HEX8);
+
+ UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x00)), (UNITY_INT)(UNITY_INT8 )((gbk[3])), (
+
+((void *)0)
+
+), (UNITY_UINT)(39), UNITY_DISPLAY_STYLE_HEX8);
+
+
+
+
+
+ memset(gbk, 0x55, sizeof(gbk));
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((LibGbkFromUtf8("a\xE4\xB8\xAD", gbk, 3))), (
+
+((void *)0)
+
+), (UNITY_UINT)(43), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("a")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(44));
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((LibGbkFromUtf8("abc", gbk, 1))), (
+
+((void *)0)
+
+), (UNITY_UINT)(46), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(47));
+
+}
+
+
+
+void testMalformedUtf8IsReplaced(void)
+
+{
+
+ unsigned char gbk[16];
+
+
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((LibGbkFromUtf8("\xE4\xB8" "A", gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(55), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("?A")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(56));
+
+
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((LibGbkFromUtf8("\x80x", gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(59), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("?x")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(60));
+
+
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((LibGbkFromUtf8("\xE4", gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(63), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("?")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(64));
+
+}
+
+
+
+void testCharacterOutsideGbkIsReplaced(void)
+
+{
+
+ unsigned char gbk[16];
+
+
+
+
+
+ UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((LibGbkFromUtf8("\xF0\x9F\x98\x80!", gbk, sizeof(gbk)))), (
+
+((void *)0)
+
+), (UNITY_UINT)(72), UNITY_DISPLAY_STYLE_INT);
+
+ UnityAssertEqualString((const char*)(("?!")), (const char*)(((const char *) gbk)), (
+
+((void *)0)
+
+), (UNITY_UINT)(73));
+
+}
+
+
+
+void testNonAsciiFoundAtEveryOffset(void)
+
+{
+
+ char text[64];
+
+ unsigned char gbk[64];
+
+ int at;
+
+ int start;
+
+
+
+
+
+
+
+ for (start = 0; start < 16; start++)
+
+ {
+
+  for (at = start; at + 3 < 48; at++)
+
+  {
+
+   memset(text, 'a', sizeof(text));
+
+   memcpy(text + at, "\xE4\xB8\xAD", 3);
+
+   text[48] = '\0';
+
+   UnityAssertEqualNumber((UNITY_INT)((48 - start - 1)), (UNITY_INT)((LibGbkFromUtf8(text + start, gbk, sizeof(gbk)))), (
+
+  ((void *)0)
+
+  ), (UNITY_UINT)(92), UNITY_DISPLAY_STYLE_INT);
+
+   UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0xD6)), (UNITY_INT)(UNITY_INT8 )((gbk[at - start])), (
+
+  ((void *)0)
+
+  ), (UNITY_UINT)(93), UNITY_DISPLAY_STYLE_HEX8);
+
+   UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0xD0)), (UNITY_INT)(UNITY_INT8 )((gbk[at - start + 1])), (
+
+  ((void *)0)
+
+  ), (UNITY_UINT)(94), UNITY_DISPLAY_STYLE_HEX8);
+
+  }
+
+ }
+
+}
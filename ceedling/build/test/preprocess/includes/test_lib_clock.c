@@ -0,0 +1,10 @@
+---
+- unity.h
+- common.h
+- lib_clock.h
+- lib_epd.h
+- lib_epd_sched.h
+- lib_gbk.h
+- lib_epd_mem.h
+- mock_drv_uart.h
+- mock_drv_gpio.h
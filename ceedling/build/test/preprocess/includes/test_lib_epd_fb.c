@@ -0,0 +1,5 @@
+---
+- unity.h
+- common.h
+- lib_epd_fb.h
+- mock_lib_epd.h
@@ -0,0 +1,8 @@
+---
+- unity.h
+- common.h
+- lib_clock.h
+- lib_epd_cost.h
+- lib_epd_link.h
+- mock_lib_epd.h
+- mock_drv_uart.h
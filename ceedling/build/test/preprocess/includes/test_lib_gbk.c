@@ -0,0 +1,4 @@
+---
+- unity.h
+- common.h
+- lib_gbk.h
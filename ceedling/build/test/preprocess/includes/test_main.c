@@ -0,0 +1,2 @@
+---
+- unity.h
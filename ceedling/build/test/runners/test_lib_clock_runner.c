@@ -0,0 +1,87 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  CMock_Init(); \
+  UNITY_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+    CMock_Verify(); \
+  } \
+  CMock_Destroy(); \
+  UnityConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "mock_drv_uart.h"
+#include "mock_drv_gpio.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testVirtualSleepAdvancesSimulatedTime(void);
+extern void testResetSleepsInSimulatedTime(void);
+extern void testSchedulerCoalescesInSimulatedTime(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_drv_uart_Init();
+  mock_drv_gpio_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_drv_uart_Verify();
+  mock_drv_gpio_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_drv_uart_Destroy();
+  mock_drv_gpio_Destroy();
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_lib_clock.c");
+  RUN_TEST(testVirtualSleepAdvancesSimulatedTime, 21);
+  RUN_TEST(testResetSleepsInSimulatedTime, 32);
+  RUN_TEST(testSchedulerCoalescesInSimulatedTime, 40);
+
+  CMock_Guts_MemFreeFinal();
+  return (UnityEnd());
+}
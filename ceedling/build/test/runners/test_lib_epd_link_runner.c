@@ -0,0 +1,89 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  CMock_Init(); \
+  UNITY_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+    CMock_Verify(); \
+  } \
+  CMock_Destroy(); \
+  UnityConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "mock_lib_epd.h"
+#include "mock_drv_uart.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testRepliesAcknowledgeTheFramesInOrder(void);
+extern void testErrorResendsOnlyThatFrame(void);
+extern void testLostReplyResendsSinceTheSyncPoint(void);
+extern void testFrameGivenUpAfterAllTries(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_lib_epd_Init();
+  mock_drv_uart_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_lib_epd_Verify();
+  mock_drv_uart_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_lib_epd_Destroy();
+  mock_drv_uart_Destroy();
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_lib_epd_link.c");
+  RUN_TEST(testRepliesAcknowledgeTheFramesInOrder, 144);
+  RUN_TEST(testErrorResendsOnlyThatFrame, 163);
+  RUN_TEST(testLostReplyResendsSinceTheSyncPoint, 183);
+  RUN_TEST(testFrameGivenUpAfterAllTries, 206);
+
+  CMock_Guts_MemFreeFinal();
+  return (UnityEnd());
+}
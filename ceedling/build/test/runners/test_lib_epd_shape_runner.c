@@ -0,0 +1,93 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  CMock_Init(); \
+  UNITY_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+    CMock_Verify(); \
+  } \
+  CMock_Destroy(); \
+  UnityConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "mock_lib_epd.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testConvexPolygonIsAFan(void);
+extern void testConcavePolygonIsCoveredOnce(void);
+extern void testConcavePolygonEitherWinding(void);
+extern void testCollinearVerticesMakeNoDegenerateTriangle(void);
+extern void testConcavePolygonWithCollinearVertices(void);
+extern void testPolygonOnALineSendsNothing(void);
+extern void testPolygonOutOfRangeSendsNothing(void);
+extern void testRoundRectWithLargestArcs(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_lib_epd_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_lib_epd_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_lib_epd_Destroy();
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_lib_epd_shape.c");
+  RUN_TEST(testConvexPolygonIsAFan, 29);
+  RUN_TEST(testConcavePolygonIsCoveredOnce, 38);
+  RUN_TEST(testConcavePolygonEitherWinding, 50);
+  RUN_TEST(testCollinearVerticesMakeNoDegenerateTriangle, 64);
+  RUN_TEST(testConcavePolygonWithCollinearVertices, 76);
+  RUN_TEST(testPolygonOnALineSendsNothing, 88);
+  RUN_TEST(testPolygonOutOfRangeSendsNothing, 96);
+  RUN_TEST(testRoundRectWithLargestArcs, 105);
+
+  CMock_Guts_MemFreeFinal();
+  return (UnityEnd());
+}
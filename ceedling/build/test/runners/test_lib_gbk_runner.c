@@ -0,0 +1,62 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testAsciiIsCopiedAsItIs(void);
+extern void testChineseIsConverted(void);
+extern void testCutAtCharacterBoundary(void);
+extern void testMalformedUtf8IsReplaced(void);
+extern void testCharacterOutsideGbkIsReplaced(void);
+extern void testNonAsciiFoundAtEveryOffset(void);
+
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_lib_gbk.c");
+  RUN_TEST(testAsciiIsCopiedAsItIs, 11);
+  RUN_TEST(testChineseIsConverted, 20);
+  RUN_TEST(testCutAtCharacterBoundary, 31);
+  RUN_TEST(testMalformedUtf8IsReplaced, 50);
+  RUN_TEST(testCharacterOutsideGbkIsReplaced, 67);
+  RUN_TEST(testNonAsciiFoundAtEveryOffset, 76);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,70 @@
+#include "unity.h"
+#include "common.h"
+#include "lib_clock.h"
+#include "lib_epd.h"
+#include "lib_epd_sched.h"
+#include "lib_gbk.h"
+#include "lib_epd_mem.h"
+#include "mock_drv_uart.h"
+#include "mock_drv_gpio.h"
+
+void setUp(void)
+{
+	LibClockUseVirtual();
+}
+
+void tearDown(void)
+{
+	LibClockUseReal();
+}
+
+void testVirtualSleepAdvancesSimulatedTime(void)
+{
+	long long t0 = LibClockNowUs();
+
+	LibClockSleepUs(5000000);
+	TEST_ASSERT_EQUAL_INT64(5000000, LibClockNowUs() - t0);
+
+	LibClockAdvanceUs(250);
+	TEST_ASSERT_EQUAL_INT64(5000250, LibClockNowUs() - t0);
+}
+
+void testResetSleepsInSimulatedTime(void)
+{
+	long long t0 = LibClockNowUs();
+
+	LibEpdReset();
+	TEST_ASSERT_EQUAL_INT64(3000510, LibClockNowUs() - t0);
+}
+
+void testSchedulerCoalescesInSimulatedTime(void)
+{
+	lib_epd_sched_stats_t stats;
+
+	DrvUartPutchars_IgnoreAndReturn(9);
+	LibEpdSchedInit(100, 1000, 2000);
+
+	LibEpdSchedRequest();
+	LibClockAdvanceUs(50000);
+	LibEpdSchedRequest();
+	LibClockAdvanceUs(50000);
+	LibEpdSchedRequest();
+	TEST_ASSERT_FALSE(LibEpdSchedPoll());
+
+	LibClockAdvanceUs(100000);
+	TEST_ASSERT_TRUE(LibEpdSchedPoll());
+	TEST_ASSERT_EQUAL(-1, LibEpdSchedNextDue());
+
+	/* The next refresh waits for the minimum interval, flushing sleeps it off */
+	LibEpdSchedRequest();
+	LibClockAdvanceUs(150000);
+	TEST_ASSERT_FALSE(LibEpdSchedPoll());
+	TEST_ASSERT_EQUAL(1850, LibEpdSchedNextDue());
+	LibEpdSchedFlush();
+	TEST_ASSERT_EQUAL(-1, LibEpdSchedNextDue());
+
+	LibEpdSchedGetStats(&stats);
+	TEST_ASSERT_EQUAL(4, stats.requests);
+	TEST_ASSERT_EQUAL(2, stats.refreshes);
+	LibEpdSchedClose();
+}
@@ -0,0 +1,187 @@
+#include "unity.h"
+#include "common.h"
+#include "lib_epd_fb.h"
+#include "mock_lib_epd.h"
+
+#define FB_TEST_NAME	"/epd-fb-test"
+
+static unsigned char * s_fb;
+static int s_colors;			/* LibEpdSetColor() calls */
+static unsigned char s_drawn[EPD_HEIGHT][EPD_WIDTH];
+
+static void _Set(int x, int y, int color)
+{
+	unsigned char * p = &s_fb[y * EPD_FB_STRIDE + (x >> 2)];
+	int shift = 6 - 2 * (x & 3);
+
+	*p = (unsigned char) ((*p & ~(0x03 << shift)) | (color << shift));
+}
+
+static void _SetColor(unsigned char color, unsigned char bkcolor, int num_calls)
+{
+	(void) num_calls;
+	TEST_ASSERT_EQUAL_HEX8(BLACK, color);
+	TEST_ASSERT_EQUAL_HEX8(WHITE, bkcolor);
+	s_colors++;
+}
+
+static void _DrawPixel(int x, int y, int num_calls)
+{
+	(void) num_calls;
+	TEST_ASSERT_EQUAL_MESSAGE(0, s_drawn[y][x], "pixel drawn twice");
+	s_drawn[y][x] = 1;
+}
+
+/* The first commit clears the screen, nothing else to draw on a white framebuffer */
+static void _FirstCommit(void)
+{
+	LibEpdSetColor_Expect(BLACK, WHITE);
+	LibEpdClear_Expect();
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(0, LibEpdFbCommit(NULL));
+}
+
+void setUp(void)
+{
+	s_fb = LibEpdFbOpen(FB_TEST_NAME);
+	TEST_ASSERT_NOT_NULL(s_fb);
+	memset(s_fb, 0xFF, EPD_FB_BYTES);
+	s_colors = 0;
+	memset(s_drawn, 0, sizeof(s_drawn));
+}
+
+void tearDown(void)
+{
+	LibEpdFbClose(TRUE);
+}
+
+void testNothingChangedSendsNothing(void)
+{
+	lib_epd_fb_stats_t st;
+
+	_FirstCommit();
+	TEST_ASSERT_EQUAL(0, LibEpdFbCommit(&st));
+	TEST_ASSERT_EQUAL(0, st.rows);
+	TEST_ASSERT_EQUAL(0, st.spans);
+}
+
+void testRunOnARowIsALine(void)
+{
+	lib_epd_fb_stats_t st;
+	int x;
+
+	_FirstCommit();
+	for (x = 10; x <= 20; x++)
+	{
+		_Set(x, 5, BLACK);
+	}
+	LibEpdSetColor_Expect(BLACK, WHITE);
+	LibEpdDrawLine_Expect(10, 5, 20, 5);
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(1, LibEpdFbCommit(&st));
+	TEST_ASSERT_EQUAL(1, st.rows);
+	TEST_ASSERT_EQUAL(1, st.words);
+	TEST_ASSERT_EQUAL(1, st.spans);
+}
+
+void testRunsAboveEachOtherMerge(void)
+{
+	lib_epd_fb_stats_t st;
+	int x;
+	int y;
+
+	_FirstCommit();
+	for (y = 5; y <= 9; y++)
+	{
+		for (x = 30; x <= 40; x++)
+		{
+			_Set(x, y, BLACK);
+		}
+	}
+	_Set(70, 9, BLACK);
+	LibEpdSetColor_Expect(BLACK, WHITE);
+	LibEpdFillRect_Expect(30, 5, 40, 9);
+	LibEpdDrawPixel_Expect(70, 9);
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(2, LibEpdFbCommit(&st));
+	TEST_ASSERT_EQUAL(5, st.rows);
+	TEST_ASSERT_EQUAL(6, st.spans);
+}
+
+void testRunsAreSentColorByColor(void)
+{
+	lib_epd_fb_stats_t st;
+	int x;
+
+	_FirstCommit();
+	for (x = 40; x <= 43; x++)
+	{
+		_Set(x, 3, GRAY);
+		_Set(x, 4, GRAY);
+		_Set(x + 4, 3, BLACK);
+	}
+	LibEpdSetColor_Expect(BLACK, WHITE);
+	LibEpdDrawLine_Expect(44, 3, 47, 3);
+	LibEpdSetColor_Expect(GRAY, WHITE);
+	LibEpdFillRect_Expect(40, 3, 43, 4);
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(2, LibEpdFbCommit(&st));
+	TEST_ASSERT_EQUAL(3, st.spans);
+}
+
+void testUnchangedPixelsAreNotRedrawn(void)
+{
+	int x;
+
+	_FirstCommit();
+	for (x = 100; x <= 110; x++)
+	{
+		_Set(x, 0, BLACK);
+	}
+	LibEpdSetColor_Ignore();
+	LibEpdDrawLine_Ignore();
+	LibEpdUpdate_Ignore();
+	TEST_ASSERT_EQUAL(1, LibEpdFbCommit(NULL));
+
+	/* Back to white on the left, the black on the right stays as it is. The white run takes
+	 * in the white pixels before it from the start of the word (96) */
+	for (x = 100; x <= 104; x++)
+	{
+		_Set(x, 0, WHITE);
+	}
+	LibEpdSetColor_Expect(WHITE, WHITE);
+	LibEpdDrawLine_Expect(96, 0, 104, 0);
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(1, LibEpdFbCommit(NULL));
+}
+
+void testRectanglesOverTheLimitAreFlushed(void)
+{
+	/* Lone pixels on every other row, more than EPD_FB_RECTS_MAX of them */
+	const int rows = EPD_FB_RECTS_MAX / (EPD_WIDTH / 2) + 1;
+	int x;
+	int y;
+
+	_FirstCommit();
+	for (y = 0; y < 2 * rows; y += 2)
+	{
+		for (x = 0; x < EPD_WIDTH; x += 2)
+		{
+			_Set(x, y, BLACK);
+		}
+	}
+	LibEpdSetColor_StubWithCallback(_SetColor);
+	LibEpdDrawPixel_StubWithCallback(_DrawPixel);
+	LibEpdUpdate_Expect();
+	TEST_ASSERT_EQUAL(rows * (EPD_WIDTH / 2), LibEpdFbCommit(NULL));
+	TEST_ASSERT_EQUAL(2, s_colors);
+
+	for (y = 0; y < EPD_HEIGHT; y++)
+	{
+		for (x = 0; x < EPD_WIDTH; x++)
+		{
+			TEST_ASSERT_EQUAL(((y < 2 * rows) && ((y & 1) == 0) && ((x & 1) == 0)) ? 1 : 0,
+					s_drawn[y][x]);
+		}
+	}
+}
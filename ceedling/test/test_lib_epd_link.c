@@ -0,0 +1,220 @@
+#include "unity.h"
+#include "common.h"
+#include "lib_clock.h"
+#include "lib_epd_cost.h"
+#include "lib_epd_link.h"
+#include "mock_lib_epd.h"
+#include "mock_drv_uart.h"
+
+#define RECT_LEN		17
+#define FRAMES_MAX		64
+
+/* Reply of the simulated e-paper to a send of a frame */
+#define REPLY_OK		0
+#define REPLY_ERROR		1
+
+static int s_sends[FRAMES_MAX];		/* Sends of each frame, by id */
+static int s_errors_left[FRAMES_MAX];	/* Sends still answered "Error" */
+static int s_drops_left[FRAMES_MAX];	/* Sends whose reply is still lost */
+static int s_wire[4 * FRAMES_MAX];		/* Replies on their way back */
+static int s_wire_head;
+static int s_wire_tail;
+static int s_resyncs;
+
+/* Filled rectangle whose x0 is the id of the frame */
+static void _Rect(unsigned char * f, int id)
+{
+	int i;
+
+	memset(f, 0, RECT_LEN);
+	f[0] = START;
+	f[2] = RECT_LEN;
+	f[3] = CMD_FILL_RECT;
+	f[5] = (unsigned char) id;
+	f[9] = 10;
+	f[11] = 10;
+	f[12] = END_0;
+	f[13] = END_1;
+	f[14] = END_2;
+	f[15] = END_3;
+	for (i = 0; i < RECT_LEN - 1; i++)
+	{
+		f[RECT_LEN - 1] ^= f[i];
+	}
+}
+
+static int _FrameLen(const unsigned char * ptr, int num_calls)
+{
+	(void) num_calls;
+	return (ptr[1] << 8) | ptr[2];
+}
+
+/* The e-paper takes a frame and queues its reply */
+static int _WriteAfter(int layer, const unsigned char * ptr, int n, int num_calls)
+{
+	int id = ptr[5];
+
+	(void) num_calls;
+	TEST_ASSERT_EQUAL(EPD_LAYER_LINK, layer);
+	TEST_ASSERT_EQUAL(RECT_LEN, n);
+	s_sends[id]++;
+	if (s_drops_left[id] > 0)
+	{
+		s_drops_left[id]--;
+		return n;
+	}
+	if (s_errors_left[id] > 0)
+	{
+		s_errors_left[id]--;
+		s_wire[s_wire_tail++] = REPLY_ERROR;
+	}
+	else
+	{
+		s_wire[s_wire_tail++] = REPLY_OK;
+	}
+	return n;
+}
+
+/* One reply per read, 1 ms after the last one. The whole timeout passes when none is left */
+static int _Read(unsigned char * ptr, int n, long timeout_us, int num_calls)
+{
+	(void) num_calls;
+	TEST_ASSERT_TRUE(n >= 5);
+	if (s_wire_head == s_wire_tail)
+	{
+		LibClockAdvanceUs(timeout_us);
+		return 0;
+	}
+	LibClockAdvanceUs(1000);
+	if (s_wire[s_wire_head++] == REPLY_ERROR)
+	{
+		memcpy(ptr, "Error", 5);
+		return 5;
+	}
+	memcpy(ptr, "OK", 2);
+	return 2;
+}
+
+static void _FlushInput(int num_calls)
+{
+	(void) num_calls;
+	s_resyncs++;
+}
+
+/* Write frames 0 to n - 1, one call each */
+static void _WriteRects(int n)
+{
+	unsigned char f[RECT_LEN];
+	int id;
+
+	for (id = 0; id < n; id++)
+	{
+		_Rect(f, id);
+		TEST_ASSERT_EQUAL(RECT_LEN, LibEpdLinkWrite(f, RECT_LEN));
+	}
+}
+
+void setUp(void)
+{
+	LibClockUseVirtual();
+	memset(s_sends, 0, sizeof(s_sends));
+	memset(s_errors_left, 0, sizeof(s_errors_left));
+	memset(s_drops_left, 0, sizeof(s_drops_left));
+	s_wire_head = 0;
+	s_wire_tail = 0;
+	s_resyncs = 0;
+
+	LibEpdFrameLen_StubWithCallback(_FrameLen);
+	LibEpdWriteAfter_StubWithCallback(_WriteAfter);
+	LibEpdSetLayer_Ignore();
+	DrvUartRead_StubWithCallback(_Read);
+	DrvUartFlushInput_StubWithCallback(_FlushInput);
+	DrvUartBitsPerByte_IgnoreAndReturn(10);
+	DrvUartGetSpeed_IgnoreAndReturn(115200);
+	LibEpdLinkOpen(8);
+	s_resyncs = 0;		/* The flush of the open is no resync */
+}
+
+void tearDown(void)
+{
+	LibEpdLinkClose();
+	LibClockUseReal();
+}
+
+void testRepliesAcknowledgeTheFramesInOrder(void)
+{
+	lib_epd_link_stats_t st;
+	int id;
+
+	_WriteRects(20);
+	TEST_ASSERT_TRUE(LibEpdLinkFlush());
+	for (id = 0; id < 20; id++)
+	{
+		TEST_ASSERT_EQUAL(1, s_sends[id]);
+	}
+	LibEpdLinkGetStats(&st);
+	TEST_ASSERT_EQUAL(20, st.frames);
+	TEST_ASSERT_EQUAL(0, st.resent);
+	TEST_ASSERT_EQUAL(0, s_resyncs);
+	/* A window worth of "OK" in a row grows the window */
+	TEST_ASSERT_TRUE(st.window > 4);
+}
+
+void testErrorResendsOnlyThatFrame(void)
+{
+	lib_epd_link_stats_t st;
+	int id;
+
+	s_errors_left[5] = 1;
+	_WriteRects(12);
+	TEST_ASSERT_TRUE(LibEpdLinkFlush());
+	for (id = 0; id < 12; id++)
+	{
+		TEST_ASSERT_EQUAL((id == 5) ? 2 : 1, s_sends[id]);
+	}
+	LibEpdLinkGetStats(&st);
+	TEST_ASSERT_EQUAL(1, st.errors);
+	TEST_ASSERT_EQUAL(1, st.resent);
+	TEST_ASSERT_EQUAL(12, st.frames);
+	TEST_ASSERT_EQUAL(0, st.timeouts);
+	TEST_ASSERT_EQUAL(0, s_resyncs);
+}
+
+void testLostReplyResendsSinceTheSyncPoint(void)
+{
+	lib_epd_link_stats_t st;
+	int id;
+
+	/* The replies after the lost one are taken for the frames before them, until the last
+	 * frame in flight times out: everything since the sync point goes again */
+	s_drops_left[2] = 1;
+	_WriteRects(6);
+	TEST_ASSERT_TRUE(LibEpdLinkFlush());
+	for (id = 0; id < 6; id++)
+	{
+		TEST_ASSERT_TRUE(s_sends[id] >= 1);
+	}
+	TEST_ASSERT_EQUAL(2, s_sends[2]);
+	TEST_ASSERT_TRUE(s_resyncs >= 1);
+	LibEpdLinkGetStats(&st);
+	TEST_ASSERT_TRUE(st.timeouts >= 1);
+	TEST_ASSERT_TRUE(st.resent >= 1);
+	TEST_ASSERT_EQUAL(0, st.lost);
+	TEST_ASSERT_EQUAL(0, s_wire_tail - s_wire_head);
+}
+
+void testFrameGivenUpAfterAllTries(void)
+{
+	lib_epd_link_stats_t st;
+
+	s_errors_left[1] = EPD_LINK_TRIES;
+	_WriteRects(3);
+	TEST_ASSERT_FALSE(LibEpdLinkFlush());
+	TEST_ASSERT_EQUAL(EPD_LINK_TRIES, s_sends[1]);
+	LibEpdLinkGetStats(&st);
+	TEST_ASSERT_EQUAL(1, st.lost);
+	TEST_ASSERT_EQUAL(2, st.frames);
+
+	/* Reported once */
+	TEST_ASSERT_TRUE(LibEpdLinkFlush());
+}
@@ -0,0 +1,110 @@
+#include "unity.h"
+#include "common.h"
+#include "lib_epd_shape.h"
+#include "mock_lib_epd.h"
+
+static long s_area2;        /* Twice the area of the triangles sent */
+static int s_triangles;
+
+static void _FillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, int num_calls)
+{
+	long cross = (long) (x1 - x0) * (y2 - y0) - (long) (y1 - y0) * (x2 - x0);
+
+	(void) num_calls;
+	TEST_ASSERT_TRUE_MESSAGE(cross != 0, "degenerate triangle");
+	s_area2 += (cross > 0) ? cross : -cross;
+	s_triangles++;
+}
+
+void setUp(void)
+{
+	s_area2 = 0;
+	s_triangles = 0;
+	LibEpdFillTriangle_StubWithCallback(_FillTriangle);
+}
+
+void tearDown(void)
+{}
+
+void testConvexPolygonIsAFan(void)
+{
+	const int xy[] = { 0, 0, 40, 0, 50, 30, 20, 50, -10, 30 };
+
+	TEST_ASSERT_EQUAL(3, LibEpdFillPolygon(xy, 5, NULL));
+	TEST_ASSERT_EQUAL(3, s_triangles);
+	TEST_ASSERT_EQUAL(2 * 2100, s_area2);
+}
+
+void testConcavePolygonIsCoveredOnce(void)
+{
+	/* L shape, the reflex vertex at (10, 10) */
+	const int xy[] = { 0, 0, 20, 0, 20, 10, 10, 10, 10, 20, 0, 20 };
+	lib_epd_shape_stats_t stats;
+
+	TEST_ASSERT_EQUAL(4, LibEpdFillPolygon(xy, 6, &stats));
+	TEST_ASSERT_EQUAL(4, stats.frames);
+	/* Triangles of a simple polygon never overlap, so their areas add up to its own */
+	TEST_ASSERT_EQUAL(2 * 300, s_area2);
+}
+
+void testConcavePolygonEitherWinding(void)
+{
+	/* Arrow pointing right, given clockwise then counterclockwise */
+	const int cw[] = { 0, 10, 30, 10, 30, 0, 50, 20, 30, 40, 30, 30, 0, 30 };
+	const int ccw[] = { 0, 30, 30, 30, 30, 40, 50, 20, 30, 0, 30, 10, 0, 10 };
+
+	TEST_ASSERT_EQUAL(5, LibEpdFillPolygon(cw, 7, NULL));
+	TEST_ASSERT_EQUAL(2 * 1000, s_area2);
+
+	s_area2 = 0;
+	TEST_ASSERT_EQUAL(5, LibEpdFillPolygon(ccw, 7, NULL));
+	TEST_ASSERT_EQUAL(2 * 1000, s_area2);
+}
+
+void testCollinearVerticesMakeNoDegenerateTriangle(void)
+{
+	/* Square with an extra vertex in the middle of two sides */
+	const int xy[] = { 0, 0, 10, 0, 20, 0, 20, 20, 0, 20, 0, 10 };
+	int frames;
+
+	frames = LibEpdFillPolygon(xy, 6, NULL);
+	TEST_ASSERT_TRUE(frames <= 6 - 2);
+	TEST_ASSERT_EQUAL(frames, s_triangles);
+	TEST_ASSERT_EQUAL(2 * 400, s_area2);
+}
+
+void testConcavePolygonWithCollinearVertices(void)
+{
+	/* U shape, the bottom and the inner sides cut by collinear vertices */
+	const int xy[] = { 0, 0, 10, 0, 10, 20, 10, 30, 20, 30, 20, 0, 30, 0, 30, 40, 15, 40, 0, 40 };
+	int frames;
+
+	frames = LibEpdFillPolygon(xy, 10, NULL);
+	TEST_ASSERT_TRUE(frames <= 10 - 2);
+	TEST_ASSERT_EQUAL(frames, s_triangles);
+	TEST_ASSERT_EQUAL(2 * 900, s_area2);
+}
+
+void testPolygonOnALineSendsNothing(void)
+{
+	const int xy[] = { 0, 0, 10, 5, 20, 10, 30, 15 };
+
+	TEST_ASSERT_EQUAL(0, LibEpdFillPolygon(xy, 4, NULL));
+	TEST_ASSERT_EQUAL(0, s_triangles);
+}
+
+void testPolygonOutOfRangeSendsNothing(void)
+{
+	static int xy[2 * (EPD_POLYGON_MAX + 1)];
+
+	TEST_ASSERT_EQUAL(-1, LibEpdFillPolygon(xy, 2, NULL));
+	TEST_ASSERT_EQUAL(-1, LibEpdFillPolygon(xy, EPD_POLYGON_MAX + 1, NULL));
+	TEST_ASSERT_EQUAL(0, s_triangles);
+}
+
+void testRoundRectWithLargestArcs(void)
+{
+	/* One point per degree on each corner: 4 x 91 points, one line between each */
+	LibEpdDrawLine_Ignore();
+	TEST_ASSERT_EQUAL(4 * 91, LibEpdDrawRoundRect(0, 0, 30000, 30000, 14000, NULL));
+}
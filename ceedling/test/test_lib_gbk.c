@@ -0,0 +1,97 @@
+#include "unity.h"
+#include "common.h"
+#include "lib_gbk.h"
+
+void setUp(void)
+{}
+
+void tearDown(void)
+{}
+
+void testAsciiIsCopiedAsItIs(void)
+{
+	const char * text = "A label long enough for the word and vector paths";
+	unsigned char gbk[64];
+
+	TEST_ASSERT_EQUAL(strlen(text), LibGbkFromUtf8(text, gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_STRING(text, (const char *) gbk);
+}
+
+void testChineseIsConverted(void)
+{
+	const unsigned char expected[] = { 'a', 0xD6, 0xD0, 0xCE, 0xC4, 0x00 };
+	unsigned char gbk[16];
+
+	/* "a" U+4E2D U+6587 */
+	TEST_ASSERT_EQUAL(5, LibGbkFromUtf8("a\xE4\xB8\xAD\xE6\x96\x87", gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, gbk, sizeof(expected));
+	TEST_ASSERT_EQUAL_HEX(0xD6D0, LibGbkFromUnicode(0x4E2D));
+}
+
+void testCutAtCharacterBoundary(void)
+{
+	unsigned char gbk[8];
+
+	/* Room for "a" and one double byte character */
+	memset(gbk, 0x55, sizeof(gbk));
+	TEST_ASSERT_EQUAL(3, LibGbkFromUtf8("a\xE4\xB8\xAD\xE6\x96\x87", gbk, 4));
+	TEST_ASSERT_EQUAL_HEX8(0xD0, gbk[2]);
+	TEST_ASSERT_EQUAL_HEX8(0x00, gbk[3]);
+
+	/* Never half of one */
+	memset(gbk, 0x55, sizeof(gbk));
+	TEST_ASSERT_EQUAL(1, LibGbkFromUtf8("a\xE4\xB8\xAD", gbk, 3));
+	TEST_ASSERT_EQUAL_STRING("a", (const char *) gbk);
+
+	TEST_ASSERT_EQUAL(0, LibGbkFromUtf8("abc", gbk, 1));
+	TEST_ASSERT_EQUAL_STRING("", (const char *) gbk);
+}
+
+void testMalformedUtf8IsReplaced(void)
+{
+	unsigned char gbk[16];
+
+	/* Sequence broken by an ASCII byte, which is kept */
+	TEST_ASSERT_EQUAL(2, LibGbkFromUtf8("\xE4\xB8" "A", gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_STRING("?A", (const char *) gbk);
+
+	/* Stray continuation byte */
+	TEST_ASSERT_EQUAL(2, LibGbkFromUtf8("\x80x", gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_STRING("?x", (const char *) gbk);
+
+	/* Sequence cut by the end of the string, never read past the NUL */
+	TEST_ASSERT_EQUAL(1, LibGbkFromUtf8("\xE4", gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_STRING("?", (const char *) gbk);
+}
+
+void testCharacterOutsideGbkIsReplaced(void)
+{
+	unsigned char gbk[16];
+
+	/* U+1F600 */
+	TEST_ASSERT_EQUAL(2, LibGbkFromUtf8("\xF0\x9F\x98\x80!", gbk, sizeof(gbk)));
+	TEST_ASSERT_EQUAL_STRING("?!", (const char *) gbk);
+}
+
+void testNonAsciiFoundAtEveryOffset(void)
+{
+	char text[64];
+	unsigned char gbk[64];
+	int at;
+	int start;
+
+	/* Every start alignment and every position of the character, for the byte, word and vector
+	 * paths alike */
+	for (start = 0; start < 16; start++)
+	{
+		for (at = start; at + 3 < 48; at++)
+		{
+			memset(text, 'a', sizeof(text));
+			memcpy(text + at, "\xE4\xB8\xAD", 3);
+			text[48] = '\0';
+			TEST_ASSERT_EQUAL(48 - start - 1, LibGbkFromUtf8(text + start, gbk, sizeof(gbk)));
+			TEST_ASSERT_EQUAL_HEX8(0xD6, gbk[at - start]);
+			TEST_ASSERT_EQUAL_HEX8(0xD0, gbk[at - start + 1]);
+		}
+	}
+}
@@ -0,0 +1,85 @@
+/***************************************************************************************************
+ *
+ * @file    drv_gpio.c
+ * @brief   The driver of GPIO output pins, through the sysfs GPIO class.
+ *          A pin is exported if needed, set up as an output driven low and then written
+ *          through its value file, kept open.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "drv_gpio.h"
+
+/* Write a short attribute file. Returns TRUE on success */
+static int _WriteFile(const char * path, const char * text)
+{
+    int fd;
+    int n = (int) strlen(text);
+    int ok;
+
+    fd = open(path, O_WRONLY);
+    if (fd < 0)
+    {
+        perror(path);
+        return FALSE;
+    }
+    ok = (write(fd, text, n) == n);
+    if (!ok)
+    {
+        perror(path);
+    }
+    close(fd);
+    return ok;
+}
+
+/* Set up a GPIO as an output driven low. Returns the fd of its value file, or -1 */
+int DrvGpioOpen(int gpio)
+{
+    char path[128];
+    char num[16];
+    int fd;
+
+    snprintf(path, sizeof(path), "%s/gpio%d/value", DRV_GPIO_SYSFS, gpio);
+    if (access(path, F_OK) != 0)
+    {
+        snprintf(num, sizeof(num), "%d", gpio);
+        if (!_WriteFile(DRV_GPIO_SYSFS "/export", num))
+        {
+            return -1;
+        }
+    }
+    snprintf(path, sizeof(path), "%s/gpio%d/direction", DRV_GPIO_SYSFS, gpio);
+    if (!_WriteFile(path, "low"))       /* Output, low from the start */
+    {
+        return -1;
+    }
+    snprintf(path, sizeof(path), "%s/gpio%d/value", DRV_GPIO_SYSFS, gpio);
+    fd = open(path, O_WRONLY);
+    if (fd < 0)
+    {
+        perror(path);
+    }
+    return fd;
+}
+
+/* Drive a pin opened with DrvGpioOpen() to PIN_LOW or PIN_HIGH. Returns TRUE on success */
+int DrvGpioWrite(int fd, int level)
+{
+    if ((lseek(fd, 0, SEEK_SET) < 0) || (write(fd, (level == PIN_LOW) ? "0" : "1", 1) != 1))
+    {
+        perror("DrvGpioWrite");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void DrvGpioClose(int fd)
+{
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
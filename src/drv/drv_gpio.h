@@ -0,0 +1,23 @@
+/***************************************************************************************************
+ *
+ * @file    drv_gpio.h
+ * @brief   API of the GPIO driver.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef DRV_GPIO_H_
+#define DRV_GPIO_H_
+
+/* sysfs GPIO class, another directory of the same layout for testing */
+#ifndef DRV_GPIO_SYSFS
+#define DRV_GPIO_SYSFS "/sys/class/gpio"
+#endif
+
+int DrvGpioOpen(int gpio);
+int DrvGpioWrite(int fd, int level);
+void DrvGpioClose(int fd);
+
+#endif /* DRV_GPIO_H_ */
@@ -9,14 +9,35 @@
  *          http://www.cnblogs.com/chengmin/p/3818133.html
  *          http://blog.csdn.net/w282529350/article/details/7386616
  *
+ *          In low latency mode the port is fully raw and, on a real serial port, flagged
+ *          ASYNC_LOW_LATENCY so the driver pushes small writes out at once (USB adapters such as
+ *          the FTDI ones drop their latency timer to 1 ms). DrvUartDrain() tells when the bytes
+ *          written have left the host. On a pty there is no such flag and nothing to wait for,
+ *          which is not an error.
+ *
  * @author  amaruk@163.com
  * @date    2017/02/26
  *
  **************************************************************************************************/
 
+#include <time.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#if defined(PLATFORM_UBUNTU) || defined(PLATFORM_BBB)
+#include <linux/serial.h>
+#endif
 #include "common.h"
+#include "drv_uart.h"
+#include "lib_epd_trace.h"
 
-static int s_uart_fd;
+static int s_uart_fd = -1;     /* -1 until DrvUartInit() succeeds */
+static drv_uart_stats_t s_uart_stats;
+
+/* Line settings of the opened port, 115200 8N1 until DrvUartInit() succeeds */
+static int s_uart_speed = 115200;
+static int s_uart_databits = 8;
+static int s_uart_stopbits = 1;
+static int s_uart_parity = 'N';
 
 #ifdef POSIX_STD
 const int c_speed_arr[] =
@@ -167,7 +188,7 @@ int DrvUartSetOthers(int fd)
 
 int DrvUartOpenDev(char *Dev)
 {
-    int fd = open(Dev, O_RDWR);         //| O_NOCTTY | O_NDELAY
+    int fd = open(Dev, O_RDWR | O_NOCTTY);      //| O_NDELAY
     if (-1 == fd)
     {
         perror("Can't Open Serial Port");
@@ -179,14 +200,28 @@ int DrvUartOpenDev(char *Dev)
 
 int DrvUartKill(void)
 {
-    close(s_uart_fd);
+    if (s_uart_fd >= 0)
+    {
+        close(s_uart_fd);
+        s_uart_fd = -1;
+    }
     return TRUE;
 }
 
 /* Transmit bytes */
 int DrvUartPutchars(const unsigned char * ptr, int n)
 {
-    return write(s_uart_fd, ptr, n);
+    int k;
+
+    EPD_TRACE_BEGIN("write", n);
+    k = write(s_uart_fd, ptr, n);
+    EPD_TRACE_END("write", k);
+    if (k > 0)
+    {
+        s_uart_stats.writes++;
+        s_uart_stats.bytes += k;
+    }
+    return k;
 }
 
 /* Receive bytes */
@@ -197,6 +232,7 @@ int DrvUartGetChars(unsigned char * ptr)
     {
         //printf("\nLen %d ", nread);
         *(ptr + nread) = '\0';
+        EPD_TRACE_INSTANT("read", nread);
         printf("DrvUartGetChars: [%s]\n", ptr);
     } else
     {
@@ -205,29 +241,256 @@ int DrvUartGetChars(unsigned char * ptr)
     return nread;
 }
 
-int DrvUartInit(char *dev_name, int speed, int databits, int stopbits,
+/* Receive up to n bytes, waiting at most timeout_us for the first ones.
+ * Returns the number of bytes, 0 on timeout, -1 on error */
+int DrvUartRead(unsigned char * ptr, int n, long timeout_us)
+{
+    return DrvUartReadPort(s_uart_fd, ptr, n, timeout_us);
+}
+
+/* DrvUartRead() on a port opened with DrvUartOpenPort() */
+int DrvUartReadPort(int fd, unsigned char * ptr, int n, long timeout_us)
+{
+    struct pollfd pfd;
+    int k;
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    k = poll(&pfd, 1, (timeout_us <= 0) ? 0 : (int) ((timeout_us + 999) / 1000));
+    if (k <= 0)
+    {
+        return k;
+    }
+    k = read(fd, ptr, n);
+    EPD_TRACE_INSTANT("read", k);
+    return k;
+}
+
+/* Drop the bytes received and not read yet */
+void DrvUartFlushInput(void)
+{
+    tcflush(s_uart_fd, TCIFLUSH);
+}
+
+/* Open and set up a port. Returns its fd, or -1 */
+int DrvUartOpenPort(char *dev_name, int speed, int databits, int stopbits,
         int parity)
 {
+    int fd;
 
     printf("Opening %s\n", dev_name);
-    s_uart_fd = DrvUartOpenDev(dev_name);
+    fd = DrvUartOpenDev(dev_name);
 
-    if (s_uart_fd > 0)
+    if (fd >= 0)
     {
-        DrvUartSetSpeed(s_uart_fd, speed);
+        DrvUartSetSpeed(fd, speed);
     } else
     {
         printf("ERROR: Can't Open Serial Port!\n");
-        return FALSE;
+        return -1;
     }
 
-    if (DrvUartSetParity(s_uart_fd, databits, stopbits, parity) == FALSE)
+    if (DrvUartSetParity(fd, databits, stopbits, parity) == FALSE)
     {
         printf("ERROR: Set Parity Error\n");
+        close(fd);
+        return -1;
+    }
+
+    DrvUartSetOthers(fd);
+    return fd;
+}
+
+/* Write all n bytes to a port opened with DrvUartOpenPort(). Returns n, or -1 on error */
+int DrvUartWritePort(int fd, const unsigned char * ptr, int n)
+{
+    int sent = 0;
+    int k;
+
+    while (sent < n)
+    {
+        EPD_TRACE_BEGIN("write", n - sent);
+        k = write(fd, ptr + sent, n - sent);
+        EPD_TRACE_END("write", k);
+        if (k <= 0)
+        {
+            return -1;
+        }
+        sent += k;
+    }
+    return n;
+}
+
+/* Wait until the bytes written to a port have left the host. Returns TRUE on success */
+int DrvUartDrainPort(int fd)
+{
+    return (tcdrain(fd) == 0) ? TRUE : FALSE;
+}
+
+/* Drop the bytes a port received and not read yet */
+void DrvUartFlushPort(int fd)
+{
+    tcflush(fd, TCIFLUSH);
+}
+
+int DrvUartInit(char *dev_name, int speed, int databits, int stopbits,
+        int parity)
+{
+    int fd = DrvUartOpenPort(dev_name, speed, databits, stopbits, parity);
+
+    if (fd < 0)
+    {
         return FALSE;
     }
+    s_uart_fd = fd;
+
+    s_uart_speed = speed;
+    s_uart_databits = databits;
+    s_uart_stopbits = stopbits;
+    s_uart_parity = parity;
+
+    return TRUE;
+}
 
-    DrvUartSetOthers(s_uart_fd);
+/* Full raw mode, the character size and parity kept as set up */
+static int _SetRaw(int fd)
+{
+    struct termios options;
 
+    if (tcgetattr(fd, &options) != 0)
+    {
+        perror("DrvUartSetLowLatency");
+        return FALSE;
+    }
+    options.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF
+            | IXANY);
+    options.c_oflag &= ~OPOST;
+    options.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    options.c_cflag |= CLOCAL | CREAD;
+    if (tcsetattr(fd, TCSANOW, &options) != 0)
+    {
+        perror("DrvUartSetLowLatency");
+        return FALSE;
+    }
     return TRUE;
 }
+
+/* Set or clear ASYNC_LOW_LATENCY. Returns FALSE if the port has no serial driver flags */
+static int _SetSerialLowLatency(int fd, int on)
+{
+#if defined(TIOCGSERIAL) && defined(ASYNC_LOW_LATENCY)
+    struct serial_struct serial;
+
+    if (ioctl(fd, TIOCGSERIAL, &serial) != 0)
+    {
+        return FALSE;
+    }
+    if (on)
+    {
+        serial.flags |= ASYNC_LOW_LATENCY;
+    }
+    else
+    {
+        serial.flags &= ~ASYNC_LOW_LATENCY;
+    }
+    if (ioctl(fd, TIOCSSERIAL, &serial) != 0)
+    {
+        perror("DrvUartSetLowLatency");
+        return FALSE;
+    }
+    return TRUE;
+#else
+    (void) fd;
+    (void) on;
+    return FALSE;
+#endif
+}
+
+/* Enter or leave low latency mode. Returns TRUE unless the port could not be set up, a port
+ * without the low latency flag (a pty) being set up as raw only, see drv_uart_stats_t */
+int DrvUartSetLowLatency(int on)
+{
+    if (on && !_SetRaw(s_uart_fd))
+    {
+        return FALSE;
+    }
+    s_uart_stats.serial = _SetSerialLowLatency(s_uart_fd, on);
+    s_uart_stats.low_latency = on && s_uart_stats.serial;
+    return TRUE;
+}
+
+/* Bytes written but not sent yet, -1 if the port cannot tell */
+int DrvUartOutq(void)
+{
+#ifdef TIOCOUTQ
+    int n;
+
+    if (ioctl(s_uart_fd, TIOCOUTQ, &n) == 0)
+    {
+        return n;
+    }
+#endif
+    return -1;
+}
+
+/* Wait until every byte written has left the host, as far as the driver knows: a USB adapter
+ * that cannot report its own FIFO may still hold a few.
+ * Returns the CLOCK_MONOTONIC time in us when done, -1 on error */
+long long DrvUartDrain(void)
+{
+    struct timespec t0;
+    struct timespec t1;
+    long us;
+
+    EPD_TRACE_BEGIN("drain", 0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (tcdrain(s_uart_fd) != 0)
+    {
+        EPD_TRACE_END("drain", -1);
+        perror("DrvUartDrain");
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    EPD_TRACE_END("drain", 0);
+
+    us = (t1.tv_sec - t0.tv_sec) * 1000000L + (t1.tv_nsec - t0.tv_nsec) / 1000;
+    s_uart_stats.drains++;
+    s_uart_stats.drain_us = us;
+    if (us > s_uart_stats.drain_max_us)
+    {
+        s_uart_stats.drain_max_us = us;
+    }
+    return t1.tv_sec * 1000000LL + t1.tv_nsec / 1000;
+}
+
+void DrvUartGetStats(drv_uart_stats_t * stats)
+{
+    *stats = s_uart_stats;
+}
+
+/* Baud rate of the opened port */
+int DrvUartGetSpeed(void)
+{
+    return s_uart_speed;
+}
+
+/* Bits on the wire per byte: start bit, data bits, parity bit if enabled, stop bits.
+ * Space parity is set up as no parity, see DrvUartSetParity() */
+int DrvUartBitsPerByte(void)
+{
+    int bits = 1 + s_uart_databits + s_uart_stopbits;
+
+    switch (s_uart_parity)
+    {
+    case 'o':
+    case 'O':
+    case 'e':
+    case 'E':
+        bits++;
+        break;
+    default:
+        break;
+    }
+    return bits;
+}
@@ -11,10 +11,37 @@
 #ifndef DRV_UART_H_
 #define DRV_UART_H_
 
+/* Transmit counters and state of the port */
+typedef struct
+{
+    unsigned long writes;
+    unsigned long bytes;
+    unsigned long drains;
+    long drain_us;              /* Last wait for the output queue to empty */
+    long drain_max_us;
+    int serial;                 /* A serial driver, FALSE on a pty */
+    int low_latency;            /* ASYNC_LOW_LATENCY in effect */
+} drv_uart_stats_t;
+
 int DrvUartInit(char *dev_name, int speed, int databits, int stopbits,
         int parity);
+int DrvUartOpenPort(char *dev_name, int speed, int databits, int stopbits,
+        int parity);
+int DrvUartWritePort(int fd, const unsigned char * ptr, int n);
+int DrvUartDrainPort(int fd);
+void DrvUartFlushPort(int fd);
+int DrvUartReadPort(int fd, unsigned char * ptr, int n, long timeout_us);
 int DrvUartKill(void);
 int DrvUartPutchars(const unsigned char * ptr, int n);
-int DrvUartGetChars(const unsigned char * ptr);
+int DrvUartGetChars(unsigned char * ptr);
+int DrvUartRead(unsigned char * ptr, int n, long timeout_us);
+void DrvUartFlushInput(void);
+int DrvUartGetSpeed(void);
+int DrvUartBitsPerByte(void);
+
+int DrvUartSetLowLatency(int on);
+int DrvUartOutq(void);
+long long DrvUartDrain(void);
+void DrvUartGetStats(drv_uart_stats_t * stats);
 
 #endif /* DRV_UART_H_ */
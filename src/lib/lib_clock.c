@@ -0,0 +1,99 @@
+/***************************************************************************************************
+ *
+ * @file    lib_clock.c
+ * @brief   Clock used for every delay and time stamp.
+ *
+ *          The real clock is CLOCK_MONOTONIC and nanosleep(). The virtual clock only counts:
+ *          sleeping advances the simulated time at once, so device flows that wait seconds
+ *          (reset, refresh intervals, demos) run in no time under test, while every time stamp
+ *          and latency statistic stays consistent in simulated time.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <time.h>
+#include "common.h"
+#include "lib_clock.h"
+
+static long long s_virtual_us = 0;
+
+static long long _RealNowUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static void _RealSleepUs(long long us)
+{
+    struct timespec ts;
+
+    if (us <= 0)
+    {
+        return;
+    }
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (us % 1000000) * 1000;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+    }
+}
+
+static long long _VirtualNowUs(void)
+{
+    return __atomic_load_n(&s_virtual_us, __ATOMIC_SEQ_CST);
+}
+
+static void _VirtualSleepUs(long long us)
+{
+    if (us > 0)
+    {
+        __atomic_add_fetch(&s_virtual_us, us, __ATOMIC_SEQ_CST);
+    }
+}
+
+static const lib_clock_t c_clock_real = { _RealNowUs, _RealSleepUs };
+static const lib_clock_t c_clock_virtual = { _VirtualNowUs, _VirtualSleepUs };
+
+static const lib_clock_t * s_clock = &c_clock_real;
+
+/* Use a custom clock, NULL for the real one */
+void LibClockSet(const lib_clock_t * clock)
+{
+    s_clock = (clock != NULL) ? clock : &c_clock_real;
+}
+
+void LibClockUseReal(void)
+{
+    s_clock = &c_clock_real;
+}
+
+/* Switch to simulated time. The virtual clock keeps counting from where it was */
+void LibClockUseVirtual(void)
+{
+    s_clock = &c_clock_virtual;
+}
+
+long long LibClockNowUs(void)
+{
+    return s_clock->now_us();
+}
+
+long LibClockNowMs(void)
+{
+    return (long) (s_clock->now_us() / 1000);
+}
+
+void LibClockSleepUs(long long us)
+{
+    s_clock->sleep_us(us);
+}
+
+/* Move the virtual clock forward without sleeping, e.g. to expire a timer in a test */
+void LibClockAdvanceUs(long long us)
+{
+    _VirtualSleepUs(us);
+}
@@ -0,0 +1,30 @@
+/***************************************************************************************************
+ *
+ * @file    lib_clock.h
+ * @brief   API of the clock used for every delay and time stamp.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_CLOCK_H
+#define LIB_CLOCK_H
+
+/* Clock implementation */
+typedef struct
+{
+    long long (*now_us)(void);          /* Monotonic time in microseconds */
+    void (*sleep_us)(long long us);     /* Let the given time pass */
+} lib_clock_t;
+
+void LibClockSet(const lib_clock_t * clock);
+void LibClockUseReal(void);
+void LibClockUseVirtual(void);
+
+long long LibClockNowUs(void);
+long LibClockNowMs(void);
+void LibClockSleepUs(long long us);
+void LibClockAdvanceUs(long long us);
+
+#endif
@@ -21,10 +21,17 @@
 #include "common.h"
 #include "lib_epd.h"
 #include "drv_uart.h"
+#include "lib_clock.h"
+#include "lib_gbk.h"
+#include "lib_epd_mem.h"
+#include "lib_epd_trace.h"
+#include "drv_gpio.h"
 
-/* The following pins are not in use now */
+/* The reset pin is not in use now, the wake up pin only once its GPIO is open */
 static int s_pin_wakeup = 0;    /* Wake up pin */
 static int s_pin_reset = 0;     /* Reset pin */
+static int s_wakeup_gpio = EPD_WAKEUP_GPIO;
+static int s_wakeup_fd = -1;
 
 /* Command frames */
 static const unsigned char s_frame_handshake[8] =
@@ -49,6 +56,11 @@ static const unsigned char s_frame_dword[12] =                           //Cmd w
 /* Command data */
 static unsigned char s_frame_buff[FRAME_BUFF_SIZE];
 
+#ifdef EPD_TRACE
+static long s_refresh_ids = 0;
+static volatile long s_refresh_open = 0;    /* Refresh traced and not known to be over, 0 if none */
+#endif
+
 /* Generate checksum */
 static unsigned char _checksum(const void * ptr, int n)
 {
@@ -64,26 +76,419 @@ static unsigned char _checksum(const void * ptr, int n)
     return result;
 }
 
-#define SYSFS_UART_DEV "/sys/devices/bone_capemgr.9/slots"
+/* Total length of an encoded frame, read from its length field */
+int LibEpdFrameLen(const unsigned char * ptr)
+{
+    return (ptr[1] << 8) | ptr[2];
+}
 
-/* Initialization */
-void LibEpdInit(void)
+/* TRUE if the n bytes at ptr start with a whole frame: start byte, length from the header
+ * through the four end bytes and the checksum, at most n, and a matching checksum */
+int LibEpdFrameValid(const unsigned char * ptr, int n)
+{
+    int len;
+
+    if ((n < 9) || (ptr[0] != START))
+    {
+        return FALSE;
+    }
+    len = LibEpdFrameLen(ptr);
+    return (len >= 9) && (len <= n) && (_checksum(ptr, len - 1) == ptr[len - 1]);
+}
+
+/* Settings of the e-paper */
+static lib_epd_state_t s_state =
+{ 0, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN };
+
+/* Settings as written to the UART. s_state runs ahead of it while frames are recorded into
+ * scenes, and keeps what was recorded into scenes never sent */
+static lib_epd_state_t s_sent =
+{ 0, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN, EPD_UNKNOWN };
+
+/* Logical to panel coordinates: x' = xx x + xy y + xc, y' = yx x + yy y + yc */
+typedef struct
+{
+    int xx;
+    int xy;
+    int xc;
+    int yx;
+    int yy;
+    int yc;
+} epd_xf_t;
+
+/* Orientation set with LibEpdSetOrientation() */
+static int s_orientation = EPD_ROTATE_0;
+static epd_xf_t s_xf = { 1, 0, 0, 0, 1, 0 };
+
+/* Scene being recorded, NULL when frames go straight to the UART */
+static lib_epd_scene_t * s_scene = NULL;
+
+/* Layers frames pass through on their way to the UART (power, skip, link), NULL if unset */
+static const lib_epd_layer_t * s_layer[EPD_LAYERS];
+
+/* Map a logical point to the panel, the same arithmetic whatever the orientation */
+static void _Map(int * x, int * y)
+{
+    int x0 = *x;
+
+    *x = s_xf.xx * x0 + s_xf.xy * *y + s_xf.xc;
+    *y = s_xf.yx * x0 + s_xf.yy * *y + s_xf.yc;
+}
+
+/* Put a mapped pair of coordinates back in ascending order */
+static void _Order(int * a, int * b)
+{
+    int lo = (*a < *b) ? *a : *b;
+    int hi = (*a < *b) ? *b : *a;
+
+    *a = lo;
+    *b = hi;
+}
+
+/* Take the settings among whole frames into st */
+static void _TakeSettings(lib_epd_state_t * st, const unsigned char * ptr, int n)
+{
+    const unsigned char * f;
+    int off;
+    int len;
+
+    for (off = 0; off + 5 <= n; off += len)
+    {
+        f = ptr + off;
+        len = LibEpdFrameLen(f);
+        if ((len < 5) || (off + len > n))
+        {
+            break;
+        }
+        switch (f[3])
+        {
+        case CMD_SET_BAUD:
+            st->baud = (len >= 13) ? ((long) f[4] << 24) | (f[5] << 16) | (f[6] << 8) | f[7]
+                    : st->baud;
+            break;
+        case CMD_SET_MEM_MODE:
+            st->mem_mode = f[4];
+            break;
+        case CMD_SET_SCR_ROTATION:
+            st->rotation = f[4];
+            break;
+        case CMD_SET_COLOR:
+            st->color = f[4];
+            st->bkcolor = (len >= 11) ? f[5] : st->bkcolor;
+            break;
+        case CMD_SET_EN_FONT:
+            st->en_font = f[4];
+            break;
+        case CMD_SET_CH_FONT:
+            st->ch_font = f[4];
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* Write whole frames to the UART, the end of the layers. Returns n, or -1 on error */
+static int _WriteUart(const unsigned char * ptr, int n)
 {
+    int sent = 0;
+    int k;
+
+    LibEpdNoteSent(ptr, n);
+    while (sent < n)
+    {
+        k = DrvUartPutchars(ptr + sent, n - sent);
+        if (k <= 0)
+        {
+            perror("LibEpdWrite");
+            return -1;
+        }
+        sent += k;
+    }
+    return n;
+}
+
+/* Put a layer at its place among those frames pass through, NULL to take it out.
+ * A layer passes the frames on with LibEpdWriteAfter(), when and how it sees fit */
+void LibEpdSetLayer(int layer, const lib_epd_layer_t * ops)
+{
+    if ((layer >= 0) && (layer < EPD_LAYERS))
+    {
+        s_layer[layer] = ops;
+    }
+}
+
+/* Pass whole frames to the next layer set after the given one, or to the UART.
+ * Returns n, or -1 on error */
+int LibEpdWriteAfter(int layer, const unsigned char * ptr, int n)
+{
+    int i;
+
+    for (i = layer + 1; i < EPD_LAYERS; i++)
+    {
+        if (s_layer[i] != NULL)
+        {
+            return s_layer[i]->write(ptr, n);
+        }
+    }
+    return _WriteUart(ptr, n);
+}
+
+/* Write whole encoded frames through the layers to the UART, whether a scene is being
+ * recorded or not. For frames encoded earlier, e.g. queued by another thread.
+ * Returns n, or -1 on error */
+int LibEpdWrite(const unsigned char * ptr, int n)
+{
+    return LibEpdWriteAfter(-1, ptr, n);
+}
+
+/* Send a frame to the UART, or record it into the active scene */
+static int _Send(const unsigned char * ptr, int n)
+{
+    int k;
+
+    if (s_scene != NULL)
+    {
+        EPD_TRACE_INSTANT("enqueue", ptr[3]);
+        return LibEpdSceneAppend(s_scene, ptr, n);
+    }
+    EPD_TRACE_BEGIN("frame", ptr[3]);
+    k = LibEpdWrite(ptr, n);
+    EPD_TRACE_END("frame", k);
+    return k;
+}
+
+/* Send already encoded frames, one by one as if just drawn, their settings taken into the
+ * state. Returns FALSE if a frame is broken, none being sent then, or could not be sent */
+int LibEpdSendFrames(const unsigned char * ptr, int n)
+{
+    int off;
+    int len;
+
+    for (off = 0; off < n; off += len)
+    {
+        if (!LibEpdFrameValid(ptr + off, n - off))
+        {
+            return FALSE;
+        }
+        len = LibEpdFrameLen(ptr + off);
+    }
+    for (off = 0; off < n; off += len)
+    {
+        len = LibEpdFrameLen(ptr + off);
+        _TakeSettings(&s_state, ptr + off, len);
+        if (_Send(ptr + off, len) <= 0)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Prepare an empty scene */
+void LibEpdSceneInit(lib_epd_scene_t * scene)
+{
+    scene->data = NULL;
+    scene->len = 0;
+    scene->size = 0;
+    scene->frames = 0;
+}
+
+/* Release the memory held by a scene */
+void LibEpdSceneFree(lib_epd_scene_t * scene)
+{
+    LibEpdMemFree(EPD_MEM_SCENE, scene->data);
+    LibEpdSceneInit(scene);
+}
+
+/* Drop the recorded frames but keep the memory for reuse */
+void LibEpdSceneReset(lib_epd_scene_t * scene)
+{
+    scene->len = 0;
+    scene->frames = 0;
+}
+
+/* Append one encoded frame to a scene. Returns n, or -1 if the scene pool refuses it */
+int LibEpdSceneAppend(lib_epd_scene_t * scene, const unsigned char * ptr, int n)
+{
+    unsigned char * data;
+    int size;
+
+    if (scene->len + n > scene->size)
+    {
+        size = (scene->size > 0) ? scene->size : FRAME_BUFF_SIZE;
+        while (size < scene->len + n)
+        {
+            size *= 2;
+        }
+        data = LibEpdMemRealloc(EPD_MEM_SCENE, scene->data, size);
+        if (data == NULL)
+        {
+            return -1;
+        }
+        scene->data = data;
+        scene->size = size;
+    }
+
+    memcpy(scene->data + scene->len, ptr, n);
+    scene->len += n;
+    scene->frames++;
+
+    return n;
+}
+
+/* Copy the frames of src into dst. Returns TRUE on success */
+int LibEpdSceneCopy(lib_epd_scene_t * dst, const lib_epd_scene_t * src)
+{
+    LibEpdSceneReset(dst);
+    if (src->len == 0)
+    {
+        return TRUE;
+    }
+    if (LibEpdSceneAppend(dst, src->data, src->len) < 0)
+    {
+        return FALSE;
+    }
+    dst->frames = src->frames;
+    return TRUE;
+}
+
+/* Record every following frame into the scene instead of sending it */
+void LibEpdSceneBegin(lib_epd_scene_t * scene)
+{
+    s_scene = scene;
+}
+
+/* Stop recording, following frames go to the UART again */
+void LibEpdSceneEnd(void)
+{
+    s_scene = NULL;
+}
+
+/* Transmit the recorded frames of a scene. Returns TRUE on success */
+int LibEpdSceneSend(const lib_epd_scene_t * scene)
+{
+    return (scene->len == 0) || (LibEpdWrite(scene->data, scene->len) >= 0);
+}
+
+#define SYSFS_UART_DEV "/sys/devices/bone_capemgr.9/slots"
+
 #if defined(PLATFORM_BBB)
+#define EPD_UART_DEV "/dev/ttyO4"
+#elif defined(PLATFORM_UBUNTU)
+#define EPD_UART_DEV "/dev/ttyUSB0"
+#elif defined(PLATFORM_CYGWIN)
+#define EPD_UART_DEV "/dev/ttyS35"
+#else
+#define EPD_UART_DEV "/dev/ttyS0"
+#endif
+
+#if defined(PLATFORM_BBB)
+/* Load the BB-UART4 cape unless the overlay is already in the slots */
+static void _LoadCape(void)
+{
     FILE *fd = NULL;
+    char line[128];
+
+    fd = fopen(SYSFS_UART_DEV, "r");
+    if (fd != NULL)
+    {
+        while (fgets(line, sizeof(line), fd) != NULL)
+        {
+            if (strstr(line, "BB-UART4") != NULL)
+            {
+                fclose(fd);
+                return;
+            }
+        }
+        fclose(fd);
+    }
 
     fd = fopen(SYSFS_UART_DEV, "w");
-    fwrite("BB-UART4", sizeof(int), 8, fd); /* "BB-UART4" length is 8 */
+    if (fd == NULL)
+    {
+        perror(SYSFS_UART_DEV);
+        return;
+    }
+    fwrite("BB-UART4", 1, 8, fd); /* "BB-UART4" length is 8 */
     fclose(fd);
+}
+#endif
 
-    DrvUartInit("/dev/ttyO4", 115200, 8, 1, 'N');
-#elif defined(PLATFORM_UBUNTU)
-    DrvUartInit("/dev/ttyUSB0", 115200, 8, 1, 'N');
-#elif defined(PLATFORM_CYGWIN)
-    DrvUartInit("/dev/ttyS35", 115200, 8, 1, 'N');
+/* Initialization */
+void LibEpdInit(void)
+{
+    LibEpdInitSpeed(115200);
+}
+
+/* Initialization of the platform UART at a given baud rate. Returns TRUE on success */
+int LibEpdInitSpeed(int speed)
+{
+#if defined(PLATFORM_BBB)
+    _LoadCape();
 #endif
+    return LibEpdInitDev(EPD_UART_DEV, speed);
+}
+
+/* Initialization on a given serial device, e.g. a pty when testing without the e-paper.
+ * Returns TRUE on success */
+int LibEpdInitDev(const char * dev_name, int speed)
+{
+    if ((s_wakeup_fd < 0) && (s_wakeup_gpio >= 0))
+    {
+        s_wakeup_fd = DrvGpioOpen(s_wakeup_gpio);
+    }
     s_pin_wakeup = PIN_LOW;
     s_pin_reset = PIN_LOW;
+    s_state.baud = speed;
+    s_sent.baud = speed;
+
+    return DrvUartInit((char *) dev_name, speed, 8, 1, 'N');
+}
+
+/* Settings as last encoded, EPD_UNKNOWN where nothing was encoded yet */
+void LibEpdGetState(lib_epd_state_t * state)
+{
+    *state = s_state;
+}
+
+/* Set the settings frames are encoded against */
+void LibEpdSetState(const lib_epd_state_t * state)
+{
+    s_state = *state;
+}
+
+/* Settings as written to the e-paper, EPD_UNKNOWN where nothing was written yet */
+void LibEpdGetSentState(lib_epd_state_t * state)
+{
+    *state = s_sent;
+}
+
+/* Tell the library what the e-paper is known to be set to, e.g. after a warm start */
+void LibEpdSetSentState(const lib_epd_state_t * state)
+{
+    s_state = *state;
+    s_sent = *state;
+}
+
+/* Take the settings among whole frames about to be written to the UART into the sent state.
+ * Done by LibEpdWrite() for every frame that reaches the UART */
+void LibEpdNoteSent(const unsigned char * ptr, int n)
+{
+    _TakeSettings(&s_sent, ptr, n);
+}
+
+/* Low latency serial line, see DrvUartSetLowLatency(). Returns TRUE on success */
+int LibEpdSetLowLatency(int on)
+{
+    return DrvUartSetLowLatency(on);
+}
+
+/* Wait until the frames sent have left the host.
+ * Returns the CLOCK_MONOTONIC time in us when they had, -1 on error */
+long long LibEpdDrain(void)
+{
+    return DrvUartDrain();
 }
 
 /* Close communication with the e-paper */
@@ -96,38 +501,140 @@ void LibEpdClose(void)
 void LibEpdReset(void)
 {
     s_pin_reset = 0;
-    usleep(10);
+    LibClockSleepUs(10);
     s_pin_reset = 1;
-    usleep(500);
+    LibClockSleepUs(500);
     s_pin_reset = 0;
-    usleep(3000000);
+    LibClockSleepUs(3000000);
+}
+
+static void _PinWakeup(int level)
+{
+    s_pin_wakeup = level;
+    if (s_wakeup_fd >= 0)
+    {
+        DrvGpioWrite(s_wakeup_fd, level);
+    }
 }
 
 /* Wake up the e-paper */
 void LibEpdWakeup(void)
 {
-    s_pin_wakeup = PIN_LOW;
-    usleep(10);
-    s_pin_wakeup = PIN_HIGH;
-    usleep(500);
-    s_pin_wakeup = PIN_LOW;
-    usleep(10);
+    _PinWakeup(PIN_LOW);
+    LibClockSleepUs(10);
+    _PinWakeup(PIN_HIGH);
+    LibClockSleepUs(500);
+    _PinWakeup(PIN_LOW);
+    LibClockSleepUs(10);
 }
 
-/* Handshake */
-void LibEpdHandshake(void)
+/* Drive the wake up pin through sysfs GPIO gpio from now on, -1 if it is not wired.
+ * Returns TRUE on success */
+int LibEpdSetWakeupGpio(int gpio)
 {
-    memcpy(s_frame_buff, s_frame_handshake, 8);
-    s_frame_buff[8] = _checksum(s_frame_buff, 8);
+    DrvGpioClose(s_wakeup_fd);
+    s_wakeup_gpio = gpio;
+    s_wakeup_fd = (gpio >= 0) ? DrvGpioOpen(gpio) : -1;
+    return (gpio < 0) || (s_wakeup_fd >= 0);
+}
 
-    DrvUartPutchars(s_frame_buff, 9);
-    DrvUartGetChars(s_frame_buff); // Returns "OK" if epaper is ready
-    // TODO: Check handshake result
+/* Whether LibEpdWakeup() really pulses the wake up pin */
+int LibEpdWakeupWired(void)
+{
+    return s_wakeup_fd >= 0;
+}
+
+/* Handshake, after the layers let go of the frames they hold or have in flight.
+ * Returns TRUE if the e-paper answered "OK" */
+int LibEpdHandshake(void)
+{
+    int i;
+
+    for (i = 0; i < EPD_LAYERS; i++)
+    {
+        if ((s_layer[i] != NULL) && (s_layer[i]->flush != NULL))
+        {
+            s_layer[i]->flush();
+        }
+    }
+    return LibEpdWaitReady();
+}
+
+/* End of a wait for the handshake reply */
+static void _ReadyDone(int ok)
+{
+    EPD_TRACE_END("wait ready", ok);
+#ifdef EPD_TRACE
+    if (ok && (s_refresh_open != 0))
+    {
+        EPD_TRACE_ASYNC_END("refresh", s_refresh_open);
+        s_refresh_open = 0;
+    }
+#else
+    (void) ok;
+#endif
+}
+
+/* Handshake and wait for the "OK" reply. The e-paper does not answer while it is refreshing,
+ * so this returns once the previous update is done. Returns TRUE if the e-paper is ready.
+ * Uses its own buffers, so it may run in another thread than the drawing calls. */
+int LibEpdWaitReady(void)
+{
+    unsigned char frame[9];
+    unsigned char reply[FRAME_BUFF_SIZE + 1];
+    int ok;
+
+    memcpy(frame, s_frame_handshake, 8);
+    frame[8] = _checksum(frame, 8);
+
+    EPD_TRACE_BEGIN("wait ready", 0);
+    ok = (DrvUartPutchars(frame, 9) == 9) && (DrvUartGetChars(reply) > 0)
+            && (strstr((const char *) reply, "OK") != NULL);
+    _ReadyDone(ok);
+    return ok ? TRUE : FALSE;
+}
+
+/* LibEpdWaitReady() giving up after timeout_us instead of the timeout of the UART, for an
+ * e-paper that may be asleep or absent. Returns TRUE if the e-paper is ready */
+int LibEpdWaitReadyUs(long timeout_us)
+{
+    unsigned char frame[9];
+    unsigned char reply[FRAME_BUFF_SIZE + 1];
+    long long deadline;
+    long left;
+    int len = 0;
+    int k;
+    int ok = FALSE;
+
+    memcpy(frame, s_frame_handshake, 8);
+    frame[8] = _checksum(frame, 8);
+
+    EPD_TRACE_BEGIN("wait ready", timeout_us);
+    if (DrvUartPutchars(frame, 9) == 9)
+    {
+        deadline = LibClockNowUs() + timeout_us;
+        while (!ok && (len < FRAME_BUFF_SIZE))
+        {
+            left = (long) (deadline - LibClockNowUs());
+            k = (left > 0) ? DrvUartRead(reply + len, FRAME_BUFF_SIZE - len, left) : 0;
+            if (k <= 0)
+            {
+                break;
+            }
+            len += k;
+            reply[len] = '\0';
+            ok = (strstr((const char *) reply, "OK") != NULL);
+        }
+    }
+    _ReadyDone(ok);
+    return ok ? TRUE : FALSE;
 }
 
 /* Set baudrate */
 void LibEpdSetBaud(long baud)
 {
+    s_state.baud = baud;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -146,9 +653,9 @@ void LibEpdSetBaud(long baud)
     s_frame_buff[11] = END_3;
     s_frame_buff[12] = _checksum(s_frame_buff, 12);
 
-    DrvUartPutchars(s_frame_buff, 13);
+    _Send(s_frame_buff, 13);
 
-    usleep(10000);
+    LibClockSleepUs(10000);
 }
 
 /* Read baudrate */
@@ -157,7 +664,7 @@ void LibEpdReadBaud(void)
     memcpy(s_frame_buff, s_frame_read_baud, 8);
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
     // TODO: Read baud in ASCII format
 }
 
@@ -165,6 +672,8 @@ void LibEpdReadBaud(void)
  * mode: MEM_TF(1) or MEM_NAND(0) */
 void LibEpdSetMemory(unsigned char mode)
 {
+    s_state.mem_mode = mode;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -180,7 +689,7 @@ void LibEpdSetMemory(unsigned char mode)
     s_frame_buff[8] = END_3;
     s_frame_buff[9] = _checksum(s_frame_buff, 9);
 
-    DrvUartPutchars(s_frame_buff, 10);
+    _Send(s_frame_buff, 10);
 }
 
 /* Enter stop mode */
@@ -189,7 +698,7 @@ void LibEpdEnterStopMode(void)
     memcpy(s_frame_buff, s_frame_stopmode, 8);
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
 }
 
 /* Update the e-paper's screen:
@@ -200,12 +709,26 @@ void LibEpdUpdate(void)
     memcpy(s_frame_buff, s_frame_update, 8);
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
+#ifdef EPD_TRACE
+    if (s_scene == NULL)
+    {
+        /* Open until the next handshake reply, which the e-paper holds back while refreshing */
+        if (s_refresh_open != 0)
+        {
+            EPD_TRACE_ASYNC_END("refresh", s_refresh_open);
+        }
+        s_refresh_open = ++s_refresh_ids;
+        EPD_TRACE_ASYNC_BEGIN("refresh", s_refresh_open);
+    }
+#endif
 }
 
 /* Normal screen (0) or upside down screen (1) */
 void LibEpdScreenRotation(unsigned char mode)
 {
+    s_state.rotation = mode;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -221,7 +744,44 @@ void LibEpdScreenRotation(unsigned char mode)
     s_frame_buff[8] = END_3;
     s_frame_buff[9] = _checksum(s_frame_buff, 9);
 
-    DrvUartPutchars(s_frame_buff, 10);
+    _Send(s_frame_buff, 10);
+}
+
+/* Orientation of everything drawn from now on.
+ * EPD_ROTATE_0 and EPD_ROTATE_180 use the rotation of the e-paper. EPD_ROTATE_90 and
+ * EPD_ROTATE_270 map the coordinates on the host, the logical screen being
+ * EPD_HEIGHT wide and EPD_WIDTH high; see LibEpdTextNeedsHost() */
+void LibEpdSetOrientation(int orientation)
+{
+    static const epd_xf_t c_xf[4] =
+    {
+        { 1, 0, 0, 0, 1, 0 },
+        { 0, -1, EPD_WIDTH - 1, 1, 0, 0 },
+        { 1, 0, 0, 0, 1, 0 },
+        { 0, 1, 0, -1, 0, EPD_HEIGHT - 1 },
+    };
+    unsigned char rotation;
+
+    orientation &= 3;
+    rotation = (orientation == EPD_ROTATE_180) ? EPD_INVERSION : EPD_NORMAL;
+    if (s_state.rotation != rotation)
+    {
+        LibEpdScreenRotation(rotation);
+    }
+    s_orientation = orientation;
+    s_xf = c_xf[orientation];
+}
+
+int LibEpdGetOrientation(void)
+{
+    return s_orientation;
+}
+
+/* Whether text and bitmaps come out unrotated, so must be rasterized on the host
+ * (e.g. with lib_epd_font) to follow the orientation. Their anchor is still mapped */
+int LibEpdTextNeedsHost(void)
+{
+    return (s_orientation == EPD_ROTATE_90) || (s_orientation == EPD_ROTATE_270);
 }
 
 /* Load font from TF to NAND */
@@ -230,7 +790,7 @@ void LibEpdLoadFont(void)
     memcpy(s_frame_buff, s_frame_load_font, 8);
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
 }
 
 /* Load BMP from TF to NAND */
@@ -239,12 +799,15 @@ void LibEpdLoadPic(void)
     memcpy(s_frame_buff, s_frame_load_pic, 8);
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
 }
 
 /* Set fore-ground and back-ground colours */
 void LibEpdSetColor(unsigned char color, unsigned char bkcolor)
 {
+    s_state.color = color;
+    s_state.bkcolor = bkcolor;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -261,12 +824,14 @@ void LibEpdSetColor(unsigned char color, unsigned char bkcolor)
     s_frame_buff[9] = END_3;
     s_frame_buff[10] = _checksum(s_frame_buff, 10);
 
-    DrvUartPutchars(s_frame_buff, 11);
+    _Send(s_frame_buff, 11);
 }
 
 /* Set English font: 1:32dot 2:48dot 3:64dot */
 void LibEpdSetEnFont(unsigned char font)
 {
+    s_state.en_font = font;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -282,12 +847,14 @@ void LibEpdSetEnFont(unsigned char font)
     s_frame_buff[8] = END_3;
     s_frame_buff[9] = _checksum(s_frame_buff, 9);
 
-    DrvUartPutchars(s_frame_buff, 10);
+    _Send(s_frame_buff, 10);
 }
 
 /* Set Chinese font: 1:32dot 2:48dot 3:64dot */
 void LibEpdSetChFont(unsigned char font)
 {
+    s_state.ch_font = font;
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -303,13 +870,15 @@ void LibEpdSetChFont(unsigned char font)
     s_frame_buff[8] = END_3;
     s_frame_buff[9] = _checksum(s_frame_buff, 9);
 
-    DrvUartPutchars(s_frame_buff, 10);
+    _Send(s_frame_buff, 10);
 }
 
 /* Draw single pixel */
 // TODO: should be int16
 void LibEpdDrawPixel(int x0, int y0)
 {
+    _Map(&x0, &y0);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -328,13 +897,16 @@ void LibEpdDrawPixel(int x0, int y0)
     s_frame_buff[11] = END_3;
     s_frame_buff[12] = _checksum(s_frame_buff, 12);
 
-    DrvUartPutchars(s_frame_buff, 13);
+    _Send(s_frame_buff, 13);
 }
 
 /* Draw line */
 // TODO: Should be int16
 void LibEpdDrawLine(int x0, int y0, int x1, int y1)
 {
+    _Map(&x0, &y0);
+    _Map(&x1, &y1);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -357,13 +929,18 @@ void LibEpdDrawLine(int x0, int y0, int x1, int y1)
     s_frame_buff[15] = END_3;
     s_frame_buff[16] = _checksum(s_frame_buff, 16);
 
-    DrvUartPutchars(s_frame_buff, 17);
+    _Send(s_frame_buff, 17);
 }
 
 /* Fill rectangle */
 // TODO: should be int16
 void LibEpdFillRect(int x0, int y0, int x1, int y1)
 {
+    _Map(&x0, &y0);
+    _Map(&x1, &y1);
+    _Order(&x0, &x1);
+    _Order(&y0, &y1);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -386,13 +963,15 @@ void LibEpdFillRect(int x0, int y0, int x1, int y1)
     s_frame_buff[15] = END_3;
     s_frame_buff[16] = _checksum(s_frame_buff, 16);
 
-    DrvUartPutchars(s_frame_buff, 17);
+    _Send(s_frame_buff, 17);
 }
 
 /* Draw circle */
 // TODO: should be int16
 void LibEpdDrawCircle(int x0, int y0, int r)
 {
+    _Map(&x0, &y0);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -413,13 +992,15 @@ void LibEpdDrawCircle(int x0, int y0, int r)
     s_frame_buff[13] = END_3;
     s_frame_buff[14] = _checksum(s_frame_buff, 14);
 
-    DrvUartPutchars(s_frame_buff, 15);
+    _Send(s_frame_buff, 15);
 }
 
 /* Fill circle */
 // TODO: should be int16
 void LibEpdFillCircle(int x0, int y0, int r)
 {
+    _Map(&x0, &y0);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -440,13 +1021,17 @@ void LibEpdFillCircle(int x0, int y0, int r)
     s_frame_buff[13] = END_3;
     s_frame_buff[14] = _checksum(s_frame_buff, 14);
 
-    DrvUartPutchars(s_frame_buff, 15);
+    _Send(s_frame_buff, 15);
 }
 
 /* Draw triangle */
 // TODO: should be int16
 void LibEpdDrawTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
 {
+    _Map(&x0, &y0);
+    _Map(&x1, &y1);
+    _Map(&x2, &y2);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -473,13 +1058,17 @@ void LibEpdDrawTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
     s_frame_buff[19] = END_3;
     s_frame_buff[20] = _checksum(s_frame_buff, 20);
 
-    DrvUartPutchars(s_frame_buff, 21);
+    _Send(s_frame_buff, 21);
 }
 
 /* Fill triangle */
 // TODO: should be int16
 void LibEpdFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
 {
+    _Map(&x0, &y0);
+    _Map(&x1, &y1);
+    _Map(&x2, &y2);
+
     s_frame_buff[0] = START;
 
     s_frame_buff[1] = 0x00;
@@ -506,7 +1095,7 @@ void LibEpdFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2)
     s_frame_buff[19] = END_3;
     s_frame_buff[20] = _checksum(s_frame_buff, 20);
 
-    DrvUartPutchars(s_frame_buff, 21);
+    _Send(s_frame_buff, 21);
 }
 
 /* Clear screen using the background colour */
@@ -525,7 +1114,7 @@ void LibEpdClear(void)
     s_frame_buff[7] = END_3;
     s_frame_buff[8] = _checksum(s_frame_buff, 8);
 
-    DrvUartPutchars(s_frame_buff, 9);
+    _Send(s_frame_buff, 9);
 }
 
 /* Display a single char */
@@ -547,6 +1136,7 @@ void LibEpdDispString(const void * p, int x0, int y0)
     int string_size;
     unsigned char * ptr = (unsigned char *) p;
 
+    _Map(&x0, &y0);
     string_size = strlen((const char *) ptr);
     string_size += 14;
 
@@ -572,7 +1162,45 @@ void LibEpdDispString(const void * p, int x0, int y0)
     s_frame_buff[string_size + 3] = END_3;
     s_frame_buff[string_size + 4] = _checksum(s_frame_buff, string_size + 4);
 
-    DrvUartPutchars(s_frame_buff, string_size + 5);
+    _Send(s_frame_buff, string_size + 5);
+}
+
+/* Display UTF-8 text, converted to GBK straight into the frame.
+ * Text longer than a frame holds is cut at a character boundary.
+ * Returns the number of GBK bytes sent */
+int LibEpdDispStringUtf8(const char * utf8, int x0, int y0)
+{
+    int string_size;
+    int len;
+
+    _Map(&x0, &y0);
+    /* 8 bytes of header, the NUL and 5 bytes of trailer around the text */
+    len = LibGbkFromUtf8(utf8, &s_frame_buff[8], FRAME_BUFF_SIZE - 13);
+    string_size = len + 14;
+
+    s_frame_buff[0] = START;
+
+    s_frame_buff[1] = (string_size >> 8) & 0xFF;
+    s_frame_buff[2] = string_size & 0xFF;
+
+    s_frame_buff[3] = CMD_DRAW_STRING;
+
+    s_frame_buff[4] = (x0 >> 8) & 0xFF;
+    s_frame_buff[5] = x0 & 0xFF;
+    s_frame_buff[6] = (y0 >> 8) & 0xFF;
+    s_frame_buff[7] = y0 & 0xFF;
+
+    string_size -= 5;
+
+    s_frame_buff[string_size] = END_0;
+    s_frame_buff[string_size + 1] = END_1;
+    s_frame_buff[string_size + 2] = END_2;
+    s_frame_buff[string_size + 3] = END_3;
+    s_frame_buff[string_size + 4] = _checksum(s_frame_buff, string_size + 4);
+
+    _Send(s_frame_buff, string_size + 5);
+
+    return len;
 }
 
 /* Display BMP. Bitmap file name string maximum length is 11 */
@@ -582,6 +1210,7 @@ void LibEpdDispBitmap(const void * p, int x0, int y0)
     int string_size;
     unsigned char * ptr = (unsigned char *) p;
 
+    _Map(&x0, &y0);
     string_size = strlen((const char *) ptr);
     string_size += 14;
 
@@ -607,6 +1236,6 @@ void LibEpdDispBitmap(const void * p, int x0, int y0)
     s_frame_buff[string_size + 3] = END_3;
     s_frame_buff[string_size + 4] = _checksum(s_frame_buff, string_size + 4);
 
-    DrvUartPutchars(s_frame_buff, string_size + 5);
+    _Send(s_frame_buff, string_size + 5);
 }
 
@@ -86,18 +86,87 @@
 #define    EPD_NORMAL                         0              //screen normal
 #define    EPD_INVERSION                      1              //screen inversion
 
+/* Orientation done by the library */
+#define    EPD_ROTATE_0                       0
+#define    EPD_ROTATE_90                      1              //content turned clockwise
+#define    EPD_ROTATE_180                     2
+#define    EPD_ROTATE_270                     3              //content turned anticlockwise
+
+/* Panel size in pixels */
+#define    EPD_WIDTH                          800
+#define    EPD_HEIGHT                         600
+
+/* Value of a setting that was never sent */
+#define    EPD_UNKNOWN                        0xFF
+
+/* sysfs GPIO driving the wake up pin, -1 when it is not wired. Not wired by default on any
+ * platform: opt in with -DEPD_WAKEUP_GPIO=n or LibEpdSetWakeupGpio() (60 for P9_12 on the BBB) */
+#ifndef EPD_WAKEUP_GPIO
+#define    EPD_WAKEUP_GPIO                    -1
+#endif
+
+/* Settings of the e-paper as last encoded by this process */
+typedef struct
+{
+    long baud;
+    unsigned char mem_mode;
+    unsigned char rotation;
+    unsigned char en_font;
+    unsigned char ch_font;
+    unsigned char color;
+    unsigned char bkcolor;
+} lib_epd_state_t;
+
+/* Layer frames pass through on their way to the UART, set with LibEpdSetLayer() */
+typedef struct
+{
+    int (*write)(const unsigned char * ptr, int n);     /* Whole frames, returns n or -1 */
+    int (*flush)(void);         /* Called before a handshake, NULL if nothing to do */
+} lib_epd_layer_t;
+
+/* Layers, in the order frames pass them */
+#define    EPD_LAYER_POWER                    0
+#define    EPD_LAYER_SKIP                     1
+#define    EPD_LAYER_LINK                     2
+#define    EPD_LAYERS                         3
+
+/* Scene: encoded frames recorded back to back instead of being sent */
+typedef struct
+{
+    unsigned char * data;   /* Recorded frames */
+    int len;                /* Bytes in use */
+    int size;               /* Bytes allocated */
+    int frames;             /* Number of frames recorded */
+} lib_epd_scene_t;
+
 void LibEpdInit(void);
+int LibEpdInitSpeed(int speed);
+int LibEpdInitDev(const char * dev_name, int speed);
+int LibEpdSetLowLatency(int on);
+long long LibEpdDrain(void);
+void LibEpdGetState(lib_epd_state_t * state);
+void LibEpdSetState(const lib_epd_state_t * state);
+void LibEpdGetSentState(lib_epd_state_t * state);
+void LibEpdSetSentState(const lib_epd_state_t * state);
+void LibEpdNoteSent(const unsigned char * ptr, int n);
 void LibEpdClose(void);
 void LibEpdReset(void);
 void LibEpdWakeup(void);
+int LibEpdSetWakeupGpio(int gpio);
+int LibEpdWakeupWired(void);
 
-void LibEpdHandshake(void);
+int LibEpdHandshake(void);
+int LibEpdWaitReady(void);
+int LibEpdWaitReadyUs(long timeout_us);
 void LibEpdSetBaud(long baud);
 void lib_epd_read_baud(void);
 void LibEpdSetMemory(unsigned char mode);
 void LibEpdEnterStopMode(void);
 void LibEpdUpdate(void);
 void LibEpdScreenRotation(unsigned char mode);
+void LibEpdSetOrientation(int orientation);
+int LibEpdGetOrientation(void);
+int LibEpdTextNeedsHost(void);
 void LibEpdLoadFont(void);
 void LibEpdLoadPic(void);
 
@@ -116,8 +185,26 @@ void LibEpdClear(void);
 
 void LibEpdDispChar(unsigned char ch, int x0, int y0);
 void LibEpdDispString(const void * p, int x0, int y0);
+int LibEpdDispStringUtf8(const char * utf8, int x0, int y0);
 
 void LibEpdDispBitmap(const void * p, int x0, int y0);
 
+int LibEpdFrameLen(const unsigned char * ptr);
+int LibEpdFrameValid(const unsigned char * ptr, int n);
+int LibEpdSendFrames(const unsigned char * ptr, int n);
+
+void LibEpdSetLayer(int layer, const lib_epd_layer_t * ops);
+int LibEpdWrite(const unsigned char * ptr, int n);
+int LibEpdWriteAfter(int layer, const unsigned char * ptr, int n);
+
+void LibEpdSceneInit(lib_epd_scene_t * scene);
+void LibEpdSceneFree(lib_epd_scene_t * scene);
+void LibEpdSceneReset(lib_epd_scene_t * scene);
+int LibEpdSceneAppend(lib_epd_scene_t * scene, const unsigned char * ptr, int n);
+int LibEpdSceneCopy(lib_epd_scene_t * dst, const lib_epd_scene_t * src);
+void LibEpdSceneBegin(lib_epd_scene_t * scene);
+void LibEpdSceneEnd(void);
+int LibEpdSceneSend(const lib_epd_scene_t * scene);
+
 #endif
 
@@ -0,0 +1,333 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_chart.c
+ * @brief   Charts drawn with the e-paper primitives.
+ *
+ *          A series longer than the chart is wide is reduced to the min, max and last value of
+ *          each pixel column before anything is encoded. Each column is then drawn as one
+ *          vertical line covering its min..max and the last value of the previous column, which
+ *          keeps the trace connected; flat stretches are merged into one horizontal line.
+ *          So a chart costs at most one CMD_DRAW_LINE per pixel column, however long the series.
+ *
+ *          The min/max kernel uses SSE or NEON when the compiler targets them.
+ *          The drawing functions return the number of frames they sent.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_chart.h"
+#include "lib_epd_mem.h"
+
+#define CHART_TICK_LEN  4   /* Axis tick length in pixels */
+
+/* Min and max of n > 0 values */
+void LibEpdChartMinMax(const float * v, int n, float * min, float * max)
+{
+    float lo = v[0];
+    float hi = v[0];
+    int i = 0;
+#if defined(__SSE__)
+    __m128 vlo;
+    __m128 vhi;
+    __m128 x;
+    float tmp_lo[4];
+    float tmp_hi[4];
+
+    if (n >= 8)
+    {
+        vlo = _mm_loadu_ps(v);
+        vhi = vlo;
+        for (i = 4; i + 4 <= n; i += 4)
+        {
+            x = _mm_loadu_ps(v + i);
+            vlo = _mm_min_ps(vlo, x);
+            vhi = _mm_max_ps(vhi, x);
+        }
+        _mm_storeu_ps(tmp_lo, vlo);
+        _mm_storeu_ps(tmp_hi, vhi);
+        lo = tmp_lo[0];
+        hi = tmp_hi[0];
+        lo = (tmp_lo[1] < lo) ? tmp_lo[1] : lo;
+        lo = (tmp_lo[2] < lo) ? tmp_lo[2] : lo;
+        lo = (tmp_lo[3] < lo) ? tmp_lo[3] : lo;
+        hi = (tmp_hi[1] > hi) ? tmp_hi[1] : hi;
+        hi = (tmp_hi[2] > hi) ? tmp_hi[2] : hi;
+        hi = (tmp_hi[3] > hi) ? tmp_hi[3] : hi;
+    }
+#elif defined(__ARM_NEON)
+    float32x4_t vlo;
+    float32x4_t vhi;
+    float32x4_t x;
+    float tmp_lo[4];
+    float tmp_hi[4];
+
+    if (n >= 8)
+    {
+        vlo = vld1q_f32(v);
+        vhi = vlo;
+        for (i = 4; i + 4 <= n; i += 4)
+        {
+            x = vld1q_f32(v + i);
+            vlo = vminq_f32(vlo, x);
+            vhi = vmaxq_f32(vhi, x);
+        }
+        vst1q_f32(tmp_lo, vlo);
+        vst1q_f32(tmp_hi, vhi);
+        lo = tmp_lo[0];
+        hi = tmp_hi[0];
+        lo = (tmp_lo[1] < lo) ? tmp_lo[1] : lo;
+        lo = (tmp_lo[2] < lo) ? tmp_lo[2] : lo;
+        lo = (tmp_lo[3] < lo) ? tmp_lo[3] : lo;
+        hi = (tmp_hi[1] > hi) ? tmp_hi[1] : hi;
+        hi = (tmp_hi[2] > hi) ? tmp_hi[2] : hi;
+        hi = (tmp_hi[3] > hi) ? tmp_hi[3] : hi;
+    }
+#endif
+    for (; i < n; i++)
+    {
+        lo = (v[i] < lo) ? v[i] : lo;
+        hi = (v[i] > hi) ? v[i] : hi;
+    }
+    *min = lo;
+    *max = hi;
+}
+
+/* Reduce n values to the min, max and last value of each of the given columns.
+ * Returns the number of columns filled, which is min(n, columns). */
+int LibEpdChartDecimate(const float * v, int n, int columns, float * col_min, float * col_max,
+        float * col_last)
+{
+    int c;
+    int start;
+    int end;
+
+    if (columns > n)
+    {
+        columns = n;
+    }
+    for (c = 0, start = 0; c < columns; c++, start = end)
+    {
+        end = (int) (((long long) (c + 1) * n) / columns);
+        LibEpdChartMinMax(v + start, end - start, &col_min[c], &col_max[c]);
+        col_last[c] = v[end - 1];
+    }
+    return columns;
+}
+
+/* Screen y of a value, clamped to the chart */
+static int _Y(const lib_epd_chart_t * chart, float min, float max, float v)
+{
+    int y;
+
+    if (max <= min)
+    {
+        return chart->y1;
+    }
+    y = chart->y1 - (int) ((v - min) * (chart->y1 - chart->y0) / (max - min) + 0.5f);
+    if (y < chart->y0)
+    {
+        y = chart->y0;
+    } else if (y > chart->y1)
+    {
+        y = chart->y1;
+    }
+    return y;
+}
+
+static void _Range(const lib_epd_chart_t * chart, const float * v, int n, float * min,
+        float * max)
+{
+    if (chart->min < chart->max)
+    {
+        *min = chart->min;
+        *max = chart->max;
+    } else
+    {
+        LibEpdChartMinMax(v, n, min, max);
+    }
+}
+
+/* Line chart: straight segments if the series fits, one line per column otherwise */
+int LibEpdChartLine(const lib_epd_chart_t * chart, const float * v, int n)
+{
+    int width = chart->x1 - chart->x0 + 1;
+    int frames = 0;
+    float min;
+    float max;
+    float * col;
+    int columns;
+    int c;
+    int x;
+    int y;
+    int lo;
+    int hi;
+    int prev;
+    int run_x = -1;
+    int run_y = 0;
+    int x_prev = 0;
+    int y_prev = 0;
+
+    if ((n <= 0) || (width <= 0))
+    {
+        return 0;
+    }
+    _Range(chart, v, n, &min, &max);
+
+    if (n <= width)
+    {
+        for (c = 0; c < n; c++)
+        {
+            x = chart->x0 + ((n > 1) ? (int) ((long long) c * (width - 1) / (n - 1)) : 0);
+            y = _Y(chart, min, max, v[c]);
+            if (n == 1)
+            {
+                LibEpdDrawPixel(x, y);
+                frames++;
+            } else if (c > 0)
+            {
+                LibEpdDrawLine(x_prev, y_prev, x, y);
+                frames++;
+            }
+            x_prev = x;
+            y_prev = y;
+        }
+        return frames;
+    }
+
+    col = LibEpdMemAlloc(EPD_MEM_SCRATCH, 3 * width * sizeof(float));
+    if (col == NULL)
+    {
+        return 0;
+    }
+    columns = LibEpdChartDecimate(v, n, width, col, col + width, col + 2 * width);
+
+    prev = -1;
+    for (c = 0; c < columns; c++)
+    {
+        x = chart->x0 + c;
+        lo = _Y(chart, min, max, col[width + c]);   /* Max value is the top pixel */
+        hi = _Y(chart, min, max, col[c]);
+        if (prev >= 0)
+        {
+            lo = (prev < lo) ? prev : lo;
+            hi = (prev > hi) ? prev : hi;
+        }
+        prev = _Y(chart, min, max, col[2 * width + c]);
+
+        if ((lo == hi) && (run_x >= 0) && (run_y == lo))
+        {
+            continue;   /* Flat, the run goes on */
+        }
+        if (run_x >= 0)
+        {
+            LibEpdDrawLine(run_x, run_y, x - 1, run_y);
+            frames++;
+            run_x = -1;
+        }
+        if (lo == hi)
+        {
+            run_x = x;
+            run_y = lo;
+        } else
+        {
+            LibEpdDrawLine(x, lo, x, hi);
+            frames++;
+        }
+    }
+    if (run_x >= 0)
+    {
+        LibEpdDrawLine(run_x, run_y, chart->x0 + columns - 1, run_y);
+        frames++;
+    }
+
+    LibEpdMemFree(EPD_MEM_SCRATCH, col);
+    return frames;
+}
+
+/* Small line chart without axes, scaled to its own data */
+int LibEpdChartSparkline(int x0, int y0, int x1, int y1, const float * v, int n)
+{
+    lib_epd_chart_t chart;
+
+    chart.x0 = x0;
+    chart.y0 = y0;
+    chart.x1 = x1;
+    chart.y1 = y1;
+    chart.min = 0.0f;
+    chart.max = 0.0f;
+
+    return LibEpdChartLine(&chart, v, n);
+}
+
+/* Bar chart, one CMD_FILL_RECT per bar. Bars grow from 0, or from min if 0 is out of range */
+int LibEpdChartBars(const lib_epd_chart_t * chart, const float * v, int n, int gap)
+{
+    int width = chart->x1 - chart->x0 + 1;
+    int frames = 0;
+    int bar;
+    int base;
+    int x;
+    int y;
+    int i;
+    float min;
+    float max;
+
+    if (n <= 0)
+    {
+        return 0;
+    }
+    bar = (width - gap * (n - 1)) / n;
+    if (bar <= 0)
+    {
+        return 0;
+    }
+    _Range(chart, v, n, &min, &max);
+    base = _Y(chart, min, max, (min < 0.0f && max > 0.0f) ? 0.0f : min);
+
+    for (i = 0; i < n; i++)
+    {
+        x = chart->x0 + i * (bar + gap);
+        y = _Y(chart, min, max, v[i]);
+        if (y == base)
+        {
+            continue;
+        }
+        LibEpdFillRect(x, (y < base) ? y : base, x + bar - 1, (y < base) ? base : y);
+        frames++;
+    }
+    return frames;
+}
+
+/* Left and bottom axes with evenly spaced ticks outside the plot area */
+int LibEpdChartAxes(const lib_epd_chart_t * chart, int x_ticks, int y_ticks)
+{
+    int frames = 2;
+    int i;
+    int pos;
+
+    LibEpdDrawLine(chart->x0, chart->y0, chart->x0, chart->y1);
+    LibEpdDrawLine(chart->x0, chart->y1, chart->x1, chart->y1);
+
+    for (i = 0; i < x_ticks; i++)
+    {
+        pos = chart->x0 + ((x_ticks > 1) ? (chart->x1 - chart->x0) * i / (x_ticks - 1) : 0);
+        LibEpdDrawLine(pos, chart->y1, pos, chart->y1 + CHART_TICK_LEN);
+        frames++;
+    }
+    for (i = 0; i < y_ticks; i++)
+    {
+        pos = chart->y1 - ((y_ticks > 1) ? (chart->y1 - chart->y0) * i / (y_ticks - 1) : 0);
+        LibEpdDrawLine(chart->x0 - CHART_TICK_LEN, pos, chart->x0, pos);
+        frames++;
+    }
+    return frames;
+}
@@ -0,0 +1,34 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_chart.h
+ * @brief   API of the charts drawn with the e-paper primitives.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_CHART_H
+#define LIB_EPD_CHART_H
+
+/* Chart area and value range */
+typedef struct
+{
+    int x0;             /* Plot area, corners included */
+    int y0;
+    int x1;
+    int y1;
+    float min;          /* Value at the bottom, auto from the data if min >= max */
+    float max;          /* Value at the top */
+} lib_epd_chart_t;
+
+void LibEpdChartMinMax(const float * v, int n, float * min, float * max);
+int LibEpdChartDecimate(const float * v, int n, int columns, float * col_min, float * col_max,
+        float * col_last);
+
+int LibEpdChartLine(const lib_epd_chart_t * chart, const float * v, int n);
+int LibEpdChartSparkline(int x0, int y0, int x1, int y1, const float * v, int n);
+int LibEpdChartBars(const lib_epd_chart_t * chart, const float * v, int n, int gap);
+int LibEpdChartAxes(const lib_epd_chart_t * chart, int x_ticks, int y_ticks);
+
+#endif
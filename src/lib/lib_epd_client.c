@@ -0,0 +1,237 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_client.c
+ * @brief   Client side of the display daemon.
+ *
+ *          The client draws with the usual LibEpd* calls between LibEpdClientBegin() and
+ *          LibEpdClientCommit(). The frames are recorded locally and copied once into the
+ *          shared-memory ring; the socket only carries a one byte doorbell.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_daemon.h"
+#include "lib_epd_client.h"
+
+static int s_sock = -1;
+static lib_epd_ring_t * s_ring = NULL;
+static lib_epd_scene_t s_build;
+
+/* Create the ring in an unlinked shared-memory object. Returns its fd, or -1 */
+static int _RingCreate(void)
+{
+    char name[64];
+    int fd;
+
+    snprintf(name, sizeof(name), "/epd-ring-%d", (int) getpid());
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+    {
+        perror("LibEpdClientOpen: shm_open");
+        return -1;
+    }
+    shm_unlink(name);
+
+    if (ftruncate(fd, sizeof(lib_epd_ring_t)) != 0)
+    {
+        perror("LibEpdClientOpen: ftruncate");
+        close(fd);
+        return -1;
+    }
+    s_ring = mmap(NULL, sizeof(lib_epd_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (s_ring == MAP_FAILED)
+    {
+        perror("LibEpdClientOpen: mmap");
+        s_ring = NULL;
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Pass the ring fd to the daemon */
+static int _SendHello(int fd)
+{
+    struct msghdr msg;
+    struct iovec iov;
+    struct cmsghdr * cmsg;
+    char cbuf[CMSG_SPACE(sizeof(int))];
+    char hello = EPD_MSG_HELLO;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(cbuf, 0, sizeof(cbuf));
+    iov.iov_base = &hello;
+    iov.iov_len = 1;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+
+    cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    return (sendmsg(s_sock, &msg, 0) == 1) ? TRUE : FALSE;
+}
+
+/* Copy one frame into the ring, waiting for space if needed */
+static int _Push(const unsigned char * ptr, int n)
+{
+    unsigned int head;
+    unsigned int tail;
+    unsigned int off;
+    unsigned int part;
+    char msg;
+
+    if (n > EPD_RING_SIZE)
+    {
+        return FALSE;
+    }
+
+    head = s_ring->head;
+    for (;;)
+    {
+        tail = __atomic_load_n(&s_ring->tail, __ATOMIC_ACQUIRE);
+        if (EPD_RING_SIZE - (head - tail) >= (unsigned int) n)
+        {
+            break;
+        }
+        /* Announce the wait, then look again in case the daemon freed space meanwhile */
+        __atomic_store_n(&s_ring->waiting, 1, __ATOMIC_SEQ_CST);
+        tail = __atomic_load_n(&s_ring->tail, __ATOMIC_SEQ_CST);
+        if (EPD_RING_SIZE - (head - tail) >= (unsigned int) n)
+        {
+            continue;
+        }
+        msg = EPD_MSG_DOORBELL;
+        if (write(s_sock, &msg, 1) != 1 || read(s_sock, &msg, 1) != 1)
+        {
+            return FALSE;
+        }
+    }
+
+    off = head & (EPD_RING_SIZE - 1);
+    part = EPD_RING_SIZE - off;
+    if (part >= (unsigned int) n)
+    {
+        memcpy(&s_ring->data[off], ptr, n);
+    } else
+    {
+        memcpy(&s_ring->data[off], ptr, part);
+        memcpy(&s_ring->data[0], ptr + part, n - part);
+    }
+    __atomic_store_n(&s_ring->head, head + n, __ATOMIC_RELEASE);
+
+    return TRUE;
+}
+
+/* Connect to the daemon and hand over a fresh ring. Returns TRUE on success */
+int LibEpdClientOpen(const char * sock_path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    s_sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s_sock < 0)
+    {
+        perror("LibEpdClientOpen: socket");
+        return FALSE;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, sock_path, sizeof(addr.sun_path) - 1);
+    if (connect(s_sock, (struct sockaddr *) &addr, sizeof(addr)) != 0)
+    {
+        perror("LibEpdClientOpen: connect");
+        LibEpdClientClose();
+        return FALSE;
+    }
+
+    fd = _RingCreate();
+    if (fd < 0)
+    {
+        LibEpdClientClose();
+        return FALSE;
+    }
+    if (!_SendHello(fd))
+    {
+        perror("LibEpdClientOpen: sendmsg");
+        close(fd);
+        LibEpdClientClose();
+        return FALSE;
+    }
+    close(fd);
+
+    LibEpdSceneInit(&s_build);
+    return TRUE;
+}
+
+void LibEpdClientClose(void)
+{
+    if (s_ring != NULL)
+    {
+        munmap(s_ring, sizeof(lib_epd_ring_t));
+        s_ring = NULL;
+    }
+    if (s_sock >= 0)
+    {
+        close(s_sock);
+        s_sock = -1;
+    }
+    LibEpdSceneFree(&s_build);
+}
+
+/* Start recording a scene for the daemon */
+void LibEpdClientBegin(void)
+{
+    LibEpdSceneReset(&s_build);
+    LibEpdSceneBegin(&s_build);
+}
+
+/* Close the scene with an update and submit it. Returns TRUE on success */
+int LibEpdClientCommit(void)
+{
+    LibEpdUpdate();
+    LibEpdSceneEnd();
+
+    return LibEpdClientSubmit(s_build.data, s_build.len);
+}
+
+/* Submit pre-encoded frames. The daemon shows them with the next CMD_UPDATE frame.
+ * Returns TRUE on success */
+int LibEpdClientSubmit(const unsigned char * ptr, int n)
+{
+    char msg = EPD_MSG_DOORBELL;
+    int off = 0;
+    int len;
+
+    if (s_ring == NULL)
+    {
+        return FALSE;
+    }
+    while (off + 3 <= n)
+    {
+        len = LibEpdFrameLen(ptr + off);
+        if ((len <= 3) || (off + len > n))
+        {
+            fprintf(stderr, "LibEpdClientSubmit: malformed frame at %d\n", off);
+            return FALSE;
+        }
+        if (!_Push(ptr + off, len))
+        {
+            return FALSE;
+        }
+        off += len;
+    }
+
+    return (write(s_sock, &msg, 1) == 1) ? TRUE : FALSE;
+}
@@ -0,0 +1,21 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_client.h
+ * @brief   API of the client side of the display daemon.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_CLIENT_H
+#define LIB_EPD_CLIENT_H
+
+int LibEpdClientOpen(const char * sock_path);
+void LibEpdClientClose(void);
+
+void LibEpdClientBegin(void);
+int LibEpdClientCommit(void);
+int LibEpdClientSubmit(const unsigned char * ptr, int n);
+
+#endif
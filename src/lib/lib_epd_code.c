@@ -0,0 +1,261 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_code.c
+ * @brief   QR codes and barcodes drawn on the e-paper screen.
+ *
+ *          A module bitmap is covered by maximal rectangles of dark modules, each one sent as a
+ *          single fill rectangle frame. Rectangles may overlap, since dark over dark is free.
+ *          Light modules are not drawn: the area, quiet zone included, must already be blank.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_code.h"
+
+/* Code128 symbol widths, bar first, for values 0 to 105 */
+static const char * const c_code128[106] =
+{
+    "212222", "222122", "222221", "121223", "121322", "131222", "122213", "122312", "132212",
+    "221213", "221312", "231212", "112232", "122132", "122231", "113222", "123122", "123221",
+    "223211", "221132", "221231", "213212", "223112", "312131", "311222", "321122", "321221",
+    "312212", "322112", "322211", "212123", "212321", "232121", "111323", "131123", "131321",
+    "112313", "132113", "132311", "211313", "231113", "231311", "112133", "112331", "132131",
+    "113123", "113321", "133121", "313121", "211331", "231131", "213113", "213311", "213131",
+    "311123", "311321", "331121", "312113", "312311", "332111", "314111", "221411", "431111",
+    "111224", "111422", "121124", "121421", "141122", "141221", "112214", "112412", "122114",
+    "122411", "142112", "142211", "241211", "221114", "413111", "241112", "134111", "111242",
+    "121142", "121241", "114212", "124112", "124211", "411212", "421112", "421211", "212141",
+    "214121", "412121", "111143", "111341", "131141", "114113", "114311", "411113", "411311",
+    "113141", "114131", "311141", "411131", "211412", "211214", "211232",
+};
+static const char c_code128_stop[] = "2331112";
+
+#define CODE128_START_B     104
+#define CODE128_START_C     105
+
+static unsigned char s_modules[QR_MAX_SIZE * QR_MAX_SIZE];
+static unsigned char s_covered[QR_MAX_SIZE * QR_MAX_SIZE];
+
+/* Dark modules of the rectangle not covered yet */
+static int _Gain(int w, int x, int y, int rw, int rh)
+{
+    int gain = 0;
+    int i;
+    int j;
+
+    for (j = y; j < y + rh; j++)
+    {
+        for (i = x; i < x + rw; i++)
+        {
+            gain += !s_covered[j * w + i];
+        }
+    }
+    return gain;
+}
+
+static int _RowDark(const unsigned char * modules, int w, int x, int y, int rw)
+{
+    int i;
+
+    for (i = x; i < x + rw; i++)
+    {
+        if (!modules[y * w + i])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static int _ColumnDark(const unsigned char * modules, int w, int x, int y, int rh)
+{
+    int j;
+
+    for (j = y; j < y + rh; j++)
+    {
+        if (!modules[j * w + x])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Draw a bitmap of modules (1 = dark, w * h bytes, at most QR_MAX_SIZE squared) with the current
+ * color, each module being scale_x by scale_y pixels.
+ * Returns the number of frames sent, -1 if the bitmap is too large */
+int LibEpdCodeDraw(const unsigned char * modules, int w, int h, int x0, int y0,
+        int scale_x, int scale_y, lib_epd_code_stats_t * stats)
+{
+    lib_epd_code_stats_t st;
+    int x;
+    int y;
+    int hw;
+    int hh;
+    int vw;
+    int vh;
+    int rw;
+    int rh;
+    int j;
+
+    if ((w <= 0) || (h <= 0) || (w * h > (int) sizeof(s_covered)) || (scale_x <= 0) || (scale_y <= 0))
+    {
+        return -1;
+    }
+
+    memset(&st, 0, sizeof(st));
+    memset(s_covered, 0, w * h);
+    for (y = 0; y < h; y++)
+    {
+        for (x = 0; x < w; x++)
+        {
+            if (modules[y * w + x])
+            {
+                st.modules++;
+                if ((x == 0) || !modules[y * w + x - 1])
+                {
+                    st.runs++;
+                }
+            }
+        }
+    }
+
+    for (y = 0; y < h; y++)
+    {
+        for (x = 0; x < w; x++)
+        {
+            if (!modules[y * w + x] || s_covered[y * w + x])
+            {
+                continue;
+            }
+
+            /* Widest run first, then as many rows of it as possible */
+            for (hw = 1; (x + hw < w) && modules[y * w + x + hw]; hw++)
+            {
+            }
+            for (hh = 1; (y + hh < h) && _RowDark(modules, w, x, y + hh, hw); hh++)
+            {
+            }
+            /* Tallest run first, then as many columns of it as possible */
+            for (vh = 1; (y + vh < h) && modules[(y + vh) * w + x]; vh++)
+            {
+            }
+            for (vw = 1; (x + vw < w) && _ColumnDark(modules, w, x + vw, y, vh); vw++)
+            {
+            }
+
+            if (_Gain(w, x, y, hw, hh) >= _Gain(w, x, y, vw, vh))
+            {
+                rw = hw;
+                rh = hh;
+            }
+            else
+            {
+                rw = vw;
+                rh = vh;
+            }
+            for (j = y; j < y + rh; j++)
+            {
+                memset(&s_covered[j * w + x], 1, rw);
+            }
+
+            LibEpdFillRect(x0 + x * scale_x, y0 + y * scale_y,
+                    x0 + (x + rw) * scale_x - 1, y0 + (y + rh) * scale_y - 1);
+            st.rects++;
+        }
+    }
+
+    if (stats != NULL)
+    {
+        *stats = st;
+    }
+    return st.rects;
+}
+
+/* Draw a QR code of the text, top left corner at (x0, y0), scale pixels per module.
+ * Leave 4 blank modules around it for the quiet zone.
+ * Returns the number of frames sent, -1 if the text does not fit */
+int LibEpdQrDraw(const char * text, int ecl, int x0, int y0, int scale,
+        lib_epd_code_stats_t * stats)
+{
+    int size;
+
+    size = LibQrEncode((const unsigned char *) text, strlen(text), ecl, -1, s_modules);
+    if (size == 0)
+    {
+        return -1;
+    }
+    return LibEpdCodeDraw(s_modules, size, size, x0, y0, scale, scale, stats);
+}
+
+/* Append a symbol to the barcode modules, returns the new width */
+static int _Code128Put(int x, const char * widths)
+{
+    int dark = TRUE;
+    int n;
+
+    for (; *widths != '\0'; widths++, dark = !dark)
+    {
+        for (n = *widths - '0'; n > 0; n--)
+        {
+            s_modules[x++] = dark;
+        }
+    }
+    return x;
+}
+
+/* Draw a Code128 barcode of the text (printable ASCII), top left corner at (x0, y0).
+ * Digits only text of even length uses code set C, anything else code set B.
+ * Leave 10 blank modules on each side for the quiet zone.
+ * Returns the number of frames sent, -1 if the text cannot be encoded */
+int LibEpdCode128Draw(const char * text, int x0, int y0, int module_w, int height,
+        lib_epd_code_stats_t * stats)
+{
+    int len = strlen(text);
+    int digits = TRUE;
+    int sum;
+    int value;
+    int weight;
+    int x;
+    int i;
+
+    if ((len == 0) || (len > EPD_CODE128_MAX))
+    {
+        return -1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        if ((text[i] < 0x20) || (text[i] > 0x7E))
+        {
+            return -1;
+        }
+        digits = digits && (text[i] >= '0') && (text[i] <= '9');
+    }
+    digits = digits && (len % 2 == 0);
+
+    sum = digits ? CODE128_START_C : CODE128_START_B;
+    x = _Code128Put(0, c_code128[sum]);
+    for (i = 0, weight = 1; i < len; weight++)
+    {
+        if (digits)
+        {
+            value = (text[i] - '0') * 10 + (text[i + 1] - '0');
+            i += 2;
+        }
+        else
+        {
+            value = text[i] - 0x20;
+            i++;
+        }
+        sum += value * weight;
+        x = _Code128Put(x, c_code128[value]);
+    }
+    x = _Code128Put(x, c_code128[sum % 103]);
+    x = _Code128Put(x, c_code128_stop);
+
+    return LibEpdCodeDraw(s_modules, x, 1, x0, y0, module_w, height, stats);
+}
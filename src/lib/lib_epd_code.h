@@ -0,0 +1,35 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_code.h
+ * @brief   API of the QR codes and barcodes drawn on the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_CODE_H
+#define LIB_EPD_CODE_H
+
+#include "lib_qr.h"
+
+/* Longest text accepted by LibEpdCode128Draw() */
+#define    EPD_CODE128_MAX                    80
+
+/* Frame counts of the last drawing */
+typedef struct
+{
+    int modules;        /* Dark modules, frames needed with one rectangle per module */
+    int runs;           /* Horizontal runs of dark modules, frames needed with one per run */
+    int rects;          /* Rectangles actually sent */
+} lib_epd_code_stats_t;
+
+int LibEpdCodeDraw(const unsigned char * modules, int w, int h, int x0, int y0,
+        int scale_x, int scale_y, lib_epd_code_stats_t * stats);
+
+int LibEpdQrDraw(const char * text, int ecl, int x0, int y0, int scale,
+        lib_epd_code_stats_t * stats);
+int LibEpdCode128Draw(const char * text, int x0, int y0, int module_w, int height,
+        lib_epd_code_stats_t * stats);
+
+#endif
@@ -0,0 +1,180 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_cost.c
+ * @brief   Time cost model of frames and scenes.
+ *
+ *          cost(frame) = wire time + device time
+ *          wire time   = bytes * bits per byte / baud, with the start, parity and stop bits of
+ *                        the line as set up by DrvUartInit()
+ *          device time = base(cmd) + data bytes * per byte(cmd)
+ *
+ *          The per-opcode costs start from rough defaults and are meant to be calibrated
+ *          against the real e-paper with LibEpdCostCalibrate(), e.g. from the time between
+ *          sending a frame and the handshake reply that follows it.
+ *
+ *          Layout code can ask for the cost of a recorded scene before sending it and drop
+ *          details until it fits a budget; encoders can compare equivalent frames.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_cost.h"
+#include "drv_uart.h"
+
+#define COST_FRAME_OVERHEAD     9       /* Start, length, cmd, end and checksum bytes */
+#define COST_DEFAULT_US         1000    /* Opcodes without a better guess */
+
+typedef struct
+{
+    unsigned char cmd;
+    long base_us;
+    long byte_us;
+} cost_default_t;
+
+/* Defaults, to be calibrated */
+static const cost_default_t c_cost_defaults[] =
+{
+    { CMD_HANDSHAKE,        1000,       0 },
+    { CMD_SET_BAUD,         10000,      0 },
+    { CMD_SET_MEM_MODE,     1000,       0 },
+    { CMD_STOP_MODE,        1000,       0 },
+    { CMD_UPDATE,           3000000,    0 },
+    { CMD_SET_SCR_ROTATION, 1000,       0 },
+    { CMD_LOAD_FONT,        10000000,   0 },
+    { CMD_LOAD_PIC,         10000000,   0 },
+    { CMD_SET_COLOR,        500,        0 },
+    { CMD_SET_EN_FONT,      500,        0 },
+    { CMD_SET_CH_FONT,      500,        0 },
+    { CMD_DRAW_PIXEL,       500,        0 },
+    { CMD_DRAW_LINE,        1000,       0 },
+    { CMD_FILL_RECT,        3000,       0 },
+    { CMD_DRAW_CIRCLE,      2000,       0 },
+    { CMD_FILL_CIRCLE,      4000,       0 },
+    { CMD_DRAW_TRIANGLE,    2000,       0 },
+    { CMD_FILL_TRIANGLE,    4000,       0 },
+    { CMD_CLEAR,            20000,      0 },
+    { CMD_DRAW_STRING,      1000,       1500 },
+    { CMD_DRAW_BITMAP,      200000,     0 },
+};
+
+static long s_base_us[256];
+static long s_byte_us[256];
+static int s_loaded = FALSE;
+
+static void _LoadDefaults(void)
+{
+    int i;
+
+    for (i = 0; i < 256; i++)
+    {
+        s_base_us[i] = COST_DEFAULT_US;
+        s_byte_us[i] = 0;
+    }
+    for (i = 0; i < (int) (sizeof(c_cost_defaults) / sizeof(c_cost_defaults[0])); i++)
+    {
+        s_base_us[c_cost_defaults[i].cmd] = c_cost_defaults[i].base_us;
+        s_byte_us[c_cost_defaults[i].cmd] = c_cost_defaults[i].byte_us;
+    }
+    s_loaded = TRUE;
+}
+
+/* Payload bytes charged per byte: the text or file name of strings and bitmaps */
+static int _DataBytes(const unsigned char * frame)
+{
+    int n = LibEpdFrameLen(frame) - COST_FRAME_OVERHEAD;
+
+    if ((frame[3] == CMD_DRAW_STRING) || (frame[3] == CMD_DRAW_BITMAP))
+    {
+        n -= 5;     /* x, y and the terminating zero */
+    }
+    return (n > 0) ? n : 0;
+}
+
+static long _DeviceUs(const unsigned char * frame)
+{
+    if (!s_loaded)
+    {
+        _LoadDefaults();
+    }
+    return s_base_us[frame[3]] + _DataBytes(frame) * s_byte_us[frame[3]];
+}
+
+/* Time to shift the given number of bytes out of the UART */
+long LibEpdCostWireUs(int bytes)
+{
+    long long bits = (long long) bytes * DrvUartBitsPerByte();
+
+    return (long) ((bits * 1000000LL + DrvUartGetSpeed() - 1) / DrvUartGetSpeed());
+}
+
+/* Predicted cost of one encoded frame */
+long LibEpdCostFrameUs(const unsigned char * frame)
+{
+    return LibEpdCostWireUs(LibEpdFrameLen(frame)) + _DeviceUs(frame);
+}
+
+/* Predicted cost of a recorded scene */
+void LibEpdCostScene(const lib_epd_scene_t * scene, lib_epd_cost_t * cost)
+{
+    int off = 0;
+    int len;
+
+    memset(cost, 0, sizeof(lib_epd_cost_t));
+    while (off + 3 <= scene->len)
+    {
+        len = LibEpdFrameLen(scene->data + off);
+        if ((len <= 3) || (off + len > scene->len))
+        {
+            break;
+        }
+        cost->device_us += _DeviceUs(scene->data + off);
+        cost->frames++;
+        off += len;
+    }
+    cost->bytes = off;
+    cost->wire_us = LibEpdCostWireUs(off);
+    cost->total_us = cost->wire_us + cost->device_us;
+}
+
+/* TRUE if the scene is predicted to be done within the budget */
+int LibEpdCostFits(const lib_epd_scene_t * scene, long budget_us)
+{
+    lib_epd_cost_t cost;
+
+    LibEpdCostScene(scene, &cost);
+    return (cost.total_us <= budget_us) ? TRUE : FALSE;
+}
+
+/* Override the device cost of an opcode */
+void LibEpdCostSetOpcode(unsigned char cmd, long base_us, long byte_us)
+{
+    if (!s_loaded)
+    {
+        _LoadDefaults();
+    }
+    s_base_us[cmd] = base_us;
+    s_byte_us[cmd] = byte_us;
+}
+
+/* Feed a measured frame time (sent to acknowledged) into the model.
+ * The base cost of the opcode follows the measurements with a 1/4 moving average. */
+void LibEpdCostCalibrate(const unsigned char * frame, long measured_us)
+{
+    long device_us;
+
+    if (!s_loaded)
+    {
+        _LoadDefaults();
+    }
+    device_us = measured_us - LibEpdCostWireUs(LibEpdFrameLen(frame))
+            - _DataBytes(frame) * s_byte_us[frame[3]];
+    if (device_us < 0)
+    {
+        device_us = 0;
+    }
+    s_base_us[frame[3]] += (device_us - s_base_us[frame[3]]) / 4;
+}
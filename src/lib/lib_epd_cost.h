@@ -0,0 +1,34 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_cost.h
+ * @brief   API of the time cost model of frames and scenes.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_COST_H
+#define LIB_EPD_COST_H
+
+#include "lib_epd.h"
+
+/* Predicted cost of a scene */
+typedef struct
+{
+    int frames;
+    int bytes;
+    long wire_us;       /* Time on the wire at the current line settings */
+    long device_us;     /* Time the e-paper spends executing the frames */
+    long total_us;      /* wire_us + device_us */
+} lib_epd_cost_t;
+
+long LibEpdCostWireUs(int bytes);
+long LibEpdCostFrameUs(const unsigned char * frame);
+void LibEpdCostScene(const lib_epd_scene_t * scene, lib_epd_cost_t * cost);
+int LibEpdCostFits(const lib_epd_scene_t * scene, long budget_us);
+
+void LibEpdCostSetOpcode(unsigned char cmd, long base_us, long byte_us);
+void LibEpdCostCalibrate(const unsigned char * frame, long measured_us);
+
+#endif
@@ -0,0 +1,287 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_ctl.c
+ * @brief   Command stream interpreter of the e-paper screen (epdctl).
+ *
+ *          Reads commands, one per line, numbers in decimal:
+ *
+ *              clear                       color <fg> <bg>         font <1..3>
+ *              pixel <x> <y>               line <x0> <y0> <x1> <y1>
+ *              rect <x0> <y0> <x1> <y1>    frame <x0> <y0> <x1> <y1>   (outline)
+ *              circle <x> <y> <r>          disc <x> <y> <r>
+ *              text <x> <y> <UTF-8 text to the end of the line>
+ *              update                      sync                    quit
+ *
+ *          Blank lines and lines from '#' are skipped. A record starting with 0xA5 instead is
+ *          a frame already encoded (see lib_epd.c), taken as is once its checksum is checked,
+ *          its settings tracked as those of text commands, so binary and text commands may be
+ *          mixed.
+ *
+ *          Commands are recorded into a scene, color and font commands dropped when they would
+ *          not change the e-paper state, and the scene is sent in one piece on "update",
+ *          through the skip and link layers when enabled. Each update is answered on the
+ *          output with
+ *
+ *              update <n> <frames> <bytes> <latency_us>
+ *
+ *          the latency running from reading "update" to the last frame acknowledged with the
+ *          link open, or written otherwise. "sync" waits for the e-paper to be ready and
+ *          answers "sync <ok>". Errors go to the output as "error <line> <text>".
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_link.h"
+#include "lib_epd_shape.h"
+#include "lib_epd_ctl.h"
+
+#define CTL_ARGS_MAX        4
+
+static lib_epd_scene_t s_scene;
+static lib_epd_ctl_stats_t s_stats;
+
+/* Read up to n decimal numbers from p. Returns how many were read */
+static int _Numbers(const char ** p, int * v, int n)
+{
+    char * end;
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        v[i] = (int) strtol(*p, &end, 10);
+        if (end == *p)
+        {
+            break;
+        }
+        *p = end;
+    }
+    return i;
+}
+
+static void _Color(int fg, int bg)
+{
+    lib_epd_state_t st;
+
+    LibEpdGetState(&st);
+    if ((st.color != fg) || (st.bkcolor != bg))
+    {
+        LibEpdSetColor((unsigned char) fg, (unsigned char) bg);
+    }
+}
+
+static void _Font(int font)
+{
+    lib_epd_state_t st;
+
+    LibEpdGetState(&st);
+    if (st.en_font != font)
+    {
+        LibEpdSetEnFont((unsigned char) font);
+    }
+    if (st.ch_font != font)
+    {
+        LibEpdSetChFont((unsigned char) font);
+    }
+}
+
+/* Send the scene recorded and start a new one. Returns the time taken, -1 on failure */
+static long long _Flush(void)
+{
+    long long start = LibClockNowUs();
+    int ok;
+
+    LibEpdSceneEnd();
+    ok = LibEpdSceneSend(&s_scene);
+    if (ok && LibEpdLinkEnabled())
+    {
+        ok = LibEpdLinkFlush();
+    }
+    s_stats.bytes += s_scene.len;
+    LibEpdSceneReset(&s_scene);
+    LibEpdSceneBegin(&s_scene);
+    start = LibClockNowUs() - start;
+    s_stats.send_us += start;
+    return ok ? start : -1;
+}
+
+/* Run one text command. Returns FALSE if not understood */
+static int _Command(const char * line, FILE * out, int * quit)
+{
+    char word[16];
+    const char * p = line;
+    int v[CTL_ARGS_MAX];
+    int n;
+    int k = 0;
+    long long t;
+
+    if (sscanf(p, "%15s%n", word, &k) != 1)
+    {
+        return TRUE;
+    }
+    p += k;
+    /* Only the position for text, the string may start with digits */
+    n = _Numbers(&p, v, (strcmp(word, "text") == 0) ? 2 : CTL_ARGS_MAX);
+
+    if ((strcmp(word, "line") == 0) && (n == 4))
+    {
+        LibEpdDrawLine(v[0], v[1], v[2], v[3]);
+    }
+    else if ((strcmp(word, "rect") == 0) && (n == 4))
+    {
+        LibEpdFillRect(v[0], v[1], v[2], v[3]);
+    }
+    else if ((strcmp(word, "pixel") == 0) && (n >= 2))
+    {
+        LibEpdDrawPixel(v[0], v[1]);
+    }
+    else if ((strcmp(word, "text") == 0) && (n >= 2))
+    {
+        p += (*p == ' ') ? 1 : 0;
+        LibEpdDispStringUtf8(p, v[0], v[1]);
+    }
+    else if ((strcmp(word, "color") == 0) && (n >= 2))
+    {
+        _Color(v[0] & 0x03, v[1] & 0x03);
+    }
+    else if ((strcmp(word, "font") == 0) && (n >= 1) && (v[0] >= ASCII32) && (v[0] <= ASCII64))
+    {
+        _Font(v[0]);
+    }
+    else if ((strcmp(word, "frame") == 0) && (n == 4))
+    {
+        LibEpdDrawRoundRect(v[0], v[1], v[2], v[3], 0, NULL);
+    }
+    else if ((strcmp(word, "circle") == 0) && (n >= 3))
+    {
+        LibEpdDrawCircle(v[0], v[1], v[2]);
+    }
+    else if ((strcmp(word, "disc") == 0) && (n >= 3))
+    {
+        LibEpdFillCircle(v[0], v[1], v[2]);
+    }
+    else if (strcmp(word, "clear") == 0)
+    {
+        LibEpdClear();
+    }
+    else if (strcmp(word, "update") == 0)
+    {
+        LibEpdUpdate();
+        n = s_scene.frames;
+        k = s_scene.len;
+        t = _Flush();
+        s_stats.updates++;
+        fprintf(out, "update %lu %d %d %lld\n", s_stats.updates, n, k, t);
+        fflush(out);
+    }
+    else if (strcmp(word, "sync") == 0)
+    {
+        _Flush();
+        fprintf(out, "sync %d\n", LibEpdHandshake());
+        fflush(out);
+    }
+    else if (strcmp(word, "quit") == 0)
+    {
+        *quit = TRUE;
+    }
+    else if (word[0] != '#')
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* Read one encoded frame whose start byte was already read. Returns FALSE on a broken one */
+static int _Frame(FILE * in, FILE * out, int * quit)
+{
+    unsigned char frame[FRAME_BUFF_SIZE];
+    int len;
+
+    frame[0] = START;
+    if (fread(frame + 1, 1, 2, in) != 2)
+    {
+        return FALSE;
+    }
+    len = LibEpdFrameLen(frame);
+    if ((len <= 3) || (len > FRAME_BUFF_SIZE) || (fread(frame + 3, 1, len - 3, in) != (size_t) (len - 3)))
+    {
+        return FALSE;
+    }
+    if (frame[3] == CMD_UPDATE)
+    {
+        return _Command("update", out, quit);
+    }
+    return LibEpdSendFrames(frame, len);
+}
+
+/* Run the commands read from in until its end or "quit", answering on out.
+ * Returns EPD_CTL_DONE at the end of in, EPD_CTL_QUIT on "quit", EPD_CTL_FAILED if the e-paper
+ * could not be written */
+int LibEpdCtlRun(FILE * in, FILE * out)
+{
+    char line[EPD_CTL_LINE_MAX];
+    unsigned long line_no = 0;
+    long long start;
+    long long sent;
+    int quit = FALSE;
+    int len;
+    int c;
+
+    LibEpdSceneInit(&s_scene);
+    LibEpdSceneBegin(&s_scene);
+    while (!quit && ((c = getc(in)) != EOF))
+    {
+        start = LibClockNowUs();
+        sent = s_stats.send_us;
+        line_no++;
+        s_stats.commands++;
+        if (c == START)
+        {
+            if (!_Frame(in, out, &quit))
+            {
+                s_stats.errors++;
+                fprintf(out, "error %lu broken frame\n", line_no);
+                break;
+            }
+        }
+        else
+        {
+            ungetc(c, in);
+            if (fgets(line, sizeof(line), in) == NULL)
+            {
+                break;
+            }
+            len = (int) strlen(line);
+            while ((len > 0) && ((line[len - 1] == '\n') || (line[len - 1] == '\r')))
+            {
+                line[--len] = '\0';
+            }
+            if (!_Command(line, out, &quit))
+            {
+                s_stats.errors++;
+                fprintf(out, "error %lu %s\n", line_no, line);
+                fflush(out);
+            }
+        }
+        s_stats.parse_us += LibClockNowUs() - start - (s_stats.send_us - sent);
+    }
+
+    /* Frames drawn since the last update still go out */
+    c = (_Flush() >= 0);
+    LibEpdSceneEnd();
+    LibEpdSceneFree(&s_scene);
+    if (!c)
+    {
+        return EPD_CTL_FAILED;
+    }
+    return quit ? EPD_CTL_QUIT : EPD_CTL_DONE;
+}
+
+void LibEpdCtlGetStats(lib_epd_ctl_stats_t * stats)
+{
+    *stats = s_stats;
+}
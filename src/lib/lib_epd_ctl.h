@@ -0,0 +1,36 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_ctl.h
+ * @brief   API of the command stream interpreter of the e-paper screen (epdctl).
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_CTL_H
+#define LIB_EPD_CTL_H
+
+/* Longest text command line */
+#define    EPD_CTL_LINE_MAX                   1024
+
+/* LibEpdCtlRun() results */
+#define    EPD_CTL_DONE                       0       /* End of the input */
+#define    EPD_CTL_FAILED                     1       /* The e-paper could not be written */
+#define    EPD_CTL_QUIT                       2       /* "quit" read */
+
+/* Interpreter counters */
+typedef struct
+{
+    unsigned long commands;     /* Commands and binary frames run */
+    unsigned long errors;       /* Lines not understood */
+    unsigned long updates;
+    unsigned long bytes;        /* Bytes of the scenes sent */
+    long long parse_us;         /* Time spent reading and recording commands */
+    long long send_us;          /* Time spent sending scenes, acknowledgements included */
+} lib_epd_ctl_stats_t;
+
+int LibEpdCtlRun(FILE * in, FILE * out);
+void LibEpdCtlGetStats(lib_epd_ctl_stats_t * stats);
+
+#endif
@@ -0,0 +1,406 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_daemon.c
+ * @brief   Display daemon sharing one e-paper screen between processes.
+ *
+ *          The daemon is the only owner of the UART and of the lib_epd state. Each client
+ *          (see lib_epd_client.c) hands over a shared-memory ring at connect time and then
+ *          writes encoded frames into it, ringing a one byte doorbell on the Unix socket.
+ *
+ *          Frames of a client are checked (start byte, length, checksum) as they are read and
+ *          held until its CMD_UPDATE, then forwarded in one piece so that clients never
+ *          interleave inside a scene. On the way out:
+ *          - colour and font frames that would not change the state last sent to the e-paper
+ *            are dropped;
+ *          - the per-client updates are replaced by one coalesced refresh (lib_epd_sched.c).
+ *
+ *          The ring is shared with the client, so nothing the daemon reads back from it is
+ *          trusted: the daemon keeps its own tail and only publishes it.
+ *
+ *          Pass a pty as dev_name to run the daemon without the e-paper.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_sched.h"
+#include "lib_epd_daemon.h"
+
+#define DAEMON_FRAME_MAX    (FRAME_BUFF_SIZE * 4)
+
+typedef struct
+{
+    int sock;                   /* -1 if the slot is free */
+    lib_epd_ring_t * ring;
+    unsigned int tail;          /* Bytes consumed, ring->tail is only a copy for the client */
+    lib_epd_scene_t scene;      /* Frames received since the client's last update */
+} daemon_client_t;
+
+static daemon_client_t s_client[EPD_DAEMON_MAX_CLIENTS];
+static volatile sig_atomic_t s_stop = 0;
+
+static unsigned long s_frames_in = 0;
+static unsigned long s_frames_deduped = 0;
+
+static void _OnSignal(int sig)
+{
+    (void) sig;
+    s_stop = 1;
+}
+
+/* Forward one checked frame as if drawn by the daemon, dropping it if it does not change the
+ * state last sent to the e-paper. The sent state lags while frames are held on the way (see
+ * lib_epd_skip.c), which can only let a redundant frame through, never drop a needed one */
+static void _Forward(const unsigned char * frame, int len)
+{
+    lib_epd_state_t sent;
+    int same;
+
+    LibEpdGetSentState(&sent);
+    switch (frame[3])
+    {
+    case CMD_SET_COLOR:
+        same = (frame[4] == sent.color) && ((len < 11) || (frame[5] == sent.bkcolor));
+        break;
+    case CMD_SET_EN_FONT:
+        same = (frame[4] == sent.en_font);
+        break;
+    case CMD_SET_CH_FONT:
+        same = (frame[4] == sent.ch_font);
+        break;
+    default:
+        same = FALSE;
+        break;
+    }
+    if (same)
+    {
+        s_frames_deduped++;
+        return;
+    }
+    LibEpdSendFrames(frame, len);
+}
+
+/* Forward the held frames of a client and request a refresh */
+static void _Commit(daemon_client_t * client)
+{
+    int off = 0;
+    int len;
+
+    while (off < client->scene.len)
+    {
+        len = LibEpdFrameLen(client->scene.data + off);
+        _Forward(client->scene.data + off, len);
+        off += len;
+    }
+    LibEpdSceneReset(&client->scene);
+
+    LibEpdSchedRequest();
+}
+
+static void _RingRead(const lib_epd_ring_t * ring, unsigned int pos, unsigned char * ptr, int n)
+{
+    unsigned int off = pos & (EPD_RING_SIZE - 1);
+    unsigned int part = EPD_RING_SIZE - off;
+
+    if (part >= (unsigned int) n)
+    {
+        memcpy(ptr, &ring->data[off], n);
+    } else
+    {
+        memcpy(ptr, &ring->data[off], part);
+        memcpy(ptr + part, &ring->data[0], n - part);
+    }
+}
+
+static void _DropClient(daemon_client_t * client)
+{
+    printf("LibEpdDaemon: client %d left\n", client->sock);
+    close(client->sock);
+    munmap(client->ring, sizeof(lib_epd_ring_t));
+    LibEpdSceneFree(&client->scene);
+    client->sock = -1;
+    client->ring = NULL;
+}
+
+/* Consume the frames published in a client ring. Returns FALSE if the ring is corrupted */
+static int _Drain(daemon_client_t * client)
+{
+    lib_epd_ring_t * ring = client->ring;
+    unsigned char frame[DAEMON_FRAME_MAX];
+    unsigned int head;
+    unsigned int tail;
+    int len;
+    char credit = EPD_MSG_CREDIT;
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    tail = client->tail;
+    if (head - tail > EPD_RING_SIZE)
+    {
+        fprintf(stderr, "LibEpdDaemon: bad ring head from client %d\n", client->sock);
+        return FALSE;
+    }
+    while (head - tail >= 3)
+    {
+        _RingRead(ring, tail, frame, 3);
+        len = LibEpdFrameLen(frame);
+        if ((len > DAEMON_FRAME_MAX) || ((unsigned int) len > head - tail))
+        {
+            len = 0;
+        } else
+        {
+            _RingRead(ring, tail, frame, len);
+        }
+        if (!LibEpdFrameValid(frame, len))
+        {
+            fprintf(stderr, "LibEpdDaemon: bad frame from client %d\n", client->sock);
+            return FALSE;
+        }
+        tail += len;
+        s_frames_in++;
+
+        if (frame[3] == CMD_UPDATE)
+        {
+            _Commit(client);
+        } else if (LibEpdSceneAppend(&client->scene, frame, len) < 0)
+        {
+            return FALSE;
+        }
+    }
+    client->tail = tail;
+    __atomic_store_n(&ring->tail, tail, __ATOMIC_SEQ_CST);
+
+    if (__atomic_exchange_n(&ring->waiting, 0, __ATOMIC_SEQ_CST))
+    {
+        if (write(client->sock, &credit, 1) != 1)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Accept a client and map the ring it passes along */
+static void _Accept(int listen_fd)
+{
+    struct msghdr msg;
+    struct iovec iov;
+    struct cmsghdr * cmsg;
+    struct stat st;
+    struct timeval tv;
+    char cbuf[CMSG_SPACE(sizeof(int))];
+    char hello = 0;
+    int sock;
+    int fd = -1;
+    int i;
+    void * ring;
+
+    sock = accept(listen_fd, NULL, NULL);
+    if (sock < 0)
+    {
+        perror("LibEpdDaemon: accept");
+        return;
+    }
+
+    /* A client that connects and stays silent must not hold the other clients */
+    tv.tv_sec = EPD_DAEMON_HELLO_MS / 1000;
+    tv.tv_usec = (EPD_DAEMON_HELLO_MS % 1000) * 1000;
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    memset(&msg, 0, sizeof(msg));
+    iov.iov_base = &hello;
+    iov.iov_len = 1;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+    if (recvmsg(sock, &msg, 0) == 1 && hello == EPD_MSG_HELLO)
+    {
+        cmsg = CMSG_FIRSTHDR(&msg);
+        if ((cmsg != NULL) && (cmsg->cmsg_level == SOL_SOCKET)
+                && (cmsg->cmsg_type == SCM_RIGHTS))
+        {
+            memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+    if ((fd < 0) || (fstat(fd, &st) != 0) || (st.st_size < (off_t) sizeof(lib_epd_ring_t)))
+    {
+        fprintf(stderr, "LibEpdDaemon: bad hello\n");
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        close(sock);
+        return;
+    }
+    ring = mmap(NULL, sizeof(lib_epd_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring == MAP_FAILED)
+    {
+        perror("LibEpdDaemon: mmap");
+        close(sock);
+        return;
+    }
+
+    for (i = 0; i < EPD_DAEMON_MAX_CLIENTS; i++)
+    {
+        if (s_client[i].sock < 0)
+        {
+            s_client[i].sock = sock;
+            s_client[i].ring = ring;
+            s_client[i].tail = __atomic_load_n(&s_client[i].ring->tail, __ATOMIC_ACQUIRE);
+            LibEpdSceneInit(&s_client[i].scene);
+            printf("LibEpdDaemon: client %d joined\n", sock);
+            return;
+        }
+    }
+    fprintf(stderr, "LibEpdDaemon: too many clients\n");
+    munmap(ring, sizeof(lib_epd_ring_t));
+    close(sock);
+}
+
+static int _Listen(const char * sock_path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        perror("LibEpdDaemon: socket");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, sock_path, sizeof(addr.sun_path) - 1);
+    unlink(sock_path);
+    if ((bind(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0) || (listen(fd, 8) != 0))
+    {
+        perror("LibEpdDaemon: bind");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Serve clients until LibEpdDaemonStop() or SIGINT/SIGTERM.
+ * dev_name: serial device, NULL for the platform default of LibEpdInit().
+ * Returns 0 on a clean stop */
+int LibEpdDaemonRun(const char * sock_path, const char * dev_name)
+{
+    struct pollfd fds[EPD_DAEMON_MAX_CLIENTS + 1];
+    daemon_client_t * owner[EPD_DAEMON_MAX_CLIENTS + 1];
+    lib_epd_sched_stats_t stats;
+    char buff[64];
+    int listen_fd;
+    int nfds;
+    int timeout;
+    int i;
+
+    if (dev_name != NULL)
+    {
+        if (!LibEpdInitDev(dev_name, 115200))
+        {
+            return 1;
+        }
+    } else
+    {
+        LibEpdInit();
+    }
+    listen_fd = _Listen(sock_path);
+    if (listen_fd < 0)
+    {
+        LibEpdClose();
+        return 1;
+    }
+
+    signal(SIGINT, _OnSignal);
+    signal(SIGTERM, _OnSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    for (i = 0; i < EPD_DAEMON_MAX_CLIENTS; i++)
+    {
+        s_client[i].sock = -1;
+        s_client[i].ring = NULL;
+    }
+    LibEpdSchedInit(EPD_DAEMON_WINDOW_MS, EPD_DAEMON_MAX_WAIT_MS, EPD_DAEMON_MIN_INTERVAL_MS);
+    s_stop = 0;
+
+    printf("LibEpdDaemon: listening on %s\n", sock_path);
+    while (!s_stop)
+    {
+        fds[0].fd = listen_fd;
+        fds[0].events = POLLIN;
+        nfds = 1;
+        for (i = 0; i < EPD_DAEMON_MAX_CLIENTS; i++)
+        {
+            if (s_client[i].sock >= 0)
+            {
+                fds[nfds].fd = s_client[i].sock;
+                fds[nfds].events = POLLIN;
+                owner[nfds] = &s_client[i];
+                nfds++;
+            }
+        }
+
+        timeout = LibEpdSchedNextDue();
+        if (poll(fds, nfds, timeout) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("LibEpdDaemon: poll");
+            break;
+        }
+
+        for (i = 1; i < nfds; i++)
+        {
+            if (fds[i].revents == 0)
+            {
+                continue;
+            }
+            /* Doorbells only wake us up, the ring tells what to do */
+            if ((read(fds[i].fd, buff, sizeof(buff)) <= 0) || !_Drain(owner[i]))
+            {
+                _DropClient(owner[i]);
+            }
+        }
+        if (fds[0].revents & POLLIN)
+        {
+            _Accept(listen_fd);
+        }
+
+        LibEpdSchedPoll();
+    }
+
+    LibEpdSchedFlush();
+    LibEpdSchedGetStats(&stats);
+    LibEpdSchedClose();
+    for (i = 0; i < EPD_DAEMON_MAX_CLIENTS; i++)
+    {
+        if (s_client[i].sock >= 0)
+        {
+            _DropClient(&s_client[i]);
+        }
+    }
+    close(listen_fd);
+    unlink(sock_path);
+    LibEpdClose();
+
+    printf("LibEpdDaemon: %lu frames in, %lu deduplicated, %lu updates, %lu refreshes\n",
+            s_frames_in, s_frames_deduped, stats.requests, stats.refreshes);
+    return 0;
+}
+
+void LibEpdDaemonStop(void)
+{
+    s_stop = 1;
+}
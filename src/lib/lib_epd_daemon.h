@@ -0,0 +1,48 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_daemon.h
+ * @brief   API of the display daemon sharing one e-paper screen between processes.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_DAEMON_H
+#define LIB_EPD_DAEMON_H
+
+/* Unix socket the clients connect to */
+#define    EPD_DAEMON_SOCK                    "/tmp/epd.sock"
+#define    EPD_DAEMON_MAX_CLIENTS             16
+
+/* Update coalescing, see lib_epd_sched.c */
+#define    EPD_DAEMON_WINDOW_MS               200
+#define    EPD_DAEMON_MAX_WAIT_MS             1000
+#define    EPD_DAEMON_MIN_INTERVAL_MS         2000
+
+/* Longest wait for the hello of a client that connected, the other clients wait meanwhile */
+#define    EPD_DAEMON_HELLO_MS                200
+
+/* Shared-memory command ring, one per client.
+ * head/tail are free running byte counters: the client writes whole encoded frames and then
+ * publishes head, the daemon consumes them and publishes tail. A client that finds the ring full
+ * sets waiting and blocks on the socket until the daemon sends a credit byte. */
+#define    EPD_RING_SIZE                      (64 * 1024)     /* Power of two */
+
+typedef struct
+{
+    unsigned int head;          /* Written by the client */
+    unsigned int tail;          /* Written by the daemon */
+    unsigned int waiting;       /* Client is blocked on a full ring */
+    unsigned char data[EPD_RING_SIZE];
+} lib_epd_ring_t;
+
+/* Socket messages */
+#define    EPD_MSG_HELLO                      'H'     /* Client -> daemon, carries the ring fd */
+#define    EPD_MSG_DOORBELL                   'D'     /* Client -> daemon, frames are in the ring */
+#define    EPD_MSG_CREDIT                     'C'     /* Daemon -> client, ring space freed */
+
+int LibEpdDaemonRun(const char * sock_path, const char * dev_name);
+void LibEpdDaemonStop(void);
+
+#endif
@@ -0,0 +1,299 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_fb.c
+ * @brief   Shared-memory framebuffer of the e-paper screen.
+ *
+ *          Any process may map the framebuffer (see lib_epd_fb.h for its layout) and draw
+ *          pixels into it. LibEpdFbCommit() compares it with the copy last committed and turns
+ *          what changed into device commands:
+ *          - whole rows are compared first with memcmp(), vectorized by the C library, then the
+ *            rows that differ word by word, 32 pixels at a time;
+ *          - each stretch of changed words of a row is cut into runs of one color, the runs
+ *            with no pixel changed dropped;
+ *          - a run continuing the same run of the row above grows that rectangle downwards;
+ *          - the rectangles are sent grouped by color, one CMD_SET_COLOR per color, as pixels,
+ *            lines or filled rectangles.
+ *          The rectangles never overlap, so their order does not matter.
+ *
+ *          The first commit clears the screen to white and draws what is not white.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <sys/mman.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_fb.h"
+
+#define FB_WORDS            (EPD_FB_STRIDE / 8)     /* 64 bit words per row */
+#define FB_WORD_PIXELS      32
+
+typedef char fb_stride_words_t[(EPD_FB_STRIDE % 8 == 0) ? 1 : -1];
+
+/* Run of one color, growing down while the rows below repeat it */
+typedef struct
+{
+    short x0;
+    short x1;
+    short y0;
+    short y1;
+    unsigned char color;
+} fb_rect_t;
+
+static unsigned char * s_fb = NULL;
+static char s_name[64];
+static unsigned long long s_shown[FB_WORDS * EPD_HEIGHT];  /* Copy last committed */
+static int s_full = TRUE;
+
+static fb_rect_t s_rect[EPD_FB_RECTS_MAX];
+static int s_rects = 0;
+static int s_open[2][EPD_WIDTH];    /* Rectangles still growing, of the rows above and being cut */
+static int s_opens[2];
+
+static int _Pixel(const unsigned char * row, int x)
+{
+    return (row[x >> 2] >> (6 - 2 * (x & 3))) & 0x03;
+}
+
+/* Draw the rectangles gathered, color by color, and forget them */
+static int _Emit(void)
+{
+    const fb_rect_t * r;
+    int frames = 0;
+    int color;
+    int first;
+    int i;
+
+    for (color = BLACK; color <= WHITE; color++)
+    {
+        first = TRUE;
+        for (i = 0; i < s_rects; i++)
+        {
+            r = &s_rect[i];
+            if (r->color != color)
+            {
+                continue;
+            }
+            if (first)
+            {
+                LibEpdSetColor((unsigned char) color, WHITE);
+                first = FALSE;
+            }
+            if ((r->x0 == r->x1) && (r->y0 == r->y1))
+            {
+                LibEpdDrawPixel(r->x0, r->y0);
+            }
+            else if ((r->x0 == r->x1) || (r->y0 == r->y1))
+            {
+                LibEpdDrawLine(r->x0, r->y0, r->x1, r->y1);
+            }
+            else
+            {
+                LibEpdFillRect(r->x0, r->y0, r->x1, r->y1);
+            }
+            frames++;
+        }
+    }
+    s_rects = 0;
+    s_opens[0] = 0;
+    s_opens[1] = 0;
+    return frames;
+}
+
+/* Take a run of row y: grow the rectangle above it if it has the same extent, else start one.
+ * cur and prev index s_open. Returns the frames sent when the rectangles ran out */
+static int _Run(int x0, int x1, int y, int color, int cur, int * prev_i)
+{
+    const int prev = 1 - cur;
+    fb_rect_t * r;
+    int frames = 0;
+
+    while ((*prev_i < s_opens[prev]) && (s_rect[s_open[prev][*prev_i]].x1 < x0))
+    {
+        (*prev_i)++;
+    }
+    if (*prev_i < s_opens[prev])
+    {
+        r = &s_rect[s_open[prev][*prev_i]];
+        if ((r->x0 == x0) && (r->x1 == x1) && (r->color == color) && (r->y1 == y - 1))
+        {
+            r->y1 = (short) y;
+            s_open[cur][s_opens[cur]++] = s_open[prev][(*prev_i)++];
+            return 0;
+        }
+    }
+    if (s_rects == EPD_FB_RECTS_MAX)
+    {
+        frames = _Emit();
+        *prev_i = 0;
+    }
+    r = &s_rect[s_rects];
+    r->x0 = (short) x0;
+    r->x1 = (short) x1;
+    r->y0 = (short) y;
+    r->y1 = (short) y;
+    r->color = (unsigned char) color;
+    s_open[cur][s_opens[cur]++] = s_rects++;
+    return frames;
+}
+
+/* Create or map the framebuffer name (EPD_FB_NAME if NULL), white when created.
+ * Returns its pixels, NULL on failure */
+unsigned char * LibEpdFbOpen(const char * name)
+{
+    struct stat st;
+    int fd;
+
+    LibEpdFbClose(FALSE);
+    snprintf(s_name, sizeof(s_name), "%s", (name != NULL) ? name : EPD_FB_NAME);
+    fd = shm_open(s_name, O_RDWR | O_CREAT, 0666);
+    if (fd < 0)
+    {
+        perror("LibEpdFbOpen: shm_open");
+        return NULL;
+    }
+    if ((fstat(fd, &st) != 0) || ((st.st_size != EPD_FB_BYTES) && (ftruncate(fd, EPD_FB_BYTES) != 0)))
+    {
+        perror("LibEpdFbOpen: ftruncate");
+        close(fd);
+        return NULL;
+    }
+    s_fb = mmap(NULL, EPD_FB_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (s_fb == MAP_FAILED)
+    {
+        perror("LibEpdFbOpen: mmap");
+        s_fb = NULL;
+        return NULL;
+    }
+    if (st.st_size != EPD_FB_BYTES)
+    {
+        memset(s_fb, 0xFF, EPD_FB_BYTES);
+    }
+    memset(s_shown, 0xFF, sizeof(s_shown));
+    s_full = TRUE;
+    return s_fb;
+}
+
+/* Unmap the framebuffer, and remove it if unlink_it */
+void LibEpdFbClose(int unlink_it)
+{
+    if (s_fb != NULL)
+    {
+        munmap(s_fb, EPD_FB_BYTES);
+        s_fb = NULL;
+        if (unlink_it)
+        {
+            shm_unlink(s_name);
+        }
+    }
+}
+
+/* Cut the changed words [w0, w1) of row y into runs of one color, keeping those where a pixel
+ * changed from old */
+static int _Row(const unsigned char * line, const unsigned char * old, int w0, int w1, int y,
+        int cur, int * prev_i, lib_epd_fb_stats_t * st)
+{
+    int frames = 0;
+    int start = w0 * FB_WORD_PIXELS;
+    int color = _Pixel(line, start);
+    int changed = (_Pixel(old, start) != color);
+    int x;
+
+    for (x = start + 1; x <= w1 * FB_WORD_PIXELS; x++)
+    {
+        if ((x == w1 * FB_WORD_PIXELS) || (_Pixel(line, x) != color))
+        {
+            if (changed)
+            {
+                st->spans++;
+                frames += _Run(start, x - 1, y, color, cur, prev_i);
+            }
+            if (x < w1 * FB_WORD_PIXELS)
+            {
+                start = x;
+                color = _Pixel(line, x);
+                changed = FALSE;
+            }
+        }
+        if ((x < w1 * FB_WORD_PIXELS) && (_Pixel(old, x) != _Pixel(line, x)))
+        {
+            changed = TRUE;
+        }
+    }
+    return frames;
+}
+
+/* Draw what changed since the last commit and update the screen, nothing if nothing changed.
+ * Returns the number of frames drawn, -1 on failure */
+int LibEpdFbCommit(lib_epd_fb_stats_t * stats)
+{
+    lib_epd_fb_stats_t st;
+    unsigned long long line[FB_WORDS];
+    unsigned long long old[FB_WORDS];
+    unsigned long long * shown;
+    int prev_i;
+    int cur;
+    int w0;
+    int w;
+    int y;
+
+    if (s_fb == NULL)
+    {
+        return -1;
+    }
+    memset(&st, 0, sizeof(st));
+    if (s_full)
+    {
+        LibEpdSetColor(BLACK, WHITE);
+        LibEpdClear();
+    }
+
+    s_rects = 0;
+    s_opens[0] = 0;
+    s_opens[1] = 0;
+    for (y = 0; y < EPD_HEIGHT; y++)
+    {
+        cur = y & 1;
+        s_opens[cur] = 0;
+        shown = s_shown + y * FB_WORDS;
+        /* One read of the row, the writer may be changing it */
+        memcpy(line, s_fb + y * EPD_FB_STRIDE, EPD_FB_STRIDE);
+        if (memcmp(line, shown, EPD_FB_STRIDE) == 0)
+        {
+            continue;       /* Rectangles above end here */
+        }
+        st.rows++;
+        memcpy(old, shown, EPD_FB_STRIDE);
+        prev_i = 0;
+        for (w = 0; w < FB_WORDS; w++)
+        {
+            if (line[w] == shown[w])
+            {
+                continue;
+            }
+            for (w0 = w; (w < FB_WORDS) && (line[w] != shown[w]); w++)
+            {
+                shown[w] = line[w];
+            }
+            st.words += w - w0;
+            st.frames += _Row((const unsigned char *) line, (const unsigned char *) old, w0, w, y,
+                    cur, &prev_i, &st);
+        }
+    }
+    st.frames += _Emit();
+
+    if (stats != NULL)
+    {
+        *stats = st;
+    }
+    if ((st.frames == 0) && !s_full)
+    {
+        return 0;
+    }
+    LibEpdUpdate();
+    s_full = FALSE;
+    return st.frames;
+}
@@ -0,0 +1,42 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_fb.h
+ * @brief   API of the shared-memory framebuffer of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_FB_H
+#define LIB_EPD_FB_H
+
+#include "lib_epd.h"
+
+/* Shared-memory object, /dev/shm/epd-fb on Linux */
+#define    EPD_FB_NAME                        "/epd-fb"
+
+/* 2 bits per pixel, 4 pixels per byte, the leftmost in the high bits. A pixel holds its color
+ * (BLACK, DARK_GRAY, GRAY or WHITE), rows follow each other with no padding */
+#define    EPD_FB_STRIDE                      (EPD_WIDTH / 4)
+#define    EPD_FB_BYTES                       (EPD_FB_STRIDE * EPD_HEIGHT)
+
+/* Rectangles gathered before being drawn */
+#ifndef EPD_FB_RECTS_MAX
+#define    EPD_FB_RECTS_MAX                   4096
+#endif
+
+/* What a commit found and sent */
+typedef struct
+{
+    int rows;           /* Rows that changed */
+    int words;          /* 64 bit words that changed */
+    int spans;          /* Runs of one color on a row */
+    int frames;         /* Frames drawn, colors and update excluded */
+} lib_epd_fb_stats_t;
+
+unsigned char * LibEpdFbOpen(const char * name);
+void LibEpdFbClose(int unlink_it);
+int LibEpdFbCommit(lib_epd_fb_stats_t * stats);
+
+#endif
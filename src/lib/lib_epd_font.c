@@ -0,0 +1,325 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_font.c
+ * @brief   Text drawn with host rendered TrueType fonts.
+ *
+ *          Each glyph is rasterized once, quantized to the four gray levels and reduced to
+ *          rectangles: runs of one level on a row, merged with the identical run of the row
+ *          above. The rectangles are kept in a cache keyed by font, size and code point, so a
+ *          repeated character costs no rasterization, only its frames.
+ *
+ *          A string is drawn level by level, one CMD_SET_COLOR per level used, then the color
+ *          is restored. Rows are sent as CMD_DRAW_LINE, taller rectangles as CMD_FILL_RECT.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_font.h"
+#include "lib_gbk.h"
+#include "lib_epd_mem.h"
+
+#define FONT_SHADES     3       /* Gray levels drawn over the background, full coverage last */
+
+/* Rectangle of one shade, pixels from the pen on the baseline, corners included */
+typedef struct
+{
+    short x0;
+    short y0;
+    short x1;
+    short y1;
+    unsigned char shade;        /* 1 (light) to FONT_SHADES (full) */
+} font_rect_t;
+
+/* Cached glyph */
+typedef struct
+{
+    int font_id;                /* 0 for a free entry */
+    int px;
+    unsigned long cp;
+    int advance;                /* 1/64 pixel */
+    int num;
+    font_rect_t * rects;
+    unsigned long used;         /* Tick of the last lookup */
+} font_glyph_t;
+
+static font_glyph_t s_cache[EPD_GLYPH_CACHE_SIZE];
+static lib_epd_font_stats_t s_stats;
+static unsigned long s_tick = 0;
+
+/* Rasterize a glyph into its cache entry */
+static int _Rasterize(const lib_ttf_t * font, int px, unsigned long cp, font_glyph_t * entry)
+{
+    lib_ttf_box_t box;
+    unsigned char * coverage;
+    font_rect_t * rects;
+    int glyph = LibTtfGlyph(font, cp);
+    int size = 0;
+    int prev;
+    int cur;
+    int shade;
+    int x;
+    int y;
+    int end;
+    int i;
+
+    entry->advance = (int) (LibTtfAdvance(font, glyph) * LibTtfScale(font, px) * 64 + 0.5f);
+    entry->num = 0;
+    entry->rects = NULL;
+    if (!LibTtfBox(font, glyph, px, &box))
+    {
+        return TRUE;
+    }
+
+    coverage = LibEpdMemAlloc(EPD_MEM_SCRATCH, box.w * box.h);
+    if ((coverage == NULL) || !LibTtfRender(font, glyph, px, &box, coverage))
+    {
+        LibEpdMemFree(EPD_MEM_SCRATCH, coverage);
+        return FALSE;
+    }
+
+    prev = 0;
+    for (y = 0; y < box.h; y++)
+    {
+        cur = entry->num;
+        for (x = 0; x < box.w; x = end)
+        {
+            shade = (coverage[y * box.w + x] * FONT_SHADES + 127) / 255;
+            for (end = x + 1; (end < box.w)
+                    && ((coverage[y * box.w + end] * FONT_SHADES + 127) / 255 == shade); end++)
+            {
+            }
+            if (shade == 0)
+            {
+                continue;
+            }
+
+            /* Extend the same run of the row above */
+            for (i = prev; i < cur; i++)
+            {
+                if ((entry->rects[i].x0 == box.x0 + x) && (entry->rects[i].x1 == box.x0 + end - 1)
+                        && (entry->rects[i].shade == shade) && (entry->rects[i].y1 == box.y0 + y - 1))
+                {
+                    entry->rects[i].y1++;
+                    break;
+                }
+            }
+            if (i < cur)
+            {
+                continue;
+            }
+
+            if (entry->num == size)
+            {
+                size = (size == 0) ? 16 : size * 2;
+                rects = LibEpdMemRealloc(EPD_MEM_GLYPH, entry->rects, size * sizeof(font_rect_t));
+                if (rects == NULL)
+                {
+                    LibEpdMemFree(EPD_MEM_SCRATCH, coverage);
+                    return FALSE;
+                }
+                entry->rects = rects;
+            }
+            entry->rects[entry->num].x0 = box.x0 + x;
+            entry->rects[entry->num].x1 = box.x0 + end - 1;
+            entry->rects[entry->num].y0 = box.y0 + y;
+            entry->rects[entry->num].y1 = box.y0 + y;
+            entry->rects[entry->num].shade = shade;
+            entry->num++;
+        }
+        /* Rectangles still open are the ones that reached the previous row */
+        for (i = prev; (i < cur) && (entry->rects[i].y1 < box.y0 + y); i++)
+        {
+        }
+        prev = i;
+    }
+
+    LibEpdMemFree(EPD_MEM_SCRATCH, coverage);
+    return TRUE;
+}
+
+/* Drop every cached glyph */
+static void _Flush(void)
+{
+    int i;
+
+    for (i = 0; i < EPD_GLYPH_CACHE_SIZE; i++)
+    {
+        LibEpdMemFree(EPD_MEM_GLYPH, s_cache[i].rects);
+    }
+    memset(s_cache, 0, sizeof(s_cache));
+}
+
+/* Cached glyph, rasterized on a miss; NULL if it cannot be rendered.
+ * The cache is two-way set associative, the least recently used way is replaced. When the
+ * glyph pool runs out the whole cache is dropped and the glyph tried once more */
+static font_glyph_t * _Get(const lib_ttf_t * font, int px, unsigned long cp, int count)
+{
+    lib_epd_mem_stats_t mem;
+    font_glyph_t * entry;
+    unsigned int h;
+    int ok;
+    int i;
+
+    h = (unsigned int) cp * 2654435761u ^ (unsigned int) font->id * 40503u ^ (unsigned int) px * 131u;
+    entry = &s_cache[((h ^ (h >> 16)) & (EPD_GLYPH_CACHE_SIZE / 2 - 1)) * 2];
+    for (i = 0; i < 2; i++)
+    {
+        if ((entry[i].font_id == font->id) && (entry[i].px == px) && (entry[i].cp == cp))
+        {
+            s_stats.hits += count;
+            entry[i].used = ++s_tick;
+            return &entry[i];
+        }
+    }
+
+    s_stats.misses += count;
+    entry += (entry[1].used < entry[0].used) ? 1 : 0;
+    LibEpdMemFree(EPD_MEM_GLYPH, entry->rects);
+    entry->rects = NULL;
+    entry->font_id = 0;
+    entry->used = 0;
+    ok = _Rasterize(font, px, cp, entry);
+    if (!ok)
+    {
+        LibEpdMemFree(EPD_MEM_GLYPH, entry->rects);
+        entry->rects = NULL;
+        /* Out of glyph blocks rather than too large for one: make room */
+        LibEpdMemGetStats(EPD_MEM_GLYPH, &mem);
+        if ((mem.blocks > 0) && (mem.used == mem.blocks))
+        {
+            _Flush();
+            ok = _Rasterize(font, px, cp, entry);
+        }
+    }
+    if (!ok)
+    {
+        LibEpdMemFree(EPD_MEM_GLYPH, entry->rects);
+        entry->rects = NULL;
+        return NULL;
+    }
+    entry->font_id = font->id;
+    entry->px = px;
+    entry->cp = cp;
+    entry->used = ++s_tick;
+    return entry;
+}
+
+/* Send one rectangle, clipped to the screen origin */
+static void _DrawRect(int x0, int y0, int x1, int y1)
+{
+    if ((x1 < 0) || (y1 < 0))
+    {
+        return;
+    }
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    if ((x0 == x1) && (y0 == y1))
+    {
+        LibEpdDrawPixel(x0, y0);
+    }
+    else if (y0 == y1)
+    {
+        LibEpdDrawLine(x0, y0, x1, y1);
+    }
+    else
+    {
+        LibEpdFillRect(x0, y0, x1, y1);
+    }
+}
+
+/* Draw UTF-8 text with a TrueType font, px pixels per em, top left corner of the line at
+ * (x0, y0), anti-aliased from the current color to the background color.
+ * Returns the number of frames sent */
+int LibEpdFontDrawString(const lib_ttf_t * font, int px, const char * utf8, int x0, int y0)
+{
+    lib_epd_state_t state;
+    const unsigned char * p;
+    font_glyph_t * entry;
+    unsigned char fg;
+    unsigned char bg;
+    int baseline = y0 + (int) (font->ascent * LibTtfScale(font, px) + 0.5f);
+    int frames = 0;
+    int current;
+    int shade;
+    int pen;
+    int gx;
+    int i;
+
+    LibEpdGetState(&state);
+    fg = (state.color == EPD_UNKNOWN) ? BLACK : state.color;
+    bg = (state.bkcolor == EPD_UNKNOWN) ? WHITE : state.bkcolor;
+    current = (state.color == EPD_UNKNOWN) ? 0 : FONT_SHADES;
+
+    /* Full coverage first, so a string without gray costs no color change */
+    for (shade = FONT_SHADES; shade > 0; shade--)
+    {
+        p = (const unsigned char *) utf8;
+        pen = x0 * 64;
+        while (*p != '\0')
+        {
+            entry = _Get(font, px, LibGbkUtf8Next(&p), shade == FONT_SHADES);
+            if (entry == NULL)
+            {
+                continue;
+            }
+            s_stats.glyphs += (shade == FONT_SHADES);
+            gx = (pen + 32) >> 6;
+            for (i = 0; i < entry->num; i++)
+            {
+                if (entry->rects[i].shade != shade)
+                {
+                    continue;
+                }
+                if (current != shade)
+                {
+                    LibEpdSetColor((fg * shade + bg * (FONT_SHADES - shade) + 1) / FONT_SHADES, bg);
+                    frames++;
+                    current = shade;
+                }
+                _DrawRect(gx + entry->rects[i].x0, baseline + entry->rects[i].y0,
+                        gx + entry->rects[i].x1, baseline + entry->rects[i].y1);
+                frames++;
+            }
+            pen += entry->advance;
+        }
+    }
+    if ((current != FONT_SHADES) && (current != 0))
+    {
+        LibEpdSetColor(fg, bg);
+        frames++;
+    }
+
+    s_stats.frames += frames;
+    return frames;
+}
+
+/* Width in pixels of UTF-8 text drawn with LibEpdFontDrawString() */
+int LibEpdFontWidth(const lib_ttf_t * font, int px, const char * utf8)
+{
+    const unsigned char * p = (const unsigned char *) utf8;
+    float scale = LibTtfScale(font, px);
+    int pen = 0;
+
+    while (*p != '\0')
+    {
+        pen += (int) (LibTtfAdvance(font, LibTtfGlyph(font, LibGbkUtf8Next(&p))) * scale * 64 + 0.5f);
+    }
+    return (pen + 32) >> 6;
+}
+
+/* Drop every cached glyph and reset the counters, needed before a font is freed and
+ * its memory reused */
+void LibEpdFontCacheClear(void)
+{
+    _Flush();
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+void LibEpdFontGetStats(lib_epd_font_stats_t * stats)
+{
+    *stats = s_stats;
+}
@@ -0,0 +1,34 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_font.h
+ * @brief   API of the text drawn with host rendered TrueType fonts.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_FONT_H
+#define LIB_EPD_FONT_H
+
+#include "lib_ttf.h"
+
+/* Glyphs kept rendered, a power of two, two per cache set */
+#define    EPD_GLYPH_CACHE_SIZE               256
+
+/* Counters since the last LibEpdFontCacheClear() */
+typedef struct
+{
+    unsigned long glyphs;       /* Glyphs drawn */
+    unsigned long hits;         /* Glyphs found in the cache */
+    unsigned long misses;       /* Glyphs rasterized */
+    unsigned long frames;       /* Frames sent, color changes included */
+} lib_epd_font_stats_t;
+
+int LibEpdFontDrawString(const lib_ttf_t * font, int px, const char * utf8, int x0, int y0);
+int LibEpdFontWidth(const lib_ttf_t * font, int px, const char * utf8);
+
+void LibEpdFontCacheClear(void);
+void LibEpdFontGetStats(lib_epd_font_stats_t * stats);
+
+#endif
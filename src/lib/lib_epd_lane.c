@@ -0,0 +1,344 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_lane.c
+ * @brief   Prioritized command lanes of the e-paper screen.
+ *
+ *          Scenes are recorded with LibEpdLaneBegin() and queued to a lane with
+ *          LibEpdLaneSubmit(). A dispatcher thread writes them with LibEpdWrite() frame by frame,
+ *          so they pass the layers of lib_epd.c like any other frame, always taking the high lane
+ *          first. Submitting a high priority scene:
+ *          - drops the low priority scenes still queued, since it replaces what they would show;
+ *          - stops the low priority scene being written at the next frame boundary. A frame is
+ *            never cut, so the e-paper never sees a partial command.
+ *
+ *          The queue wait of each scene goes into a log2 histogram per lane, so tail latency can
+ *          be read back with LibEpdLaneGetStats().
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <pthread.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_lane.h"
+#include "lib_epd_mem.h"
+#include "lib_epd_trace.h"
+
+#define LANE_HIST_SIZE  32      /* Bucket i counts waits below 2^(i+1) us */
+
+typedef struct lane_entry
+{
+    lib_epd_scene_t scene;
+    long long submit_us;
+    struct lane_entry * next;
+} lane_entry_t;
+
+/* An entry must fit in a block of the queue pool */
+typedef char lane_entry_fits_t[(sizeof(lane_entry_t) <= EPD_QUEUE_BYTES) ? 1 : -1];
+
+typedef struct
+{
+    lane_entry_t * head;
+    lane_entry_t * tail;
+    lib_epd_lane_stats_t stats;
+    unsigned long hist[LANE_HIST_SIZE];
+} lane_t;
+
+static lane_t s_lane[EPD_LANE_NUM];
+static lib_epd_scene_t s_build;
+
+static pthread_t s_dispatcher;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_cond = PTHREAD_COND_INITIALIZER;
+static int s_running = FALSE;
+static int s_current = -1;      /* Lane being written, -1 if idle */
+static int s_preempt = FALSE;   /* Urgent scene waiting, stop the current one */
+
+static void _HistAdd(lane_t * lane, long us)
+{
+    int i = 0;
+
+    while ((i < LANE_HIST_SIZE - 1) && ((long long) us >= (2LL << i)))
+    {
+        i++;
+    }
+    lane->hist[i]++;
+    if (us > lane->stats.wait_max_us)
+    {
+        lane->stats.wait_max_us = us;
+    }
+}
+
+/* Upper bound of the bucket holding the given percentile */
+static long _HistPercentile(const lane_t * lane, int percent)
+{
+    unsigned long total = 0;
+    unsigned long seen = 0;
+    int i;
+
+    for (i = 0; i < LANE_HIST_SIZE; i++)
+    {
+        total += lane->hist[i];
+    }
+    if (total == 0)
+    {
+        return 0;
+    }
+    for (i = 0; i < LANE_HIST_SIZE; i++)
+    {
+        seen += lane->hist[i];
+        if (seen * 100 >= total * percent)
+        {
+            break;
+        }
+    }
+    return ((2LL << i) < lane->stats.wait_max_us) ? (long) (2LL << i) : lane->stats.wait_max_us;
+}
+
+static lane_entry_t * _Pop(lane_t * lane)
+{
+    lane_entry_t * entry = lane->head;
+
+    if (entry != NULL)
+    {
+        lane->head = entry->next;
+        if (lane->head == NULL)
+        {
+            lane->tail = NULL;
+        }
+    }
+    return entry;
+}
+
+static void _FreeEntry(lane_entry_t * entry)
+{
+    LibEpdSceneFree(&entry->scene);
+    LibEpdMemFree(EPD_MEM_QUEUE, entry);
+}
+
+/* Write one scene frame by frame. Returns FALSE if it was preempted. */
+static int _WriteScene(const lib_epd_scene_t * scene, int lane)
+{
+    int off = 0;
+    int len;
+    int preempt;
+
+    while (off + 3 <= scene->len)
+    {
+        len = LibEpdFrameLen(scene->data + off);
+        if ((len <= 0) || (off + len > scene->len))
+        {
+            printf("LibEpdLane: malformed frame at %d\n", off);
+            return TRUE;
+        }
+        if (LibEpdWrite(scene->data + off, len) < 0)
+        {
+            return TRUE;
+        }
+        off += len;
+
+        if (lane != EPD_LANE_HIGH)
+        {
+            pthread_mutex_lock(&s_lock);
+            preempt = s_preempt;
+            pthread_mutex_unlock(&s_lock);
+            if (preempt && (off < scene->len))
+            {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+static void * _Dispatcher(void * arg)
+{
+    lane_entry_t * entry;
+    int lane;
+    int done;
+
+    (void) arg;
+
+    pthread_mutex_lock(&s_lock);
+    while (s_running)
+    {
+        entry = NULL;
+        for (lane = 0; lane < EPD_LANE_NUM; lane++)
+        {
+            entry = _Pop(&s_lane[lane]);
+            if (entry != NULL)
+            {
+                break;
+            }
+        }
+        if (entry == NULL)
+        {
+            pthread_cond_wait(&s_cond, &s_lock);
+            continue;
+        }
+
+        _HistAdd(&s_lane[lane], (long) (LibClockNowUs() - entry->submit_us));
+        s_current = lane;
+        s_preempt = FALSE;
+        pthread_mutex_unlock(&s_lock);
+
+        done = _WriteScene(&entry->scene, lane);
+
+        pthread_mutex_lock(&s_lock);
+        if (done)
+        {
+            s_lane[lane].stats.sent++;
+        } else
+        {
+            s_lane[lane].stats.preempted++;
+        }
+        s_current = -1;
+        _FreeEntry(entry);
+        pthread_cond_broadcast(&s_cond);
+    }
+    pthread_mutex_unlock(&s_lock);
+
+    return NULL;
+}
+
+/* Start the dispatcher. Returns TRUE on success */
+int LibEpdLaneInit(void)
+{
+    memset(s_lane, 0, sizeof(s_lane));
+    LibEpdSceneInit(&s_build);
+
+    s_running = TRUE;
+    s_current = -1;
+    s_preempt = FALSE;
+    if (pthread_create(&s_dispatcher, NULL, _Dispatcher, NULL) != 0)
+    {
+        perror("LibEpdLaneInit");
+        s_running = FALSE;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* Send what is queued, then stop the dispatcher */
+void LibEpdLaneClose(void)
+{
+    int lane;
+
+    if (!s_running)
+    {
+        return;
+    }
+    LibEpdLaneDrain();
+
+    pthread_mutex_lock(&s_lock);
+    s_running = FALSE;
+    pthread_cond_broadcast(&s_cond);
+    pthread_mutex_unlock(&s_lock);
+    pthread_join(s_dispatcher, NULL);
+
+    for (lane = 0; lane < EPD_LANE_NUM; lane++)
+    {
+        while (s_lane[lane].head != NULL)
+        {
+            _FreeEntry(_Pop(&s_lane[lane]));
+        }
+    }
+    LibEpdSceneFree(&s_build);
+}
+
+/* Start recording a scene for LibEpdLaneSubmit() */
+void LibEpdLaneBegin(void)
+{
+    LibEpdSceneReset(&s_build);
+    LibEpdSceneBegin(&s_build);
+}
+
+/* Queue the recorded scene to a lane. Returns TRUE on success */
+int LibEpdLaneSubmit(int lane)
+{
+    lane_entry_t * entry;
+    lane_entry_t * old;
+    int i;
+
+    LibEpdSceneEnd();
+    if ((lane < 0) || (lane >= EPD_LANE_NUM))
+    {
+        return FALSE;
+    }
+
+    entry = LibEpdMemAlloc(EPD_MEM_QUEUE, sizeof(lane_entry_t));
+    if (entry == NULL)
+    {
+        return FALSE;
+    }
+    /* The queue takes the recorded buffer over */
+    entry->scene = s_build;
+    entry->next = NULL;
+    LibEpdSceneInit(&s_build);
+
+    pthread_mutex_lock(&s_lock);
+    entry->submit_us = LibClockNowUs();
+    if (lane == EPD_LANE_HIGH)
+    {
+        for (i = EPD_LANE_HIGH + 1; i < EPD_LANE_NUM; i++)
+        {
+            while ((old = _Pop(&s_lane[i])) != NULL)
+            {
+                s_lane[i].stats.discarded++;
+                _FreeEntry(old);
+            }
+        }
+        if (s_current > EPD_LANE_HIGH)
+        {
+            s_preempt = TRUE;
+        }
+    }
+    if (s_lane[lane].tail != NULL)
+    {
+        s_lane[lane].tail->next = entry;
+    } else
+    {
+        s_lane[lane].head = entry;
+    }
+    s_lane[lane].tail = entry;
+    s_lane[lane].stats.submitted++;
+    EPD_TRACE_INSTANT("enqueue", lane);
+    pthread_cond_broadcast(&s_cond);
+    pthread_mutex_unlock(&s_lock);
+
+    return TRUE;
+}
+
+/* Wait until every queued scene has been written */
+void LibEpdLaneDrain(void)
+{
+    int lane;
+    int pending;
+
+    pthread_mutex_lock(&s_lock);
+    do
+    {
+        pending = (s_current >= 0);
+        for (lane = 0; lane < EPD_LANE_NUM; lane++)
+        {
+            pending |= (s_lane[lane].head != NULL);
+        }
+        if (pending)
+        {
+            pthread_cond_wait(&s_cond, &s_lock);
+        }
+    } while (pending);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void LibEpdLaneGetStats(int lane, lib_epd_lane_stats_t * stats)
+{
+    pthread_mutex_lock(&s_lock);
+    *stats = s_lane[lane].stats;
+    stats->wait_p50_us = _HistPercentile(&s_lane[lane], 50);
+    stats->wait_p99_us = _HistPercentile(&s_lane[lane], 99);
+    pthread_mutex_unlock(&s_lock);
+}
@@ -0,0 +1,40 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_lane.h
+ * @brief   API of the prioritized command lanes of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_LANE_H
+#define LIB_EPD_LANE_H
+
+/* Lanes, lower number goes first */
+#define    EPD_LANE_HIGH                      0
+#define    EPD_LANE_LOW                       1
+#define    EPD_LANE_NUM                       2
+
+/* Per lane counters. Queue wait is submit to first byte written, in microseconds. */
+typedef struct
+{
+    unsigned long submitted;    /* Scenes submitted */
+    unsigned long sent;         /* Scenes transmitted completely */
+    unsigned long preempted;    /* Scenes cut at a frame boundary by an urgent scene */
+    unsigned long discarded;    /* Queued scenes dropped as superseded */
+    long wait_p50_us;
+    long wait_p99_us;
+    long wait_max_us;
+} lib_epd_lane_stats_t;
+
+int LibEpdLaneInit(void);
+void LibEpdLaneClose(void);
+
+void LibEpdLaneBegin(void);
+int LibEpdLaneSubmit(int lane);
+void LibEpdLaneDrain(void);
+
+void LibEpdLaneGetStats(int lane, lib_epd_lane_stats_t * stats);
+
+#endif
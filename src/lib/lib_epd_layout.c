@@ -0,0 +1,302 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_layout.c
+ * @brief   Text layout with the fonts built into the e-paper.
+ *
+ *          The built-in fonts are fixed pitch: a GBK character is as wide as the font is high,
+ *          an ASCII character half of that. Widths are computed on the host from the fonts last
+ *          set, so laying out text costs no round trip to the screen.
+ *
+ *          Each laid out line is sent as one CMD_DRAW_STRING; empty lines cost nothing.
+ *          The device cannot clip, so a character that would cross the box is not sent.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_layout.h"
+#include "lib_gbk.h"
+
+/* Longest UTF-8 text taken by LibEpdLayoutUtf8(), in GBK bytes */
+#define LAYOUT_MAX_TEXT     2048
+
+/* Metrics of a built-in font */
+typedef struct
+{
+    int dots;           /* Line height */
+    int ascii_w;
+    int gbk_w;
+} layout_metric_t;
+
+/* By font code, 0 being the power on default */
+static const layout_metric_t c_layout_metrics[4] =
+{
+    { 32, 16, 32 },
+    { 32, 16, 32 },     /* ASCII32 / GBK32 */
+    { 48, 24, 48 },     /* ASCII48 / GBK48 */
+    { 64, 32, 64 },     /* ASCII64 / GBK64 */
+};
+
+/* Fonts in use */
+typedef struct
+{
+    int ascii_w;
+    int gbk_w;
+    int line_h;
+} layout_font_t;
+
+/* Line height in pixels of a built-in font code, the default font for an unknown one */
+int LibEpdFontDots(unsigned char font)
+{
+    return c_layout_metrics[(font <= ASCII64) ? font : 0].dots;
+}
+
+static void _Fonts(layout_font_t * f)
+{
+    lib_epd_state_t state;
+    int en;
+    int ch;
+
+    LibEpdGetState(&state);
+    en = (state.en_font <= ASCII64) ? state.en_font : 0;
+    ch = (state.ch_font <= GBK64) ? state.ch_font : 0;
+    f->ascii_w = c_layout_metrics[en].ascii_w;
+    f->gbk_w = c_layout_metrics[ch].gbk_w;
+    f->line_h = (c_layout_metrics[en].dots > c_layout_metrics[ch].dots)
+            ? c_layout_metrics[en].dots : c_layout_metrics[ch].dots;
+}
+
+/* Bytes of the character at p: 2 for a GBK pair, else 1 */
+static int _CharLen(const unsigned char * p)
+{
+    return ((p[0] >= 0x81) && (p[0] <= 0xFE) && (p[1] >= 0x40) && (p[1] <= 0xFE)) ? 2 : 1;
+}
+
+/* Width in pixels of len bytes of GBK text (all of it if len < 0) in the fonts last set */
+int LibEpdTextWidth(const char * gbk, int len)
+{
+    const unsigned char * p = (const unsigned char *) gbk;
+    layout_font_t f;
+    int ascii = 0;
+    int pairs = 0;
+    int i = 0;
+
+    _Fonts(&f);
+    if (len < 0)
+    {
+        len = strlen(gbk);
+    }
+    while (i < len)
+    {
+        if ((p[i] < 0x80) || (i + 1 == len) || (_CharLen(p + i) == 1))
+        {
+            ascii++;
+            i++;
+        }
+        else
+        {
+            pairs++;
+            i += 2;
+        }
+    }
+    return ascii * f.ascii_w + pairs * f.gbk_w;
+}
+
+/* Find the line starting at p that fits in width pixels.
+ * *len and *w receive its bytes and width, trailing spaces excluded, *clipped whether the
+ * line was cut short of a newline or of the end of the text.
+ * Returns the start of the next line */
+static const unsigned char * _NextLine(const unsigned char * p, int width, const layout_font_t * f,
+        int wrap, int * len, int * w, int * clipped)
+{
+    const unsigned char * q = p;
+    const unsigned char * brk = NULL;
+    int brk_w = 0;
+    int x = 0;
+    int n;
+    int cw;
+    int cjk_prev = FALSE;
+
+    while ((*q != '\0') && (*q != '\n'))
+    {
+        n = _CharLen(q);
+        cw = (n == 2) ? f->gbk_w : f->ascii_w;
+        /* A line may end before a space, before a CJK character or after one */
+        if ((*q == ' ') || (n == 2) || cjk_prev)
+        {
+            brk = q;
+            brk_w = x;
+        }
+        if (x + cw > width)
+        {
+            break;
+        }
+        x += cw;
+        cjk_prev = (n == 2);
+        q += n;
+    }
+
+    *clipped = (*q != '\0') && (*q != '\n');
+    if (*clipped && wrap && (brk != NULL) && (brk > p))
+    {
+        q = brk;
+        x = brk_w;
+    }
+    *len = q - p;
+    *w = x;
+    while ((*len > 0) && (p[*len - 1] == ' '))
+    {
+        (*len)--;
+        *w -= f->ascii_w;
+    }
+
+    if (*clipped && !wrap)
+    {
+        while ((*q != '\0') && (*q != '\n'))
+        {
+            q++;
+        }
+    }
+    if (*q == '\n')
+    {
+        return q + 1;
+    }
+    while (*q == ' ')
+    {
+        q++;
+    }
+    return q;
+}
+
+/* Longest part of the line that fits in width pixels once "..." is added */
+static int _Ellipsize(const unsigned char * p, int width, const layout_font_t * f, int * w)
+{
+    int len = 0;
+    int x = 0;
+    int n;
+    int cw;
+
+    width -= 3 * f->ascii_w;
+    while ((p[len] != '\0') && (p[len] != '\n'))
+    {
+        n = _CharLen(p + len);
+        cw = (n == 2) ? f->gbk_w : f->ascii_w;
+        if (x + cw > width)
+        {
+            break;
+        }
+        x += cw;
+        len += n;
+    }
+    while ((len > 0) && (p[len - 1] == ' '))
+    {
+        len--;
+        x -= f->ascii_w;
+    }
+    *w = x + 3 * f->ascii_w;
+    return len;
+}
+
+/* Lay out the text, drawing it if draw is set. Returns the number of lines, or of frames sent
+ * when drawing */
+static int _Layout(const lib_epd_layout_t * box, const char * gbk, int draw)
+{
+    unsigned char line[FRAME_BUFF_SIZE];
+    const unsigned char * p = (const unsigned char *) gbk;
+    const unsigned char * next;
+    layout_font_t f;
+    int width = box->x1 - box->x0 + 1;
+    int height = box->y1 - box->y0 + 1;
+    int wrap = (box->flags & EPD_LAYOUT_WRAP) != 0;
+    int lines = 0;
+    int frames = 0;
+    int total;
+    int clipped;
+    int len;
+    int w;
+    int x;
+    int y = box->y0;
+
+    _Fonts(&f);
+    if (draw && (box->valign != EPD_ALIGN_TOP))
+    {
+        lines = _Layout(box, gbk, FALSE);
+        total = lines * f.line_h + ((lines > 0) ? (lines - 1) * box->line_gap : 0);
+        if (total < height)
+        {
+            y += (box->valign == EPD_ALIGN_MIDDLE) ? (height - total) / 2 : height - total;
+        }
+        lines = 0;
+    }
+
+    while ((*p != '\0') && (y + f.line_h - 1 <= box->y1))
+    {
+        next = _NextLine(p, width, &f, wrap, &len, &w, &clipped);
+        if ((box->flags & EPD_LAYOUT_ELLIPSIS)
+                && ((clipped && !wrap)
+                        || ((*next != '\0') && (y + 2 * f.line_h + box->line_gap - 1 > box->y1))))
+        {
+            len = _Ellipsize(p, width, &f, &w);
+            if (len > FRAME_BUFF_SIZE - 17)
+            {
+                len = FRAME_BUFF_SIZE - 17;
+            }
+            memcpy(line, p, len);
+            memcpy(line + len, "...", 4);
+            len += 3;
+        }
+        else
+        {
+            if (len > FRAME_BUFF_SIZE - 14)
+            {
+                len = FRAME_BUFF_SIZE - 14;
+            }
+            memcpy(line, p, len);
+            line[len] = '\0';
+        }
+
+        if (draw && (len > 0))
+        {
+            x = box->x0;
+            if (box->align == EPD_ALIGN_CENTER)
+            {
+                x += (width - w) / 2;
+            }
+            else if (box->align == EPD_ALIGN_RIGHT)
+            {
+                x += width - w;
+            }
+            LibEpdDispString(line, x, y);
+            frames++;
+        }
+        lines++;
+        y += f.line_h + box->line_gap;
+        p = next;
+    }
+
+    return draw ? frames : lines;
+}
+
+/* Number of lines the GBK text takes in the box, at most as many as fit */
+int LibEpdLayoutLines(const lib_epd_layout_t * box, const char * gbk)
+{
+    return _Layout(box, gbk, FALSE);
+}
+
+/* Draw GBK text in the box with the fonts last set. Returns the number of frames sent */
+int LibEpdLayoutText(const lib_epd_layout_t * box, const char * gbk)
+{
+    return _Layout(box, gbk, TRUE);
+}
+
+/* Draw UTF-8 text in the box, see LibEpdLayoutText() */
+int LibEpdLayoutUtf8(const lib_epd_layout_t * box, const char * utf8)
+{
+    unsigned char gbk[LAYOUT_MAX_TEXT];
+
+    LibGbkFromUtf8(utf8, gbk, sizeof(gbk));
+    return _Layout(box, (const char *) gbk, TRUE);
+}
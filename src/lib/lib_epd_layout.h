@@ -0,0 +1,47 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_layout.h
+ * @brief   API of the text layout with the fonts built into the e-paper.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_LAYOUT_H
+#define LIB_EPD_LAYOUT_H
+
+/* Horizontal alignment */
+#define    EPD_ALIGN_LEFT                     0
+#define    EPD_ALIGN_CENTER                   1
+#define    EPD_ALIGN_RIGHT                    2
+
+/* Vertical alignment */
+#define    EPD_ALIGN_TOP                      0
+#define    EPD_ALIGN_MIDDLE                   1
+#define    EPD_ALIGN_BOTTOM                   2
+
+/* Layout flags */
+#define    EPD_LAYOUT_WRAP                    0x01    /* Break lines at spaces and CJK characters */
+#define    EPD_LAYOUT_ELLIPSIS                0x02    /* End cut text with "..." */
+
+/* Text box */
+typedef struct
+{
+    int x0;             /* Corners included */
+    int y0;
+    int x1;
+    int y1;
+    int align;
+    int valign;
+    int flags;
+    int line_gap;       /* Pixels between lines */
+} lib_epd_layout_t;
+
+int LibEpdFontDots(unsigned char font);
+int LibEpdTextWidth(const char * gbk, int len);
+int LibEpdLayoutLines(const lib_epd_layout_t * box, const char * gbk);
+int LibEpdLayoutText(const lib_epd_layout_t * box, const char * gbk);
+int LibEpdLayoutUtf8(const lib_epd_layout_t * box, const char * utf8);
+
+#endif
@@ -0,0 +1,423 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_link.c
+ * @brief   Acknowledged transport of frames to the e-paper.
+ *
+ *          The e-paper answers every frame it executes with "OK", or "Error" when the checksum
+ *          does not match, one reply per frame and in order. Replies carry no sequence number,
+ *          so the n-th reply belongs to the n-th frame still waiting for one.
+ *
+ *          Several frames are kept in flight, and only the frames that may have failed are sent
+ *          again:
+ *          - a frame answered "Error" is sent again after the others;
+ *          - a frame with no reply by its predicted cost (see lib_epd_cost) plus a margin means
+ *            a frame or a reply was lost, and since the replies that came may then belong to
+ *            other frames, every frame since the last sync point is sent again, in order, once
+ *            the line is quiet.
+ *          A sync point is when every frame sent got its reply: frames are logged from one to
+ *          the next, and the window is drained when the log is full to keep it bounded.
+ *          A frame is given up after EPD_LINK_TRIES sends.
+ *
+ *          Resending out of order is only safe for frames whose order does not matter: pixels,
+ *          lines, rectangles, circles and triangles all paint the current color, so they
+ *          commute and may run twice. Any other frame (settings, text, bitmaps, clear, update)
+ *          goes alone, the window drained before and after it.
+ *
+ *          The window grows by one after a window worth of "OK" in a row and is halved on
+ *          every error or timeout, so it settles at what the error rate of the link allows.
+ *
+ *          The transport is the EPD_LAYER_LINK layer of lib_epd.c while open, so every frame
+ *          written through lib_epd goes through it, the frames of the lanes (lib_epd_lane.c) and
+ *          of the daemon included. Meant for drawing from one thread: LibEpdWaitReady() in
+ *          another thread would take the replies. With the lanes running, that thread is their
+ *          dispatcher, so draw through the lanes only.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_cost.h"
+#include "lib_epd_link.h"
+#include "drv_uart.h"
+#include "lib_epd_trace.h"
+
+#define LINK_RX_SIZE        64
+#define LINK_WINDOW_START   4
+#define LINK_QUIET_READS    100     /* Bound on the reads waiting for the line to be quiet */
+#define LINK_SHAPE_MAX      32      /* Longest commuting frame, a filled triangle is 21 bytes */
+#define LINK_LOG_SIZE       (4 * EPD_LINK_WINDOW_MAX)
+#define LINK_LOG_NEW        (LINK_LOG_SIZE - EPD_LINK_WINDOW_MAX)   /* Rest kept for resends */
+
+/* Frame sent since the last sync point */
+typedef struct
+{
+    unsigned char data[LINK_SHAPE_MAX];
+    int len;
+    int alone;                  /* Frame held in s_alone instead of data */
+    int tries;
+    long long sent_us;
+    long long due_us;           /* Latest time expected for its reply, margin excluded */
+} link_frame_t;
+
+/* Frames [0, s_acked) got their reply, [s_acked, s_sent) are in flight, the rest to be sent */
+static link_frame_t s_log[LINK_LOG_SIZE];
+static int s_log_len = 0;
+static int s_acked = 0;
+static int s_sent = 0;
+static int s_redo = FALSE;      /* An "Error" found the log full: send it all again when drained */
+static unsigned char s_alone[FRAME_BUFF_SIZE];
+static int s_enabled = FALSE;
+static int s_window_max = 1;
+static int s_clean = 0;         /* "OK" in a row since the window last changed */
+static int s_lost = FALSE;      /* A frame was given up since the last flush */
+static long long s_due_us = 0;  /* Due time of the newest frame in flight */
+static unsigned char s_rx[LINK_RX_SIZE];
+static int s_rx_len = 0;
+static lib_epd_link_stats_t s_stats;
+static const lib_epd_layer_t s_layer = { LibEpdLinkWrite, LibEpdLinkFlush };
+
+/* Frames that may be reordered and repeated */
+static int _Commutes(unsigned char cmd)
+{
+    switch (cmd)
+    {
+    case CMD_DRAW_PIXEL:
+    case CMD_DRAW_LINE:
+    case CMD_FILL_RECT:
+    case CMD_DRAW_RECT:
+    case CMD_DRAW_CIRCLE:
+    case CMD_FILL_CIRCLE:
+    case CMD_DRAW_TRIANGLE:
+    case CMD_FILL_TRIANGLE:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+static const unsigned char * _Data(const link_frame_t * frame)
+{
+    return frame->alone ? s_alone : frame->data;
+}
+
+static void _GiveUp(const link_frame_t * frame)
+{
+    fprintf(stderr, "LibEpdLink: frame 0x%02X given up after %d sends\n", _Data(frame)[3],
+            frame->tries);
+    s_stats.lost++;
+    s_lost = TRUE;
+}
+
+static int _Transmit(link_frame_t * frame)
+{
+    const unsigned char * data = _Data(frame);
+    long long now = LibClockNowUs();
+
+    if (LibEpdWriteAfter(EPD_LAYER_LINK, data, frame->len) < 0)
+    {
+        return FALSE;
+    }
+    if (frame->tries++ > 0)
+    {
+        s_stats.resent++;
+    }
+    /* The e-paper runs the frames one after the other */
+    frame->sent_us = now;
+    s_due_us = ((s_due_us > now) ? s_due_us : now) + LibEpdCostFrameUs(data);
+    frame->due_us = s_due_us;
+    return TRUE;
+}
+
+/* Send the frames of the log the window allows */
+static int _Pump(void)
+{
+    while ((s_sent < s_log_len) && (s_sent - s_acked < s_stats.window))
+    {
+        if (!_Transmit(&s_log[s_sent]))
+        {
+            return FALSE;
+        }
+        s_sent++;
+    }
+    return TRUE;
+}
+
+static void _Shrink(void)
+{
+    s_stats.window = (s_stats.window > 1) ? s_stats.window / 2 : 1;
+    s_clean = 0;
+}
+
+/* Every frame sent got its reply, so the next reply is for the next frame */
+static void _Sync(void)
+{
+    if (s_redo)
+    {
+        s_redo = FALSE;
+        s_acked = 0;
+        s_sent = 0;
+        return;
+    }
+    s_log_len = 0;
+    s_acked = 0;
+    s_sent = 0;
+}
+
+/* Match a reply to the oldest frame in flight */
+static void _Reply(int ok)
+{
+    link_frame_t * frame;
+    long rtt;
+
+    if (s_acked == s_sent)
+    {
+        return;     /* Late reply to a frame already sent again */
+    }
+    frame = &s_log[s_acked++];
+    EPD_TRACE_INSTANT("ack", ok);
+
+    rtt = (long) (LibClockNowUs() - frame->sent_us);
+    s_stats.rtt_us += (s_stats.rtt_us == 0) ? rtt : (rtt - s_stats.rtt_us) / 8;
+    if (ok)
+    {
+        s_stats.frames++;
+        if ((++s_clean >= s_stats.window) && (s_stats.window < s_window_max))
+        {
+            s_stats.window++;
+            s_clean = 0;
+        }
+    }
+    else
+    {
+        s_stats.errors++;
+        _Shrink();
+        if (frame->tries >= EPD_LINK_TRIES)
+        {
+            _GiveUp(frame);
+        }
+        else if (s_log_len < LINK_LOG_SIZE)
+        {
+            s_log[s_log_len++] = *frame;
+        }
+        else
+        {
+            s_redo = TRUE;
+        }
+    }
+    if (s_acked == s_log_len)
+    {
+        _Sync();
+    }
+}
+
+/* Take the complete replies out of the receive buffer, skipping noise */
+static void _Parse(void)
+{
+    const unsigned char * p;
+    int used = 0;
+    int rest;
+
+    while (used < s_rx_len)
+    {
+        p = s_rx + used;
+        rest = s_rx_len - used;
+        if ((rest >= 2) && (memcmp(p, "OK", 2) == 0))
+        {
+            used += 2;
+            _Reply(TRUE);
+        }
+        else if ((rest >= 5) && (memcmp(p, "Error", 5) == 0))
+        {
+            used += 5;
+            _Reply(FALSE);
+        }
+        else if (((rest < 2) && (memcmp(p, "OK", rest) == 0))
+                || ((rest < 5) && (memcmp(p, "Error", rest) == 0)))
+        {
+            break;      /* Rest of the reply still to come */
+        }
+        else
+        {
+            used++;
+        }
+    }
+    memmove(s_rx, s_rx + used, s_rx_len - used);
+    s_rx_len -= used;
+}
+
+/* The oldest frame got no reply: wait for the line to fall quiet, then send again every frame
+ * since the last sync point, since which of them the e-paper took can no longer be told */
+static void _Timeout(void)
+{
+    int n = 0;
+    int i;
+
+    s_stats.timeouts += s_sent - s_acked;
+    EPD_TRACE_INSTANT("timeout", s_sent - s_acked);
+    _Shrink();
+    for (i = 0; (i < LINK_QUIET_READS) && (DrvUartRead(s_rx, LINK_RX_SIZE, EPD_LINK_QUIET_US) > 0); i++)
+    {
+    }
+    DrvUartFlushInput();
+    s_rx_len = 0;
+
+    for (i = 0; i < s_log_len; i++)
+    {
+        if (s_log[i].tries < EPD_LINK_TRIES)
+        {
+            s_log[n++] = s_log[i];
+        }
+        else if (i >= s_acked)
+        {
+            _GiveUp(&s_log[i]);
+        }
+    }
+    s_log_len = n;
+    s_redo = FALSE;
+    s_acked = 0;
+    s_sent = 0;
+    s_due_us = 0;
+}
+
+/* Send what the window allows, then wait for the next reply or the timeout of the oldest
+ * frame in flight. Returns FALSE on an I/O error */
+static int _Step(void)
+{
+    long long now;
+    long long due;
+    int n;
+
+    if (!_Pump())
+    {
+        return FALSE;
+    }
+    if (s_acked == s_sent)
+    {
+        return TRUE;
+    }
+    now = LibClockNowUs();
+    due = s_log[s_acked].due_us + EPD_LINK_MARGIN_US;
+    if (now >= due)
+    {
+        _Timeout();
+        return TRUE;
+    }
+    n = DrvUartRead(s_rx + s_rx_len, LINK_RX_SIZE - s_rx_len, (long) (due - now));
+    if (n < 0)
+    {
+        perror("LibEpdLink");
+        return FALSE;
+    }
+    s_rx_len += n;
+    _Parse();
+    return TRUE;
+}
+
+/* Send frames through the transport from now on, at most window_max (up to
+ * EPD_LINK_WINDOW_MAX) in flight. Returns TRUE */
+int LibEpdLinkOpen(int window_max)
+{
+    s_window_max = (window_max < 1) ? 1
+            : ((window_max > EPD_LINK_WINDOW_MAX) ? EPD_LINK_WINDOW_MAX : window_max);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.window = (s_window_max < LINK_WINDOW_START) ? s_window_max : LINK_WINDOW_START;
+    s_log_len = 0;
+    s_acked = 0;
+    s_sent = 0;
+    s_redo = FALSE;
+    s_clean = 0;
+    s_lost = FALSE;
+    s_due_us = 0;
+    s_rx_len = 0;
+    DrvUartFlushInput();
+    s_enabled = TRUE;
+    LibEpdSetLayer(EPD_LAYER_LINK, &s_layer);
+    return TRUE;
+}
+
+/* Wait for the frames in flight and go back to plain writes. Returns the result of the flush */
+int LibEpdLinkClose(void)
+{
+    int ok = LibEpdLinkFlush();
+
+    s_enabled = FALSE;
+    LibEpdSetLayer(EPD_LAYER_LINK, NULL);
+    return ok;
+}
+
+int LibEpdLinkEnabled(void)
+{
+    return s_enabled;
+}
+
+/* Send whole encoded frames. Returns n, or -1 on an I/O error.
+ * Frames given up are only reported by LibEpdLinkFlush() */
+int LibEpdLinkWrite(const unsigned char * ptr, int n)
+{
+    link_frame_t * frame;
+    int off;
+    int len;
+    int alone;
+
+    for (off = 0; off < n; off += len)
+    {
+        len = LibEpdFrameLen(ptr + off);
+        if ((len <= 3) || (len > FRAME_BUFF_SIZE) || (off + len > n))
+        {
+            fprintf(stderr, "LibEpdLinkWrite: broken frame\n");
+            return -1;
+        }
+        alone = !_Commutes(ptr[off + 3]) || (len > LINK_SHAPE_MAX);
+        while ((s_log_len > 0) && (alone || (s_log_len >= LINK_LOG_NEW)))
+        {
+            if (!_Step())
+            {
+                return -1;
+            }
+        }
+        frame = &s_log[s_log_len++];
+        memcpy(alone ? s_alone : frame->data, ptr + off, len);
+        frame->len = len;
+        frame->alone = alone;
+        frame->tries = 0;
+        if (!_Pump())
+        {
+            return -1;
+        }
+        while (alone && (s_log_len > 0))
+        {
+            if (!_Step())
+            {
+                return -1;
+            }
+        }
+    }
+    return n;
+}
+
+/* Wait until every frame sent is acknowledged or given up.
+ * Returns TRUE if none was given up since the last flush */
+int LibEpdLinkFlush(void)
+{
+    int ok;
+
+    while (s_log_len > 0)
+    {
+        if (!_Step())
+        {
+            return FALSE;
+        }
+    }
+    ok = !s_lost;
+    s_lost = FALSE;
+    return ok;
+}
+
+void LibEpdLinkGetStats(lib_epd_link_stats_t * stats)
+{
+    *stats = s_stats;
+}
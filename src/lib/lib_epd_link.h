@@ -0,0 +1,47 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_link.h
+ * @brief   API of the acknowledged transport of frames to the e-paper.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_LINK_H
+#define LIB_EPD_LINK_H
+
+/* Most frames in flight */
+#define    EPD_LINK_WINDOW_MAX                16
+
+/* Sends of a frame before it is given up */
+#define    EPD_LINK_TRIES                     5
+
+/* Time allowed over the predicted cost of a frame before its reply is given up */
+#define    EPD_LINK_MARGIN_US                 100000
+
+/* Silence waited for after a timeout, so late replies are not taken for new ones */
+#define    EPD_LINK_QUIET_US                  20000
+
+/* Transport counters */
+typedef struct
+{
+    unsigned long frames;       /* Frames acknowledged "OK" */
+    unsigned long errors;       /* "Error" replies */
+    unsigned long timeouts;     /* Frames whose reply never came */
+    unsigned long resent;       /* Frames sent again */
+    unsigned long lost;         /* Frames given up after EPD_LINK_TRIES sends */
+    int window;                 /* Frames allowed in flight now */
+    long rtt_us;                /* Smoothed time from sending a frame to its reply */
+} lib_epd_link_stats_t;
+
+int LibEpdLinkOpen(int window_max);
+int LibEpdLinkClose(void);
+int LibEpdLinkEnabled(void);
+
+int LibEpdLinkWrite(const unsigned char * ptr, int n);
+int LibEpdLinkFlush(void);
+
+void LibEpdLinkGetStats(lib_epd_link_stats_t * stats);
+
+#endif
@@ -0,0 +1,258 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_mem.c
+ * @brief   Memory behind the buffers of the e-paper library.
+ *
+ *          By default the pools are only counters in front of malloc(). With EPD_STATIC_ALLOC
+ *          each pool is a fixed number of fixed size blocks, linked in a free list, carved out
+ *          of the arena once. A request larger than a block or met with no free block fails at
+ *          once: the caller gives up what it was doing, or the process aborts, as the policy
+ *          says. Growing a block is free up to its size, so a scene or a glyph keeps one block
+ *          however often it grows.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <pthread.h>
+#include "common.h"
+#include "lib_epd_mem.h"
+
+#if defined(EPD_STATIC_ALLOC) && defined(EPD_RAM_BUDGET) && (EPD_MEM_FOOTPRINT > EPD_RAM_BUDGET)
+#error "EPD_MEM_FOOTPRINT is over EPD_RAM_BUDGET, lower the pool sizes"
+#endif
+
+typedef struct
+{
+    unsigned char * base;
+    void * free;                /* Free blocks, linked through their first bytes */
+    lib_epd_mem_stats_t stats;
+} mem_pool_t;
+
+static const char * const c_mem_name[EPD_MEM_POOLS] = { "scene", "queue", "glyph", "scratch" };
+static const long c_mem_block[EPD_MEM_POOLS] =
+{
+    EPD_MEM_ROUND(EPD_SCENE_BYTES),
+    EPD_MEM_ROUND(EPD_QUEUE_BYTES),
+    EPD_MEM_ROUND(EPD_GLYPH_BYTES),
+    EPD_MEM_ROUND(EPD_SCRATCH_BYTES),
+};
+static const int c_mem_blocks[EPD_MEM_POOLS] =
+{
+    EPD_SCENE_POOL, EPD_QUEUE_POOL, EPD_GLYPH_POOL, EPD_SCRATCH_POOL,
+};
+
+#if defined(EPD_STATIC_ALLOC) && !defined(EPD_MEM_EXTERNAL_ARENA)
+static union
+{
+    double align;
+    void * ptr;
+    unsigned char bytes[EPD_MEM_FOOTPRINT];
+} s_arena;
+#endif
+
+static mem_pool_t s_pool[EPD_MEM_POOLS];
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static int s_policy = EPD_MEM_FAIL;
+
+#ifdef EPD_STATIC_ALLOC
+static int s_ready = FALSE;
+
+/* Cut the arena into the pools, called with the lock held */
+static void _Carve(unsigned char * arena)
+{
+    unsigned char * p = arena;
+    int i;
+    int j;
+
+    memset(s_pool, 0, sizeof(s_pool));
+    for (i = 0; i < EPD_MEM_POOLS; i++)
+    {
+        s_pool[i].base = p;
+        s_pool[i].stats.block = c_mem_block[i];
+        s_pool[i].stats.blocks = c_mem_blocks[i];
+        for (j = c_mem_blocks[i] - 1; j >= 0; j--)
+        {
+            *(void **) (p + j * c_mem_block[i]) = s_pool[i].free;
+            s_pool[i].free = p + j * c_mem_block[i];
+        }
+        p += c_mem_block[i] * c_mem_blocks[i];
+    }
+    s_ready = TRUE;
+}
+#endif
+
+/* Give the pools their memory: size bytes at arena, at least EPD_MEM_FOOTPRINT and aligned on
+ * EPD_MEM_ALIGN, or the built-in arena if NULL. To be called before any buffer is taken.
+ * Returns TRUE on success, always without EPD_STATIC_ALLOC */
+int LibEpdMemInit(void * arena, long size)
+{
+#ifdef EPD_STATIC_ALLOC
+    int i;
+
+#ifndef EPD_MEM_EXTERNAL_ARENA
+    if (arena == NULL)
+    {
+        arena = s_arena.bytes;
+        size = sizeof(s_arena.bytes);
+    }
+#endif
+    if ((arena == NULL) || (size < EPD_MEM_FOOTPRINT) || ((unsigned long) arena % EPD_MEM_ALIGN != 0))
+    {
+        fprintf(stderr, "LibEpdMemInit: arena of %ld bytes, %ld aligned ones needed\n", size,
+                (long) EPD_MEM_FOOTPRINT);
+        return FALSE;
+    }
+
+    pthread_mutex_lock(&s_lock);
+    for (i = 0; s_ready && (i < EPD_MEM_POOLS); i++)
+    {
+        if (s_pool[i].stats.used > 0)
+        {
+            pthread_mutex_unlock(&s_lock);
+            fprintf(stderr, "LibEpdMemInit: %s blocks still in use\n", c_mem_name[i]);
+            return FALSE;
+        }
+    }
+    _Carve(arena);
+    pthread_mutex_unlock(&s_lock);
+#else
+    (void) arena;
+    (void) size;
+#endif
+    return TRUE;
+}
+
+/* Policy on a refused request, EPD_MEM_FAIL (the default) or EPD_MEM_ABORT */
+void LibEpdMemSetPolicy(int policy)
+{
+    s_policy = policy;
+}
+
+/* Count a refused request, said once per pool, and apply the policy */
+static void _Refuse(int pool, long size)
+{
+    int first;
+
+    pthread_mutex_lock(&s_lock);
+    first = (s_pool[pool].stats.failures++ == 0);
+    pthread_mutex_unlock(&s_lock);
+
+    if (first || (s_policy == EPD_MEM_ABORT))
+    {
+        fprintf(stderr, "LibEpdMem: no %s block for %ld bytes\n", c_mem_name[pool], size);
+    }
+    if (s_policy == EPD_MEM_ABORT)
+    {
+        abort();
+    }
+}
+
+/* Take a buffer of size bytes from a pool. Returns NULL if refused */
+void * LibEpdMemAlloc(int pool, long size)
+{
+    return LibEpdMemRealloc(pool, NULL, size);
+}
+
+/* Grow or shrink a buffer of a pool, see realloc(). Returns NULL if refused, p being kept */
+void * LibEpdMemRealloc(int pool, void * p, long size)
+{
+#ifdef EPD_STATIC_ALLOC
+    mem_pool_t * mp = &s_pool[pool];
+
+    pthread_mutex_lock(&s_lock);
+#ifndef EPD_MEM_EXTERNAL_ARENA
+    if (!s_ready)
+    {
+        _Carve(s_arena.bytes);
+    }
+#endif
+    if ((size > c_mem_block[pool]) || ((p == NULL) && (mp->free == NULL)))
+    {
+        pthread_mutex_unlock(&s_lock);
+        _Refuse(pool, size);
+        return NULL;
+    }
+    if (p == NULL)
+    {
+        p = mp->free;
+        mp->free = *(void **) p;
+        mp->stats.used++;
+        mp->stats.peak = (mp->stats.used > mp->stats.peak) ? mp->stats.used : mp->stats.peak;
+    }
+    pthread_mutex_unlock(&s_lock);
+    return p;
+#else
+    void * q = realloc(p, (size > 0) ? size : 1);
+
+    if (q == NULL)
+    {
+        perror("LibEpdMem");
+        _Refuse(pool, size);
+        return NULL;
+    }
+    if (p == NULL)
+    {
+        pthread_mutex_lock(&s_lock);
+        s_pool[pool].stats.used++;
+        if (s_pool[pool].stats.used > s_pool[pool].stats.peak)
+        {
+            s_pool[pool].stats.peak = s_pool[pool].stats.used;
+        }
+        pthread_mutex_unlock(&s_lock);
+    }
+    return q;
+#endif
+}
+
+/* Give a buffer back to its pool */
+void LibEpdMemFree(int pool, void * p)
+{
+    if (p == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+#ifdef EPD_STATIC_ALLOC
+    *(void **) p = s_pool[pool].free;
+    s_pool[pool].free = p;
+#else
+    free(p);
+#endif
+    s_pool[pool].stats.used--;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void LibEpdMemGetStats(int pool, lib_epd_mem_stats_t * stats)
+{
+    pthread_mutex_lock(&s_lock);
+    *stats = s_pool[pool].stats;
+#ifdef EPD_STATIC_ALLOC
+    stats->block = c_mem_block[pool];
+    stats->blocks = c_mem_blocks[pool];
+#endif
+    pthread_mutex_unlock(&s_lock);
+}
+
+/* Print the worst case footprint of the pools and their use so far */
+void LibEpdMemReport(FILE * out)
+{
+    lib_epd_mem_stats_t st;
+    int i;
+
+    fprintf(out, "%-8s %8s %7s %9s %6s %6s %9s\n", "pool", "block", "blocks", "bytes", "used",
+            "peak", "refused");
+    for (i = 0; i < EPD_MEM_POOLS; i++)
+    {
+        LibEpdMemGetStats(i, &st);
+        fprintf(out, "%-8s %8ld %7d %9ld %6d %6d %9lu\n", c_mem_name[i], c_mem_block[i],
+                c_mem_blocks[i], c_mem_block[i] * c_mem_blocks[i], st.used, st.peak, st.failures);
+    }
+#ifdef EPD_STATIC_ALLOC
+    fprintf(out, "arena %ld bytes, no heap\n", (long) EPD_MEM_FOOTPRINT);
+#else
+    fprintf(out, "arena %ld bytes if built with EPD_STATIC_ALLOC, heap in use\n",
+            (long) EPD_MEM_FOOTPRINT);
+#endif
+}
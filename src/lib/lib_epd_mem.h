@@ -0,0 +1,88 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_mem.h
+ * @brief   API of the memory behind the buffers of the e-paper library.
+ *
+ *          Built with EPD_STATIC_ALLOC defined, every buffer comes from fixed pools carved out of
+ *          one arena at init and nothing is taken from the heap. The capacities below may be
+ *          overridden on the compiler command line, and EPD_RAM_BUDGET set to make the build
+ *          fail when the worst case footprint goes over it. Scenes and glyphs grow by doubling,
+ *          so their blocks are best a power of two.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_MEM_H
+#define LIB_EPD_MEM_H
+
+/* Pools */
+#define    EPD_MEM_SCENE                      0       /* Recorded scenes */
+#define    EPD_MEM_QUEUE                      1       /* Scenes queued to the lanes */
+#define    EPD_MEM_GLYPH                      2       /* Rectangles of cached glyphs */
+#define    EPD_MEM_SCRATCH                    3       /* Buffers held during one call */
+#define    EPD_MEM_POOLS                      4
+
+/* Bytes and number of the blocks of each pool. Unless EPD_MEM_EXTERNAL_ARENA is defined,
+ * an arena of EPD_MEM_FOOTPRINT bytes is built in and used if LibEpdMemInit() is given none */
+#ifndef EPD_SCENE_BYTES
+#define    EPD_SCENE_BYTES                    16384
+#endif
+#ifndef EPD_SCENE_POOL
+#define    EPD_SCENE_POOL                     8
+#endif
+#ifndef EPD_QUEUE_BYTES
+#define    EPD_QUEUE_BYTES                    64
+#endif
+#ifndef EPD_QUEUE_POOL
+#define    EPD_QUEUE_POOL                     16
+#endif
+#ifndef EPD_GLYPH_BYTES
+#define    EPD_GLYPH_BYTES                    2560
+#endif
+#ifndef EPD_GLYPH_POOL
+#define    EPD_GLYPH_POOL                     64
+#endif
+#ifndef EPD_SCRATCH_BYTES
+#define    EPD_SCRATCH_BYTES                  65536
+#endif
+#ifndef EPD_SCRATCH_POOL
+#define    EPD_SCRATCH_POOL                   4
+#endif
+
+/* Blocks are rounded up to keep them aligned */
+#define    EPD_MEM_ALIGN                      8
+#define    EPD_MEM_ROUND(n)                   (((n) + EPD_MEM_ALIGN - 1) / EPD_MEM_ALIGN * EPD_MEM_ALIGN)
+
+/* Worst case bytes of the arena */
+#define    EPD_MEM_FOOTPRINT                  (EPD_MEM_ROUND(EPD_SCENE_BYTES) * EPD_SCENE_POOL \
+                                             + EPD_MEM_ROUND(EPD_QUEUE_BYTES) * EPD_QUEUE_POOL \
+                                             + EPD_MEM_ROUND(EPD_GLYPH_BYTES) * EPD_GLYPH_POOL \
+                                             + EPD_MEM_ROUND(EPD_SCRATCH_BYTES) * EPD_SCRATCH_POOL)
+
+/* What to do when a pool is exhausted or a block too small */
+#define    EPD_MEM_FAIL                       0       /* Return NULL, the call gives up */
+#define    EPD_MEM_ABORT                      1       /* Abort the process */
+
+/* Use of a pool */
+typedef struct
+{
+    long block;                 /* Bytes per block, 0 when on the heap */
+    int blocks;
+    int used;
+    int peak;
+    unsigned long failures;     /* Requests refused */
+} lib_epd_mem_stats_t;
+
+int LibEpdMemInit(void * arena, long size);
+void LibEpdMemSetPolicy(int policy);
+
+void * LibEpdMemAlloc(int pool, long size);
+void * LibEpdMemRealloc(int pool, void * p, long size);
+void LibEpdMemFree(int pool, void * p);
+
+void LibEpdMemGetStats(int pool, lib_epd_mem_stats_t * stats);
+void LibEpdMemReport(FILE * out);
+
+#endif
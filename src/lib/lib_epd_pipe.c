@@ -0,0 +1,174 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_pipe.c
+ * @brief   Double-buffered scene pipeline of the e-paper screen.
+ *
+ *          The application records scene N+1 into the back buffer while a worker thread
+ *          transmits scene N and waits for the e-paper to finish refreshing it:
+ *
+ *          app:    | build N | build N+1 | stall | build N+2 | ...
+ *          worker:           | tx N | refresh N  | tx N+1 | refresh N+1 | ...
+ *
+ *          LibEpdPipeCommit() swaps the buffers once the e-paper reported ready for the previous
+ *          scene, so the time between two screens comes down to the refresh time.
+ *          Only the worker touches the UART while the pipeline is running.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <pthread.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_pipe.h"
+
+static lib_epd_scene_t s_buff[2];
+static lib_epd_scene_t * s_back = &s_buff[0];   /* Built by the application */
+static lib_epd_scene_t * s_front = &s_buff[1];  /* Owned by the worker */
+
+static pthread_t s_worker;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_cond = PTHREAD_COND_INITIALIZER;
+static int s_running = FALSE;
+static int s_busy = FALSE;      /* Worker holds a scene not yet refreshed */
+
+static long long s_begin_us = 0;
+static lib_epd_pipe_stats_t s_stats;
+
+/* Worker: transmit the front scene, then wait for the refresh to complete */
+static void * _Worker(void * arg)
+{
+    long long t0, t1, t2;
+
+    (void) arg;
+
+    pthread_mutex_lock(&s_lock);
+    while (s_running)
+    {
+        if (!s_busy)
+        {
+            pthread_cond_wait(&s_cond, &s_lock);
+            continue;
+        }
+        pthread_mutex_unlock(&s_lock);
+
+        t0 = LibClockNowUs();
+        LibEpdSceneSend(s_front);
+        t1 = LibClockNowUs();
+        if (!LibEpdWaitReady())
+        {
+            printf("LibEpdPipe: e-paper not ready\n");
+        }
+        t2 = LibClockNowUs();
+
+        pthread_mutex_lock(&s_lock);
+        s_stats.transmit_us = (long) (t1 - t0);
+        s_stats.refresh_us = (long) (t2 - t1);
+        s_stats.transmit_total_us += t1 - t0;
+        s_stats.refresh_total_us += t2 - t1;
+        s_busy = FALSE;
+        pthread_cond_broadcast(&s_cond);
+    }
+    pthread_mutex_unlock(&s_lock);
+
+    return NULL;
+}
+
+/* Start the worker. Returns TRUE on success */
+int LibEpdPipeInit(void)
+{
+    LibEpdSceneInit(&s_buff[0]);
+    LibEpdSceneInit(&s_buff[1]);
+    s_back = &s_buff[0];
+    s_front = &s_buff[1];
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    s_running = TRUE;
+    s_busy = FALSE;
+    if (pthread_create(&s_worker, NULL, _Worker, NULL) != 0)
+    {
+        perror("LibEpdPipeInit");
+        s_running = FALSE;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* Wait for the last scene, stop the worker and release the buffers */
+void LibEpdPipeClose(void)
+{
+    if (!s_running)
+    {
+        return;
+    }
+    LibEpdPipeDrain();
+
+    pthread_mutex_lock(&s_lock);
+    s_running = FALSE;
+    pthread_cond_broadcast(&s_cond);
+    pthread_mutex_unlock(&s_lock);
+    pthread_join(s_worker, NULL);
+
+    LibEpdSceneFree(&s_buff[0]);
+    LibEpdSceneFree(&s_buff[1]);
+}
+
+/* Start building the next scene into the back buffer */
+void LibEpdPipeBegin(void)
+{
+    LibEpdSceneReset(s_back);
+    LibEpdSceneBegin(s_back);
+    s_begin_us = LibClockNowUs();
+}
+
+/* Finish the scene with an update and hand it to the worker.
+ * Blocks only while the worker is still busy with the previous scene. */
+void LibEpdPipeCommit(void)
+{
+    lib_epd_scene_t * tmp;
+    long long t0, t1;
+
+    LibEpdUpdate();
+    LibEpdSceneEnd();
+    t0 = LibClockNowUs();
+
+    pthread_mutex_lock(&s_lock);
+    while (s_busy)
+    {
+        pthread_cond_wait(&s_cond, &s_lock);
+    }
+    t1 = LibClockNowUs();
+
+    tmp = s_front;
+    s_front = s_back;
+    s_back = tmp;
+    s_busy = TRUE;
+
+    s_stats.scenes++;
+    s_stats.build_us = (long) (t0 - s_begin_us);
+    s_stats.stall_us = (long) (t1 - t0);
+    s_stats.build_total_us += t0 - s_begin_us;
+    s_stats.stall_total_us += t1 - t0;
+    pthread_cond_broadcast(&s_cond);
+    pthread_mutex_unlock(&s_lock);
+}
+
+/* Wait until the last committed scene is on the screen */
+void LibEpdPipeDrain(void)
+{
+    pthread_mutex_lock(&s_lock);
+    while (s_busy)
+    {
+        pthread_cond_wait(&s_cond, &s_lock);
+    }
+    pthread_mutex_unlock(&s_lock);
+}
+
+void LibEpdPipeGetStats(lib_epd_pipe_stats_t * stats)
+{
+    pthread_mutex_lock(&s_lock);
+    *stats = s_stats;
+    pthread_mutex_unlock(&s_lock);
+}
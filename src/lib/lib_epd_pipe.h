@@ -0,0 +1,37 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_pipe.h
+ * @brief   API of the double-buffered scene pipeline of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_PIPE_H
+#define LIB_EPD_PIPE_H
+
+/* Stage timings in microseconds, of the last scene and summed over all scenes */
+typedef struct
+{
+    unsigned long scenes;       /* Scenes committed */
+    long build_us;              /* LibEpdPipeBegin() to LibEpdPipeCommit() */
+    long stall_us;              /* Commit waiting for the previous scene to finish */
+    long transmit_us;           /* Writing the frames to the UART */
+    long refresh_us;            /* Update command to e-paper ready */
+    long long build_total_us;
+    long long stall_total_us;
+    long long transmit_total_us;
+    long long refresh_total_us;
+} lib_epd_pipe_stats_t;
+
+int LibEpdPipeInit(void);
+void LibEpdPipeClose(void);
+
+void LibEpdPipeBegin(void);
+void LibEpdPipeCommit(void);
+void LibEpdPipeDrain(void);
+
+void LibEpdPipeGetStats(lib_epd_pipe_stats_t * stats);
+
+#endif
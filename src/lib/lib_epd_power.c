@@ -0,0 +1,252 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_power.c
+ * @brief   Power manager of the e-paper screen.
+ *
+ *          Puts the e-paper in stop mode once no frame was sent for the idle time, and wakes it
+ *          up again before it is needed:
+ *          - ahead of a refresh of the update scheduler, when the time left until it is due
+ *            falls under the expected wake latency plus EPD_POWER_LEAD_US, so the handshake is
+ *            over by the time the scene goes out;
+ *          - on demand, when a frame is sent in stop mode. The frame then waits for the wake
+ *            up, and that wait is counted as exposed latency.
+ *          The wake latency is measured from the wake up pulse to the handshake reply and
+ *          smoothed over the wakes.
+ *
+ *          The handshake reply of a wake up is waited for at most EPD_POWER_WAKE_TIMEOUTS times
+ *          the wake latency plus EPD_POWER_LEAD_US, not the timeout of the UART. A wake up that
+ *          gets no reply leaves the e-paper taken as asleep: the failure is counted, and the
+ *          frames are dropped without waking it again until a retry time, starting at
+ *          EPD_POWER_RETRY_MS and doubling on each failure up to EPD_POWER_RETRY_MAX_MS, so a
+ *          dead e-paper does not hold every frame up. Without a wired wake up
+ *          pin (see LibEpdSetWakeupGpio()) nothing could wake the e-paper, so the manager is
+ *          not started.
+ *
+ *          The manager is the EPD_LAYER_POWER layer of lib_epd.c while started, so every frame
+ *          written through lib_epd is noted, and wakes the e-paper up if needed.
+ *
+ *          LibEpdPowerPoll() has to be called from the main loop, before LibEpdSchedPoll(),
+ *          in the thread that draws. The idle time is best longer than a refresh, since the
+ *          e-paper only takes the stop frame once the refresh is over.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_sched.h"
+#include "lib_epd_power.h"
+
+static int s_enabled = FALSE;
+static int s_asleep = FALSE;
+static int s_busy = FALSE;          /* Frames sent by the manager itself */
+static long s_idle_ms = 0;
+static long long s_active_us = 0;   /* Latest frame sent */
+static long long s_stop_us = 0;     /* Stop mode entered */
+static long long s_prewake_us = -1; /* Pre-wake not yet followed by a frame, -1 if none */
+static long long s_retry_us = 0;    /* No wake up before this time after a failed one */
+static long s_retry_ms = 0;         /* Wait before the next retry, 0 after a successful wake */
+static lib_epd_power_stats_t s_stats;
+
+/* Write of the layer: wake the e-paper up if needed, then pass the frames on. The frames are
+ * dropped if the e-paper stays asleep */
+static int _Layer(const unsigned char * ptr, int n)
+{
+    if (!LibEpdPowerTouch())
+    {
+        s_stats.dropped++;
+        return -1;
+    }
+    return LibEpdWriteAfter(EPD_LAYER_POWER, ptr, n);
+}
+
+/* A handshake wakes the e-paper up too */
+static int _Flush(void)
+{
+    return LibEpdPowerTouch();
+}
+
+static const lib_epd_layer_t s_layer = { _Layer, _Flush };
+
+/* Wake the e-paper up and wait for its handshake reply. Returns the time taken, -1 if the
+ * e-paper did not answer */
+static long _Wake(void)
+{
+    long long start = LibClockNowUs();
+    long timeout = EPD_POWER_WAKE_TIMEOUTS * s_stats.wake_us + EPD_POWER_LEAD_US;
+    long latency;
+    int ok;
+
+    s_busy = TRUE;
+    LibEpdWakeup();
+    ok = LibEpdWaitReadyUs(timeout) || LibEpdWaitReadyUs(timeout);
+    s_busy = FALSE;
+    latency = (long) (LibClockNowUs() - start);
+    if (!ok)
+    {
+        /* Still asleep as far as we know */
+        s_retry_ms = (s_retry_ms == 0) ? EPD_POWER_RETRY_MS : 2 * s_retry_ms;
+        if (s_retry_ms > EPD_POWER_RETRY_MAX_MS)
+        {
+            s_retry_ms = EPD_POWER_RETRY_MAX_MS;
+        }
+        s_retry_us = LibClockNowUs() + s_retry_ms * 1000LL;
+        fprintf(stderr, "LibEpdPower: no handshake reply after wake up, retry in %ld ms\n",
+                s_retry_ms);
+        s_stats.wake_failures++;
+        return -1;
+    }
+
+    s_retry_ms = 0;
+    s_active_us = LibClockNowUs();
+    s_stats.stop_us += start - s_stop_us;
+    s_stats.wake_us += (latency - s_stats.wake_us) / 4;
+    s_asleep = FALSE;
+    return latency;
+}
+
+static void _Stop(void)
+{
+    s_busy = TRUE;
+    LibEpdEnterStopMode();
+    s_busy = FALSE;
+
+    s_stop_us = LibClockNowUs();
+    s_asleep = TRUE;
+    s_prewake_us = -1;
+    s_stats.stops++;
+}
+
+/* Manage the power from now on, entering stop mode after idle_ms without frames.
+ * The e-paper is taken to be awake. Returns FALSE if the wake up pin is not wired */
+int LibEpdPowerInit(int idle_ms)
+{
+    if (!LibEpdWakeupWired())
+    {
+        fprintf(stderr, "LibEpdPower: no wake up pin wired, stop mode left off\n");
+        s_enabled = FALSE;
+        return FALSE;
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.wake_us = EPD_POWER_WAKE_US;
+    s_idle_ms = idle_ms;
+    s_active_us = LibClockNowUs();
+    s_prewake_us = -1;
+    s_retry_ms = 0;
+    s_asleep = FALSE;
+    s_enabled = TRUE;
+    LibEpdSetLayer(EPD_LAYER_POWER, &s_layer);
+    return TRUE;
+}
+
+/* Stop managing the power, leaving the e-paper awake */
+void LibEpdPowerClose(void)
+{
+    if (s_enabled && s_asleep)
+    {
+        _Wake();
+    }
+    s_enabled = FALSE;
+    LibEpdSetLayer(EPD_LAYER_POWER, NULL);
+}
+
+/* Enter stop mode or wake up ahead of a refresh, as the time says */
+void LibEpdPowerPoll(void)
+{
+    long long now;
+    long long lead;
+    long due_ms;
+
+    if (!s_enabled || s_busy)
+    {
+        return;
+    }
+    now = LibClockNowUs();
+    lead = s_stats.wake_us + EPD_POWER_LEAD_US;
+    due_ms = LibEpdSchedNextDue();
+
+    if (s_asleep)
+    {
+        if ((due_ms >= 0) && (due_ms * 1000LL <= lead) && (now >= s_retry_us) && (_Wake() >= 0))
+        {
+            s_prewake_us = s_active_us;
+            s_stats.prewakes++;
+        }
+        return;
+    }
+    /* A stop shorter than two wake ups saves nothing */
+    if ((now - s_active_us >= s_idle_ms * 1000LL) && ((due_ms < 0) || (due_ms * 1000LL > 2 * lead)))
+    {
+        _Stop();
+    }
+}
+
+/* Note a frame about to be sent, waking the e-paper up first if in stop mode.
+ * Returns FALSE if the e-paper is still asleep, the frame would be lost */
+int LibEpdPowerTouch(void)
+{
+    long latency;
+
+    if (!s_enabled || s_busy)
+    {
+        return TRUE;
+    }
+    if (s_asleep)
+    {
+        if (LibClockNowUs() < s_retry_us)
+        {
+            return FALSE;
+        }
+        latency = _Wake();
+        if (latency < 0)
+        {
+            return FALSE;
+        }
+        s_stats.exposed_us += latency;
+        s_stats.demand_wakes++;
+    }
+    else
+    {
+        if (s_prewake_us >= 0)
+        {
+            s_stats.early_us += LibClockNowUs() - s_prewake_us;
+        }
+        s_active_us = LibClockNowUs();
+    }
+    s_prewake_us = -1;
+    return TRUE;
+}
+
+int LibEpdPowerAsleep(void)
+{
+    return s_enabled && s_asleep;
+}
+
+void LibEpdPowerGetStats(lib_epd_power_stats_t * stats)
+{
+    *stats = s_stats;
+    if (s_enabled && s_asleep)
+    {
+        stats->stop_us += LibClockNowUs() - s_stop_us;
+    }
+}
+
+/* Print the time saved in stop mode against the wake latency paid for it */
+void LibEpdPowerReport(FILE * out)
+{
+    lib_epd_power_stats_t st;
+
+    LibEpdPowerGetStats(&st);
+    fprintf(out, "stop mode %lu times, %.1f s\n", st.stops, st.stop_us / 1e6);
+    fprintf(out, "wakes %lu ahead of a refresh, %lu on demand, latency %.1f ms\n", st.prewakes,
+            st.demand_wakes, st.wake_us / 1e3);
+    fprintf(out, "latency exposed %.1f ms, awake early %.1f ms\n", st.exposed_us / 1e3,
+            st.early_us / 1e3);
+    if (st.wake_failures > 0)
+    {
+        fprintf(out, "wakes failed %lu, frames dropped %lu\n", st.wake_failures, st.dropped);
+    }
+}
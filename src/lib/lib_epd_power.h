@@ -0,0 +1,51 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_power.h
+ * @brief   API of the power manager of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_POWER_H
+#define LIB_EPD_POWER_H
+
+/* Wake latency assumed before the first one is measured */
+#define    EPD_POWER_WAKE_US                  50000
+
+/* Time added to the expected wake latency when waking ahead of a refresh */
+#define    EPD_POWER_LEAD_US                  20000
+
+/* Handshake reply of a wake up waited for this many wake latencies plus EPD_POWER_LEAD_US */
+#define    EPD_POWER_WAKE_TIMEOUTS            4
+
+/* Wait after a failed wake up before the next one, doubled on each failure up to the max */
+#define    EPD_POWER_RETRY_MS                 1000
+#define    EPD_POWER_RETRY_MAX_MS             60000
+
+/* Power counters */
+typedef struct
+{
+    unsigned long stops;        /* Stop mode entered */
+    unsigned long prewakes;     /* Wakes ahead of a scheduled refresh */
+    unsigned long demand_wakes; /* Wakes forced by a frame sent in stop mode */
+    unsigned long wake_failures; /* Wakes with no handshake reply */
+    unsigned long dropped;      /* Frames dropped while the e-paper stayed asleep */
+    long long stop_us;          /* Time spent in stop mode */
+    long long exposed_us;       /* Wake latency that held back a frame */
+    long long early_us;         /* Time awake between a pre-wake and the frames it was for */
+    long wake_us;               /* Smoothed wake latency, pulse to handshake reply */
+} lib_epd_power_stats_t;
+
+int LibEpdPowerInit(int idle_ms);
+void LibEpdPowerClose(void);
+
+void LibEpdPowerPoll(void);
+int LibEpdPowerTouch(void);
+int LibEpdPowerAsleep(void);
+
+void LibEpdPowerGetStats(lib_epd_power_stats_t * stats);
+void LibEpdPowerReport(FILE * out);
+
+#endif
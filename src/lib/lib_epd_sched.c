@@ -0,0 +1,198 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_sched.c
+ * @brief   Update scheduler of the e-paper screen.
+ *
+ *          A physical refresh takes seconds, so independent callers must not each trigger one.
+ *          Callers record their scene between LibEpdSchedBegin() and LibEpdSchedRequest()
+ *          instead of calling LibEpdUpdate(). The scheduler keeps only the latest scene and
+ *          refreshes once the requests have been quiet for the coalescing window (but no later
+ *          than max_wait after the first one), and never sooner than min_interval after the
+ *          previous refresh.
+ *
+ *          LibEpdSchedPoll() has to be called from the main loop, outside of Begin/Request.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_sched.h"
+
+static int s_window_ms = 0;         /* Quiet time before a refresh */
+static int s_max_wait_ms = 0;       /* Longest delay of the first request */
+static int s_min_interval_ms = 0;   /* Shortest time between two refreshes */
+
+static lib_epd_scene_t s_build;     /* Scene being recorded */
+static lib_epd_scene_t s_pending;   /* Latest requested scene */
+static int s_building = FALSE;
+static int s_has_scene = FALSE;     /* s_pending holds a scene */
+static int s_has_request = FALSE;   /* A refresh is pending */
+
+static long s_first_ms = 0;         /* First request since the last refresh */
+static long s_last_ms = 0;          /* Latest request */
+static long s_refresh_ms = -1;      /* Latest refresh, -1 if none yet */
+
+static lib_epd_sched_stats_t s_stats;
+
+/* Time when the pending refresh is due */
+static long _DueMs(void)
+{
+    long due;
+
+    due = s_last_ms + s_window_ms;
+    if (due > s_first_ms + s_max_wait_ms)
+    {
+        due = s_first_ms + s_max_wait_ms;
+    }
+    if ((s_refresh_ms >= 0) && (due < s_refresh_ms + s_min_interval_ms))
+    {
+        due = s_refresh_ms + s_min_interval_ms;
+    }
+    return due;
+}
+
+/* Send the pending scene and refresh the screen */
+static void _Refresh(void)
+{
+    if (s_has_scene)
+    {
+        LibEpdSceneSend(&s_pending);
+        LibEpdSceneReset(&s_pending);
+        s_has_scene = FALSE;
+    }
+    LibEpdUpdate();
+
+    s_refresh_ms = LibClockNowMs();
+    s_has_request = FALSE;
+    s_stats.refreshes++;
+}
+
+/* window_ms:       coalescing window, restarted by every request
+ * max_wait_ms:     upper bound of the delay caused by the window
+ * min_interval_ms: minimum time between two physical refreshes */
+void LibEpdSchedInit(int window_ms, int max_wait_ms, int min_interval_ms)
+{
+    s_window_ms = window_ms;
+    s_max_wait_ms = (max_wait_ms > window_ms) ? max_wait_ms : window_ms;
+    s_min_interval_ms = min_interval_ms;
+
+    LibEpdSceneInit(&s_build);
+    LibEpdSceneInit(&s_pending);
+    s_building = FALSE;
+    s_has_scene = FALSE;
+    s_has_request = FALSE;
+    s_refresh_ms = -1;
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+/* Drop anything pending and release the scene buffers */
+void LibEpdSchedClose(void)
+{
+    if (s_building)
+    {
+        LibEpdSceneEnd();
+        s_building = FALSE;
+    }
+    LibEpdSceneFree(&s_build);
+    LibEpdSceneFree(&s_pending);
+    s_has_scene = FALSE;
+    s_has_request = FALSE;
+}
+
+/* Start recording a scene, normally beginning with LibEpdClear() */
+void LibEpdSchedBegin(void)
+{
+    LibEpdSceneReset(&s_build);
+    LibEpdSceneBegin(&s_build);
+    s_building = TRUE;
+}
+
+/* Request a refresh. A scene recorded since LibEpdSchedBegin() replaces the pending one.
+ * Without LibEpdSchedBegin() only a refresh of what was already sent is requested. */
+void LibEpdSchedRequest(void)
+{
+    lib_epd_scene_t tmp;
+    long now = LibClockNowMs();
+
+    if (s_building)
+    {
+        LibEpdSceneEnd();
+        s_building = FALSE;
+
+        if (s_has_scene)
+        {
+            s_stats.collapsed++;
+        }
+        /* Swap so that both buffers are kept for reuse */
+        tmp = s_pending;
+        s_pending = s_build;
+        s_build = tmp;
+        LibEpdSceneReset(&s_build);
+        s_has_scene = TRUE;
+    }
+
+    if (!s_has_request)
+    {
+        s_first_ms = now;
+        s_has_request = TRUE;
+    }
+    s_last_ms = now;
+    s_stats.requests++;
+}
+
+/* Refresh if due. Returns TRUE if a refresh was issued */
+int LibEpdSchedPoll(void)
+{
+    if (!s_has_request || s_building)
+    {
+        return FALSE;
+    }
+    if (LibClockNowMs() < _DueMs())
+    {
+        return FALSE;
+    }
+    _Refresh();
+    return TRUE;
+}
+
+/* Milliseconds until the pending refresh is due, -1 if nothing is pending */
+int LibEpdSchedNextDue(void)
+{
+    long left;
+
+    if (!s_has_request)
+    {
+        return -1;
+    }
+    left = _DueMs() - LibClockNowMs();
+    return (left > 0) ? (int) left : 0;
+}
+
+/* Refresh now, without waiting for the window. The minimum interval is still kept. */
+void LibEpdSchedFlush(void)
+{
+    long left;
+
+    if (!s_has_request || s_building)
+    {
+        return;
+    }
+    if (s_refresh_ms >= 0)
+    {
+        left = s_refresh_ms + s_min_interval_ms - LibClockNowMs();
+        if (left > 0)
+        {
+            LibClockSleepUs(left * 1000LL);
+        }
+    }
+    _Refresh();
+}
+
+void LibEpdSchedGetStats(lib_epd_sched_stats_t * stats)
+{
+    *stats = s_stats;
+}
@@ -0,0 +1,36 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_sched.h
+ * @brief   API of the update scheduler of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_SCHED_H
+#define LIB_EPD_SCHED_H
+
+#include "lib_epd.h"
+
+/* Scheduler counters */
+typedef struct
+{
+    unsigned long requests;     /* LibEpdSchedRequest() calls */
+    unsigned long refreshes;    /* Physical refreshes issued */
+    unsigned long collapsed;    /* Scenes replaced by a newer one before being sent */
+} lib_epd_sched_stats_t;
+
+void LibEpdSchedInit(int window_ms, int max_wait_ms, int min_interval_ms);
+void LibEpdSchedClose(void);
+
+void LibEpdSchedBegin(void);
+void LibEpdSchedRequest(void);
+
+int LibEpdSchedPoll(void);
+int LibEpdSchedNextDue(void);
+void LibEpdSchedFlush(void);
+
+void LibEpdSchedGetStats(lib_epd_sched_stats_t * stats);
+
+#endif
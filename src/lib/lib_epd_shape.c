@@ -0,0 +1,614 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_shape.c
+ * @brief   Shapes built from the native primitives of the e-paper screen.
+ *
+ *          Each shape is cut into the fewest device commands that cover it:
+ *          - a filled rounded rectangle is three rectangles and four filled circles,
+ *          - a filled pie is a fan of filled triangles, a full one a single filled circle,
+ *          - a thick line is two filled triangles, a single rectangle when it is axis aligned,
+ *          - a filled polygon is ear clipped into n - 2 filled triangles,
+ *          - outlines are chains of lines, arcs split so no chord strays half a pixel from the
+ *            circle.
+ *
+ *          Angles are in degrees, 0 pointing right and growing clockwise on the screen.
+ *          Each drawing fills in the frames it would have cost sent pixel by pixel or line by
+ *          line, the way a generic raster library would send it.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_shape.h"
+
+/* Points of a rounded rectangle outline: four arcs of at most 91 points, one per degree.
+ * A pie needs fewer, the centre and at most 361 */
+#define SHAPE_POINTS_MAX    (4 * 91)
+
+/* Sine of 0 to 90 degrees, 1.0 being 16384 */
+static const short c_shape_sin[91] =
+{
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static int s_xy[SHAPE_POINTS_MAX * 2];
+
+static int _Sin(int a)
+{
+    a %= 360;
+    a += (a < 0) ? 360 : 0;
+    if (a <= 90)
+    {
+        return c_shape_sin[a];
+    }
+    if (a <= 180)
+    {
+        return c_shape_sin[180 - a];
+    }
+    if (a <= 270)
+    {
+        return -c_shape_sin[a - 180];
+    }
+    return -c_shape_sin[360 - a];
+}
+
+/* num / den rounded to the nearest */
+static int _Div(long num, long den)
+{
+    if (den < 0)
+    {
+        num = -num;
+        den = -den;
+    }
+    return (int) ((num >= 0) ? (num + den / 2) / den : -((-num + den / 2) / den));
+}
+
+static int _Sqrt(unsigned long v)
+{
+    unsigned long r = 0;
+    unsigned long b = 1UL << 30;
+
+    while (b > v)
+    {
+        b >>= 2;
+    }
+    while (b != 0)
+    {
+        if (v >= r + b)
+        {
+            v -= r + b;
+            r = (r >> 1) + b;
+        }
+        else
+        {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return (int) r;
+}
+
+/* Degrees between the points of an arc of radius r: a chord of d radians strays r * d^2 / 8
+ * from the circle, half a pixel for d = 2 / sqrt(r) */
+static int _Step(int r)
+{
+    int step = (r > 1) ? 115 / _Sqrt(r) : 45;
+
+    return (step < 1) ? 1 : ((step > 45) ? 45 : step);
+}
+
+/* Degrees swept from a0 to a1, 360 for a full turn */
+static int _Span(int a0, int a1)
+{
+    int span = a1 - a0;
+
+    if ((span >= 360) || (span <= -360))
+    {
+        return 360;
+    }
+    return (span % 360 + 360) % 360;
+}
+
+/* Points of the arc of radius r centred on (x0, y0), from a0 to a0 + span degrees.
+ * Returns the number of points */
+static int _ArcPoints(int x0, int y0, int r, int a0, int span, int * xy)
+{
+    int n = (span + _Step(r) - 1) / _Step(r);
+    int a;
+    int i;
+
+    for (i = 0; i <= n; i++)
+    {
+        a = a0 + span * i / n;
+        xy[2 * i] = x0 + _Div((long) r * _Sin(a + 90), 16384);
+        xy[2 * i + 1] = y0 + _Div((long) r * _Sin(a), 16384);
+    }
+    return n + 1;
+}
+
+/* Chain of lines through n points, back to the first one if closed, sent if send is set */
+static void _Polyline(const int * xy, int n, int closed, int send, lib_epd_shape_stats_t * st)
+{
+    const int * a;
+    const int * b;
+    int dx;
+    int dy;
+    int i;
+
+    for (i = 1; i < n + (closed ? 1 : 0); i++)
+    {
+        a = &xy[2 * (i - 1)];
+        b = &xy[2 * (i % n)];
+        if ((a[0] == b[0]) && (a[1] == b[1]))
+        {
+            continue;
+        }
+        dx = abs(b[0] - a[0]);
+        dy = abs(b[1] - a[1]);
+        /* A digital line has one straight run per step along its minor axis */
+        st->pixels += (dx > dy) ? dx : dy;
+        st->lines += ((dx < dy) ? dx : dy) + 1;
+        if (send)
+        {
+            LibEpdDrawLine(a[0], a[1], b[0], b[1]);
+            st->frames++;
+        }
+    }
+    st->pixels += closed ? 0 : 1;
+}
+
+/* Count the pixels and row spans of a polygon. Rows are sampled at their centres with the
+ * even-odd rule, the bottom row taken as a copy of the one above it */
+static void _Scan(const int * xy, int n, lib_epd_shape_stats_t * st)
+{
+    int cross[SHAPE_POINTS_MAX];
+    int ymin = xy[1];
+    int ymax = xy[1];
+    int pixels = 0;
+    int lines = 0;
+    int xmin = xy[0];
+    int xmax = xy[0];
+    int k;
+    int x;
+    int y;
+    int i;
+    int j;
+
+    for (i = 1; i < n; i++)
+    {
+        ymin = (xy[2 * i + 1] < ymin) ? xy[2 * i + 1] : ymin;
+        ymax = (xy[2 * i + 1] > ymax) ? xy[2 * i + 1] : ymax;
+        xmin = (xy[2 * i] < xmin) ? xy[2 * i] : xmin;
+        xmax = (xy[2 * i] > xmax) ? xy[2 * i] : xmax;
+    }
+    if (ymin == ymax)
+    {
+        st->pixels += xmax - xmin + 1;
+        st->lines++;
+        return;
+    }
+
+    for (y = ymin; y < ymax; y++)
+    {
+        k = 0;
+        for (i = 0; i < n; i++)
+        {
+            j = (i + 1) % n;
+            if ((2 * xy[2 * i + 1] < 2 * y + 1) == (2 * xy[2 * j + 1] < 2 * y + 1))
+            {
+                continue;
+            }
+            x = xy[2 * i] + _Div((long) (2 * y + 1 - 2 * xy[2 * i + 1]) * (xy[2 * j] - xy[2 * i]),
+                    2L * (xy[2 * j + 1] - xy[2 * i + 1]));
+            for (j = k; (j > 0) && (cross[j - 1] > x); j--)
+            {
+                cross[j] = cross[j - 1];
+            }
+            cross[j] = x;
+            k++;
+        }
+        pixels = 0;
+        lines = 0;
+        for (i = 0; i + 1 < k; i += 2)
+        {
+            pixels += cross[i + 1] - cross[i] + 1;
+            lines++;
+        }
+        st->pixels += pixels;
+        st->lines += lines;
+    }
+    st->pixels += pixels;
+    st->lines += lines;
+}
+
+/* Send a filled rectangle, corners in any order, as the smallest primitive covering it */
+static int _Rect(int x0, int y0, int x1, int y1)
+{
+    if ((x0 == x1) && (y0 == y1))
+    {
+        LibEpdDrawPixel(x0, y0);
+    }
+    else if ((x0 == x1) || (y0 == y1))
+    {
+        LibEpdDrawLine(x0, y0, x1, y1);
+    }
+    else
+    {
+        LibEpdFillRect((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+    }
+    return 1;
+}
+
+/* Order the corners and bound the radius by half the shorter side */
+static int _RoundBox(int * x0, int * y0, int * x1, int * y1, int r)
+{
+    int t;
+
+    if (*x0 > *x1)
+    {
+        t = *x0;
+        *x0 = *x1;
+        *x1 = t;
+    }
+    if (*y0 > *y1)
+    {
+        t = *y0;
+        *y0 = *y1;
+        *y1 = t;
+    }
+    t = (*x1 - *x0 < *y1 - *y0) ? *x1 - *x0 : *y1 - *y0;
+    r = (r > t / 2) ? t / 2 : r;
+    return (r < 0) ? 0 : r;
+}
+
+static void _Done(const lib_epd_shape_stats_t * st, lib_epd_shape_stats_t * stats)
+{
+    if (stats != NULL)
+    {
+        *stats = *st;
+    }
+}
+
+/* Outline of a rectangle with corners rounded to radius r.
+ * Returns the number of frames sent */
+int LibEpdDrawRoundRect(int x0, int y0, int x1, int y1, int r, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int n = 0;
+
+    memset(&st, 0, sizeof(st));
+    r = _RoundBox(&x0, &y0, &x1, &y1, r);
+    if ((x0 == x1) || (y0 == y1))
+    {
+        s_xy[0] = x0;
+        s_xy[1] = y0;
+        s_xy[2] = x1;
+        s_xy[3] = y1;
+        _Polyline(s_xy, 2, FALSE, TRUE, &st);
+        _Done(&st, stats);
+        return st.frames;
+    }
+
+    /* Clockwise from the top right corner, the sides join the ends of the arcs */
+    n += _ArcPoints(x1 - r, y0 + r, r, 270, 90, s_xy + 2 * n);
+    n += _ArcPoints(x1 - r, y1 - r, r, 0, 90, s_xy + 2 * n);
+    n += _ArcPoints(x0 + r, y1 - r, r, 90, 90, s_xy + 2 * n);
+    n += _ArcPoints(x0 + r, y0 + r, r, 180, 90, s_xy + 2 * n);
+    _Polyline(s_xy, n, TRUE, TRUE, &st);
+    _Done(&st, stats);
+    return st.frames;
+}
+
+/* Rectangle with corners rounded to radius r, filled with the current color: the middle band
+ * and the straight parts of the top and bottom as rectangles, the corners as filled circles.
+ * Returns the number of frames sent */
+int LibEpdFillRoundRect(int x0, int y0, int x1, int y1, int r, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int dy;
+    int y;
+
+    memset(&st, 0, sizeof(st));
+    r = _RoundBox(&x0, &y0, &x1, &y1, r);
+    for (y = y0; y <= y1; y++)
+    {
+        dy = (y < y0 + r) ? y0 + r - y : ((y > y1 - r) ? y - (y1 - r) : 0);
+        st.pixels += x1 - x0 + 1 - 2 * (r - _Sqrt(r * r - dy * dy));
+        st.lines++;
+    }
+
+    if (r == 0)
+    {
+        st.frames += _Rect(x0, y0, x1, y1);
+        _Done(&st, stats);
+        return st.frames;
+    }
+
+    st.frames += _Rect(x0, y0 + r, x1, y1 - r);
+    /* A side no longer than the diameter is covered by the circles alone */
+    if (x0 + r < x1 - r)
+    {
+        st.frames += _Rect(x0 + r, y0, x1 - r, y0 + r - 1);
+        st.frames += _Rect(x0 + r, y1 - r + 1, x1 - r, y1);
+    }
+    LibEpdFillCircle(x0 + r, y0 + r, r);
+    st.frames++;
+    if (x0 + r < x1 - r)
+    {
+        LibEpdFillCircle(x1 - r, y0 + r, r);
+        st.frames++;
+    }
+    if (y0 + r < y1 - r)
+    {
+        LibEpdFillCircle(x0 + r, y1 - r, r);
+        st.frames++;
+        if (x0 + r < x1 - r)
+        {
+            LibEpdFillCircle(x1 - r, y1 - r, r);
+            st.frames++;
+        }
+    }
+    _Done(&st, stats);
+    return st.frames;
+}
+
+/* Arc of the circle of radius r centred on (x0, y0), clockwise from a0 to a1 degrees.
+ * Returns the number of frames sent */
+int LibEpdDrawArc(int x0, int y0, int r, int a0, int a1, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int span = _Span(a0, a1);
+    int n;
+
+    memset(&st, 0, sizeof(st));
+    if ((span == 0) || (r <= 0))
+    {
+        _Done(&st, stats);
+        return 0;
+    }
+
+    n = _ArcPoints(x0, y0, r, a0, span, s_xy);
+    if (span == 360)
+    {
+        _Polyline(s_xy, n - 1, TRUE, FALSE, &st);
+        LibEpdDrawCircle(x0, y0, r);
+        st.frames = 1;
+    }
+    else
+    {
+        _Polyline(s_xy, n, FALSE, TRUE, &st);
+    }
+    _Done(&st, stats);
+    return st.frames;
+}
+
+/* Pie segment of radius r centred on (x0, y0), clockwise from a0 to a1 degrees, filled with
+ * the current color. Returns the number of frames sent */
+int LibEpdFillPie(int x0, int y0, int r, int a0, int a1, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int span = _Span(a0, a1);
+    int * p;
+    int n;
+    int i;
+
+    memset(&st, 0, sizeof(st));
+    if ((span == 0) || (r <= 0))
+    {
+        _Done(&st, stats);
+        return 0;
+    }
+
+    s_xy[0] = x0;
+    s_xy[1] = y0;
+    n = 1 + _ArcPoints(x0, y0, r, a0, span, s_xy + 2);
+    if (span == 360)
+    {
+        _Scan(s_xy + 2, n - 2, &st);
+        LibEpdFillCircle(x0, y0, r);
+        st.frames = 1;
+        _Done(&st, stats);
+        return st.frames;
+    }
+
+    _Scan(s_xy, n, &st);
+    for (i = 1; i + 1 < n; i++)
+    {
+        p = &s_xy[2 * i];
+        if ((p[0] != p[2]) || (p[1] != p[3]))
+        {
+            LibEpdFillTriangle(x0, y0, p[0], p[1], p[2], p[3]);
+            st.frames++;
+        }
+    }
+    _Done(&st, stats);
+    return st.frames;
+}
+
+/* Line width pixels wide with square ends, filled with the current color.
+ * Returns the number of frames sent */
+int LibEpdDrawThickLine(int x0, int y0, int x1, int y1, int width, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int len = _Sqrt((unsigned long) (dx * dx + dy * dy));
+    int a = (width - 1) / 2;
+    int b = width - 1 - a;
+
+    memset(&st, 0, sizeof(st));
+    if (width <= 1)
+    {
+        s_xy[0] = x0;
+        s_xy[1] = y0;
+        s_xy[2] = x1;
+        s_xy[3] = y1;
+        _Polyline(s_xy, 2, FALSE, TRUE, &st);
+        _Done(&st, stats);
+        return st.frames;
+    }
+
+    if ((dx == 0) || (dy == 0))
+    {
+        /* The pen is square: an axis aligned line is a rectangle, a point a square */
+        s_xy[0] = (dy == 0) ? x0 : x0 - a;
+        s_xy[1] = (dy == 0) ? y0 - a : y0;
+        s_xy[2] = (dy == 0) ? x1 : x1 + b;
+        s_xy[3] = (dy == 0) ? y1 + b : y1;
+        if (len == 0)
+        {
+            s_xy[0] = x0 - a;
+            s_xy[2] = x0 + b;
+            s_xy[3] = y0 + b;
+        }
+    }
+    else
+    {
+        /* Offsets along the normal, a pixels on one side and b on the other */
+        s_xy[0] = _Div((long) -dy * a, len);
+        s_xy[1] = _Div((long) dx * a, len);
+        s_xy[2] = _Div((long) dy * b, len);
+        s_xy[3] = _Div((long) -dx * b, len);
+    }
+
+    if ((dx == 0) || (dy == 0))
+    {
+        st.pixels = (abs(s_xy[2] - s_xy[0]) + 1) * (abs(s_xy[3] - s_xy[1]) + 1);
+        st.lines = abs(s_xy[3] - s_xy[1]) + 1;
+        st.frames = _Rect(s_xy[0], s_xy[1], s_xy[2], s_xy[3]);
+        _Done(&st, stats);
+        return st.frames;
+    }
+
+    s_xy[8] = x0 + s_xy[0];
+    s_xy[9] = y0 + s_xy[1];
+    s_xy[10] = x1 + s_xy[0];
+    s_xy[11] = y1 + s_xy[1];
+    s_xy[12] = x1 + s_xy[2];
+    s_xy[13] = y1 + s_xy[3];
+    s_xy[14] = x0 + s_xy[2];
+    s_xy[15] = y0 + s_xy[3];
+    _Scan(s_xy + 8, 4, &st);
+    LibEpdFillTriangle(s_xy[8], s_xy[9], s_xy[10], s_xy[11], s_xy[12], s_xy[13]);
+    LibEpdFillTriangle(s_xy[8], s_xy[9], s_xy[12], s_xy[13], s_xy[14], s_xy[15]);
+    st.frames = 2;
+    _Done(&st, stats);
+    return st.frames;
+}
+
+/* Twice the signed area of the triangle of points a, b, c of xy */
+static long _Cross(const int * xy, int a, int b, int c)
+{
+    return (long) (xy[2 * b] - xy[2 * a]) * (xy[2 * c + 1] - xy[2 * b + 1])
+            - (long) (xy[2 * b + 1] - xy[2 * a + 1]) * (xy[2 * c] - xy[2 * b]);
+}
+
+/* Whether a vertex left in idx, other than a, b and c, lies in the triangle they make */
+static int _Blocked(const int * xy, const int * idx, int m, int a, int b, int c, long sign)
+{
+    int p;
+    int k;
+
+    for (k = 0; k < m; k++)
+    {
+        p = idx[k];
+        if ((p == a) || (p == b) || (p == c)
+                || ((xy[2 * p] == xy[2 * a]) && (xy[2 * p + 1] == xy[2 * a + 1]))
+                || ((xy[2 * p] == xy[2 * c]) && (xy[2 * p + 1] == xy[2 * c + 1])))
+        {
+            continue;
+        }
+        if ((_Cross(xy, a, b, p) * sign >= 0) && (_Cross(xy, b, c, p) * sign >= 0)
+                && (_Cross(xy, c, a, p) * sign >= 0))
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void _Triangle(const int * xy, int a, int b, int c)
+{
+    LibEpdFillTriangle(xy[2 * a], xy[2 * a + 1], xy[2 * b], xy[2 * b + 1], xy[2 * c], xy[2 * c + 1]);
+}
+
+/* Polygon of n vertices, xy holding x0, y0, x1, y1 and so on, filled with the current color.
+ * A simple polygon, convex or not, is cut into at most n - 2 triangles by ear clipping.
+ * Returns the number of frames sent, -1 if n is out of range */
+int LibEpdFillPolygon(const int * xy, int n, lib_epd_shape_stats_t * stats)
+{
+    lib_epd_shape_stats_t st;
+    int idx[EPD_POLYGON_MAX];
+    long area = 0;
+    long cross;
+    int miss = 0;
+    int m = n;
+    int i;
+
+    if ((n < 3) || (n > EPD_POLYGON_MAX))
+    {
+        return -1;
+    }
+
+    memset(&st, 0, sizeof(st));
+    _Scan(xy, n, &st);
+    for (i = 0; i < n; i++)
+    {
+        idx[i] = i;
+        area += (long) xy[2 * i] * xy[2 * ((i + 1) % n) + 1] - (long) xy[2 * ((i + 1) % n)] * xy[2 * i + 1];
+    }
+    area = (area >= 0) ? 1 : -1;
+
+    i = 0;
+    while (m > 3)
+    {
+        cross = _Cross(xy, idx[(i + m - 1) % m], idx[i], idx[(i + 1) % m]);
+        if ((cross == 0)
+                || ((cross * area > 0)
+                        && !_Blocked(xy, idx, m, idx[(i + m - 1) % m], idx[i], idx[(i + 1) % m], area)))
+        {
+            /* A collinear vertex goes without a triangle */
+            if (cross != 0)
+            {
+                _Triangle(xy, idx[(i + m - 1) % m], idx[i], idx[(i + 1) % m]);
+                st.frames++;
+            }
+            memmove(&idx[i], &idx[i + 1], (m - i - 1) * sizeof(int));
+            m--;
+            i = (i >= m) ? 0 : i;
+            miss = 0;
+        }
+        else if (++miss > m)
+        {
+            break;
+        }
+        else
+        {
+            i = (i + 1) % m;
+        }
+    }
+
+    /* No ear is left only if the polygon crosses itself, fan out what remains */
+    for (i = 1; i + 1 < m; i++)
+    {
+        if (_Cross(xy, idx[0], idx[i], idx[i + 1]) != 0)
+        {
+            _Triangle(xy, idx[0], idx[i], idx[i + 1]);
+            st.frames++;
+        }
+    }
+    _Done(&st, stats);
+    return st.frames;
+}
@@ -0,0 +1,32 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_shape.h
+ * @brief   API of the shapes built from the native primitives of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_SHAPE_H
+#define LIB_EPD_SHAPE_H
+
+/* Most vertices taken by LibEpdFillPolygon() */
+#define    EPD_POLYGON_MAX                    64
+
+/* Frame counts of the last drawing */
+typedef struct
+{
+    int pixels;         /* Pixels of the shape, frames needed with one pixel per frame */
+    int lines;          /* Straight runs of pixels, frames needed with one line per run */
+    int frames;         /* Frames actually sent */
+} lib_epd_shape_stats_t;
+
+int LibEpdDrawRoundRect(int x0, int y0, int x1, int y1, int r, lib_epd_shape_stats_t * stats);
+int LibEpdFillRoundRect(int x0, int y0, int x1, int y1, int r, lib_epd_shape_stats_t * stats);
+int LibEpdDrawArc(int x0, int y0, int r, int a0, int a1, lib_epd_shape_stats_t * stats);
+int LibEpdFillPie(int x0, int y0, int r, int a0, int a1, lib_epd_shape_stats_t * stats);
+int LibEpdDrawThickLine(int x0, int y0, int x1, int y1, int width, lib_epd_shape_stats_t * stats);
+int LibEpdFillPolygon(const int * xy, int n, lib_epd_shape_stats_t * stats);
+
+#endif
@@ -0,0 +1,263 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_skip.c
+ * @brief   Skipping of updates that would not change the screen.
+ *
+ *          Once enabled, every frame from a CMD_CLEAR up to the next CMD_UPDATE is held back
+ *          and hashed (FNV-1a, 64 bits) together with the settings in effect at the clear.
+ *          If the hash is the one of the screen shown, nothing is sent but the setting frames
+ *          held, which keeps the e-paper in step with the library; otherwise the frames are
+ *          sent and the hash saved to a file, so it still holds after a restart. Drawing or
+ *          updating outside such a sequence makes the screen shown unknown.
+ *
+ *          Skipping is the EPD_LAYER_SKIP layer of lib_epd.c while enabled, so it sees every
+ *          frame written through lib_epd: frames drawn directly, scenes sent, the lanes of
+ *          lib_epd_lane.c and the frames forwarded by the daemon alike.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_skip.h"
+
+#define SKIP_FNV_OFFSET     0xCBF29CE484222325ULL
+#define SKIP_FNV_PRIME      0x100000001B3ULL
+
+static int s_enabled = FALSE;
+static char s_path[256];
+static unsigned long long s_shown = 0;      /* 0 when unknown */
+static int s_holding = FALSE;
+static lib_epd_scene_t s_hold;
+static unsigned long long s_hash;
+static lib_epd_skip_stats_t s_stats;
+
+static unsigned long long _Fnv(unsigned long long h, const unsigned char * p, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        h = (h ^ p[i]) * SKIP_FNV_PRIME;
+    }
+    return h;
+}
+
+static int _Layer(const unsigned char * ptr, int n);
+
+static const lib_epd_layer_t s_layer = { _Layer, NULL };
+
+/* Pass frames on to the layers below. Returns TRUE on success */
+static int _Write(const unsigned char * p, int n)
+{
+    return LibEpdWriteAfter(EPD_LAYER_SKIP, p, n) >= 0;
+}
+
+static void _Save(void)
+{
+    char tmp[sizeof(s_path) + 4];
+    FILE * fd;
+    int n;
+
+    /* Write aside and rename, so a crash never leaves half a file */
+    snprintf(tmp, sizeof(tmp), "%s.tmp", s_path);
+    fd = fopen(tmp, "w");
+    if (fd == NULL)
+    {
+        perror("LibEpdSkip");
+        return;
+    }
+    n = fprintf(fd, "%016llx\n", s_shown);
+    if ((fclose(fd) != 0) || (n <= 0) || (rename(tmp, s_path) != 0))
+    {
+        perror("LibEpdSkip");
+        unlink(tmp);
+    }
+}
+
+/* Whether a frame may change what the screen shows, settings and queries do not */
+static int _Draws(unsigned char cmd)
+{
+    switch (cmd)
+    {
+    case CMD_HANDSHAKE:
+    case CMD_SET_BAUD:
+    case CMD_READ_BAUD:
+    case CMD_SET_MEM_MODE:
+    case CMD_STOP_MODE:
+    case CMD_SET_SCR_ROTATION:
+    case CMD_LOAD_FONT:
+    case CMD_LOAD_PIC:
+    case CMD_SET_COLOR:
+    case CMD_SET_EN_FONT:
+    case CMD_SET_CH_FONT:
+        return FALSE;
+    default:
+        return TRUE;
+    }
+}
+
+/* Send the setting frames of the held sequence only */
+static int _SendSettings(void)
+{
+    const unsigned char * p;
+    int off;
+    int n;
+
+    for (off = 0; off < s_hold.len; off += n)
+    {
+        p = s_hold.data + off;
+        n = LibEpdFrameLen(p);
+        if (((p[3] == CMD_SET_COLOR) || (p[3] == CMD_SET_EN_FONT) || (p[3] == CMD_SET_CH_FONT)
+                || (p[3] == CMD_SET_SCR_ROTATION)) && !_Write(p, n))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Enable skipping, the hash of the screen shown read from path (EPD_SHOWN_FILE).
+ * Returns TRUE if the hash was found */
+int LibEpdSkipInit(const char * path)
+{
+    FILE * fd;
+
+    snprintf(s_path, sizeof(s_path), "%s", path);
+    LibEpdSceneInit(&s_hold);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_holding = FALSE;
+    s_shown = 0;
+    s_enabled = TRUE;
+    LibEpdSetLayer(EPD_LAYER_SKIP, &s_layer);
+
+    fd = fopen(path, "r");
+    if (fd == NULL)
+    {
+        return FALSE;
+    }
+    if (fscanf(fd, "%llx", &s_shown) != 1)
+    {
+        s_shown = 0;
+    }
+    fclose(fd);
+    return s_shown != 0;
+}
+
+/* Disable skipping, sending whatever is held */
+void LibEpdSkipClose(void)
+{
+    if (s_holding)
+    {
+        _Write(s_hold.data, s_hold.len);
+    }
+    s_holding = FALSE;
+    s_enabled = FALSE;
+    LibEpdSetLayer(EPD_LAYER_SKIP, NULL);
+    LibEpdSceneFree(&s_hold);
+}
+
+/* Forget the screen shown, e.g. when something else drew on it: the next update is sent */
+void LibEpdSkipForget(void)
+{
+    s_shown = 0;
+    if (s_enabled)
+    {
+        unlink(s_path);
+    }
+}
+
+void LibEpdSkipGetStats(lib_epd_skip_stats_t * stats)
+{
+    *stats = s_stats;
+}
+
+int LibEpdSkipEnabled(void)
+{
+    return s_enabled;
+}
+
+/* Send a frame, or hold it while a clear to update sequence is going on.
+ * Returns n, or -1 on a write error */
+static int _Frame(const unsigned char * frame, int n)
+{
+    lib_epd_state_t state;
+    unsigned char seed[6];
+    int ok;
+
+    if (!s_holding && (frame[3] != CMD_CLEAR))
+    {
+        /* Drawn over the screen shown, or updated without a clear: no longer known */
+        if (_Draws(frame[3]) && (s_shown != 0))
+        {
+            s_shown = 0;
+            _Save();
+        }
+        return _Write(frame, n) ? n : -1;
+    }
+
+    if (!s_holding)
+    {
+        /* What a clear leaves depends on the settings in effect */
+        LibEpdGetState(&state);
+        seed[0] = state.mem_mode;
+        seed[1] = state.rotation;
+        seed[2] = state.en_font;
+        seed[3] = state.ch_font;
+        seed[4] = state.color;
+        seed[5] = state.bkcolor;
+        s_hash = _Fnv(SKIP_FNV_OFFSET, seed, sizeof(seed));
+        LibEpdSceneReset(&s_hold);
+        s_holding = TRUE;
+    }
+    if (LibEpdSceneAppend(&s_hold, frame, n) < 0)
+    {
+        /* Too long to hold: let it through, what the screen shows is no longer known */
+        s_holding = FALSE;
+        s_shown = 0;
+        _Save();
+        ok = _Write(s_hold.data, s_hold.len) && _Write(frame, n);
+        return ok ? n : -1;
+    }
+    s_hash = _Fnv(s_hash, frame, n);
+    if (frame[3] != CMD_UPDATE)
+    {
+        return n;
+    }
+
+    s_holding = FALSE;
+    s_hash += (s_hash == 0);
+    if (s_hash == s_shown)
+    {
+        s_stats.skipped++;
+        s_stats.bytes_saved += s_hold.len;
+        ok = _SendSettings();
+    }
+    else
+    {
+        s_stats.commits++;
+        ok = _Write(s_hold.data, s_hold.len);
+        s_shown = ok ? s_hash : 0;
+        _Save();
+    }
+    return ok ? n : -1;
+}
+
+/* Write of the layer: whole frames, taken one by one. Returns n, or -1 on a write error */
+static int _Layer(const unsigned char * ptr, int n)
+{
+    int off;
+    int len;
+
+    for (off = 0; off < n; off += len)
+    {
+        len = LibEpdFrameLen(ptr + off);
+        if ((len <= 3) || (off + len > n) || (_Frame(ptr + off, len) < 0))
+        {
+            return -1;
+        }
+    }
+    return n;
+}
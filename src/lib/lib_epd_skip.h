@@ -0,0 +1,32 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_skip.h
+ * @brief   API of the skipping of updates that would not change the screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_SKIP_H
+#define LIB_EPD_SKIP_H
+
+/* Where the hash of the screen shown survives a restart of the process */
+#define    EPD_SHOWN_FILE                     "/var/tmp/epd_shown"
+
+/* Skip counters */
+typedef struct
+{
+    unsigned long commits;      /* Clear to update sequences sent */
+    unsigned long skipped;      /* Sequences dropped, the screen already showing them */
+    unsigned long bytes_saved;  /* Bytes not sent */
+} lib_epd_skip_stats_t;
+
+int LibEpdSkipInit(const char * path);
+void LibEpdSkipClose(void);
+void LibEpdSkipForget(void);
+void LibEpdSkipGetStats(lib_epd_skip_stats_t * stats);
+
+int LibEpdSkipEnabled(void);
+
+#endif
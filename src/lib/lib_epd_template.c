@@ -0,0 +1,553 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_template.c
+ * @brief   Screen templates compiled to encoded frames.
+ *
+ *          A template is a text file, one drawing command per line:
+ *
+ *              # comment
+ *              color BLACK WHITE           color, background: BLACK DARK_GRAY GRAY WHITE
+ *              enfont 48                   chfont 48 as well, 32 48 or 64
+ *              clear
+ *              rect 0 0 799 59             filled; also pixel, line, circle, fillcircle,
+ *              triangle 0 0 9 0 0 9        filltriangle, with the arguments of lib_epd
+ *              text 20 12 "Living room"    fixed UTF-8 text
+ *              text 20 100 {temp}          placeholder, set with LibEpdTemplateSet()
+ *              bar 20 200 419 231 {level}  placeholder, filled to level percent
+ *              bitmap 600 100 "SUN.BMP"
+ *              update
+ *
+ *          Everything but the placeholders is encoded once. Drawing sends the encoded frames
+ *          with the placeholders encoded in between, so a refresh costs a copy and a few
+ *          small frames.
+ *
+ *          The compiled frames can be cached in a file, valid while the source has the same
+ *          size and FNV-1a hash and the screen the same orientation. The source is read and
+ *          hashed on every load: its modification time would miss an edit within the same
+ *          time stamp, or a file put back with its old time.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_template.h"
+#include "lib_epd_mem.h"
+
+#define TPL_MAGIC       0x45505443      /* "EPTC" */
+#define TPL_VERSION     2
+#define TPL_MAX_ARGS    8
+
+/* Header of a cache file, followed by the slots then the frames */
+typedef struct
+{
+    unsigned long magic;
+    int version;
+    long long size;
+    unsigned long long hash;
+    int orientation;
+    int num_slots;
+    int len;
+    int frames;
+    lib_epd_state_t state;
+} tpl_file_t;
+
+/* Parsed line */
+typedef struct
+{
+    char * word[TPL_MAX_ARGS + 1];
+    int num;
+    int quoted[TPL_MAX_ARGS + 1];
+} tpl_line_t;
+
+static unsigned long long _Fnv(const unsigned char * p, long n)
+{
+    unsigned long long h = 0xCBF29CE484222325ULL;
+    long i;
+
+    for (i = 0; i < n; i++)
+    {
+        h = (h ^ p[i]) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+/* Split a line into words, quoted strings kept whole. Returns FALSE on a missing quote */
+static int _Split(char * s, tpl_line_t * line)
+{
+    line->num = 0;
+    while (line->num <= TPL_MAX_ARGS)
+    {
+        while ((*s == ' ') || (*s == '\t') || (*s == '\r') || (*s == '\n'))
+        {
+            s++;
+        }
+        if ((*s == '\0') || (*s == '#'))
+        {
+            break;
+        }
+        line->quoted[line->num] = (*s == '"');
+        if (*s == '"')
+        {
+            line->word[line->num++] = ++s;
+            s = strchr(s, '"');
+            if (s == NULL)
+            {
+                return FALSE;
+            }
+        }
+        else
+        {
+            line->word[line->num++] = s;
+            while ((*s != '\0') && (*s != ' ') && (*s != '\t') && (*s != '\r') && (*s != '\n'))
+            {
+                s++;
+            }
+            if (*s == '\0')
+            {
+                break;
+            }
+        }
+        *s++ = '\0';
+    }
+    return TRUE;
+}
+
+static int _Color(const char * s, int * value)
+{
+    static const char * const c_names[4] = { "BLACK", "DARK_GRAY", "GRAY", "WHITE" };
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (strcmp(s, c_names[i]) == 0)
+        {
+            *value = i;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Arguments from word 1 on as integers */
+static int _Ints(const tpl_line_t * line, int * v, int n)
+{
+    char * end;
+    int i;
+
+    if (line->num != n + 1)
+    {
+        return FALSE;
+    }
+    for (i = 0; i < n; i++)
+    {
+        v[i] = strtol(line->word[i + 1], &end, 0);
+        if ((*end != '\0') && !_Color(line->word[i + 1], &v[i]))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Placeholder "{name}" as the last word, returns its slot or NULL */
+static lib_epd_slot_t * _Slot(lib_epd_template_t * tpl, const tpl_line_t * line, int kind)
+{
+    const char * w = line->word[line->num - 1];
+    int len = strlen(w);
+    lib_epd_slot_t * slot;
+
+    if (line->quoted[line->num - 1] || (len < 3) || (len - 2 >= EPD_SLOT_NAME) || (w[0] != '{')
+            || (w[len - 1] != '}') || (tpl->num_slots == EPD_TEMPLATE_SLOTS))
+    {
+        return NULL;
+    }
+    slot = &tpl->slots[tpl->num_slots++];
+    memset(slot, 0, sizeof(*slot));
+    memcpy(slot->name, w + 1, len - 2);
+    slot->kind = kind;
+    slot->offset = tpl->frames.len;
+    return slot;
+}
+
+static int _Font(int v)
+{
+    return (v == 64) ? 3 : (v == 48) ? 2 : (v == 32) ? 1 : v;
+}
+
+/* Encode one line. Returns FALSE if it is not understood */
+static int _Compile(lib_epd_template_t * tpl, tpl_line_t * line)
+{
+    lib_epd_slot_t * slot;
+    const char * cmd = line->word[0];
+    int v[6];
+
+    if (strcmp(cmd, "clear") == 0)
+    {
+        LibEpdClear();
+        return line->num == 1;
+    }
+    if (strcmp(cmd, "update") == 0)
+    {
+        LibEpdUpdate();
+        return line->num == 1;
+    }
+    if ((strcmp(cmd, "color") == 0) && _Ints(line, v, 2))
+    {
+        LibEpdSetColor(v[0], v[1]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "enfont") == 0) && _Ints(line, v, 1))
+    {
+        LibEpdSetEnFont(_Font(v[0]));
+        return TRUE;
+    }
+    if ((strcmp(cmd, "chfont") == 0) && _Ints(line, v, 1))
+    {
+        LibEpdSetChFont(_Font(v[0]));
+        return TRUE;
+    }
+    if ((strcmp(cmd, "pixel") == 0) && _Ints(line, v, 2))
+    {
+        LibEpdDrawPixel(v[0], v[1]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "line") == 0) && _Ints(line, v, 4))
+    {
+        LibEpdDrawLine(v[0], v[1], v[2], v[3]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "rect") == 0) && _Ints(line, v, 4))
+    {
+        LibEpdFillRect(v[0], v[1], v[2], v[3]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "circle") == 0) && _Ints(line, v, 3))
+    {
+        LibEpdDrawCircle(v[0], v[1], v[2]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "fillcircle") == 0) && _Ints(line, v, 3))
+    {
+        LibEpdFillCircle(v[0], v[1], v[2]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "triangle") == 0) && _Ints(line, v, 6))
+    {
+        LibEpdDrawTriangle(v[0], v[1], v[2], v[3], v[4], v[5]);
+        return TRUE;
+    }
+    if ((strcmp(cmd, "filltriangle") == 0) && _Ints(line, v, 6))
+    {
+        LibEpdFillTriangle(v[0], v[1], v[2], v[3], v[4], v[5]);
+        return TRUE;
+    }
+    if (line->num < 4)
+    {
+        return FALSE;
+    }
+
+    /* Commands ending with a string or a placeholder */
+    line->num--;
+    if ((strcmp(cmd, "text") == 0) && _Ints(line, v, 2))
+    {
+        line->num++;
+        if (line->quoted[3])
+        {
+            LibEpdDispStringUtf8(line->word[3], v[0], v[1]);
+            return TRUE;
+        }
+        slot = _Slot(tpl, line, EPD_SLOT_TEXT);
+    }
+    else if ((strcmp(cmd, "bitmap") == 0) && _Ints(line, v, 2))
+    {
+        line->num++;
+        LibEpdDispBitmap(line->word[3], v[0], v[1]);
+        return line->quoted[3];
+    }
+    else if ((strcmp(cmd, "bar") == 0) && _Ints(line, v, 4))
+    {
+        line->num++;
+        slot = _Slot(tpl, line, EPD_SLOT_BAR);
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    if (slot == NULL)
+    {
+        return FALSE;
+    }
+    slot->x0 = v[0];
+    slot->y0 = v[1];
+    slot->x1 = (slot->kind == EPD_SLOT_BAR) ? v[2] : v[0];
+    slot->y1 = (slot->kind == EPD_SLOT_BAR) ? v[3] : v[1];
+    return TRUE;
+}
+
+/* Compile the source text */
+static int _CompileText(lib_epd_template_t * tpl, const char * path, char * text)
+{
+    lib_epd_state_t saved;
+    lib_epd_state_t state;
+    tpl_line_t line;
+    char * next;
+    int number = 0;
+    int ok = TRUE;
+
+    /* Start from unknown settings, so the ones left are the template's own */
+    LibEpdGetState(&saved);
+    state = saved;
+    state.mem_mode = EPD_UNKNOWN;
+    state.rotation = EPD_UNKNOWN;
+    state.en_font = EPD_UNKNOWN;
+    state.ch_font = EPD_UNKNOWN;
+    state.color = EPD_UNKNOWN;
+    state.bkcolor = EPD_UNKNOWN;
+    LibEpdSetState(&state);
+
+    LibEpdSceneReset(&tpl->frames);
+    tpl->num_slots = 0;
+    LibEpdSceneBegin(&tpl->frames);
+    for (; ok && (text != NULL); text = next)
+    {
+        next = strchr(text, '\n');
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+        number++;
+        if (!_Split(text, &line))
+        {
+            fprintf(stderr, "%s:%d: missing quote\n", path, number);
+            ok = FALSE;
+        }
+        else if ((line.num > 0) && !_Compile(tpl, &line))
+        {
+            fprintf(stderr, "%s:%d: bad command\n", path, number);
+            ok = FALSE;
+        }
+    }
+    LibEpdSceneEnd();
+
+    LibEpdGetState(&tpl->state);
+    LibEpdSetState(&saved);
+    return ok;
+}
+
+/* Read the compiled template from the cache if it still matches the source: same size and
+ * same hash */
+static int _LoadCache(lib_epd_template_t * tpl, const char * cache_path, long long size,
+        unsigned long long hash)
+{
+    tpl_file_t head;
+    unsigned char * data = NULL;
+    FILE * fd;
+    int ok;
+
+    fd = fopen(cache_path, "rb");
+    if (fd == NULL)
+    {
+        return FALSE;
+    }
+    ok = (fread(&head, sizeof(head), 1, fd) == 1) && (head.magic == TPL_MAGIC)
+            && (head.version == TPL_VERSION) && (head.orientation == LibEpdGetOrientation())
+            && (head.num_slots >= 0) && (head.num_slots <= EPD_TEMPLATE_SLOTS) && (head.len >= 0);
+    ok = ok && (head.size == size) && (head.hash == hash);
+    ok = ok && (fread(tpl->slots, sizeof(lib_epd_slot_t), head.num_slots, fd)
+            == (size_t) head.num_slots);
+    if (ok)
+    {
+        data = LibEpdMemAlloc(EPD_MEM_SCRATCH, head.len + 1);
+        ok = (data != NULL) && (fread(data, 1, head.len, fd) == (size_t) head.len);
+    }
+    fclose(fd);
+
+    LibEpdSceneReset(&tpl->frames);
+    ok = ok && ((head.len == 0) || (LibEpdSceneAppend(&tpl->frames, data, head.len) >= 0));
+    LibEpdMemFree(EPD_MEM_SCRATCH, data);
+    if (!ok)
+    {
+        LibEpdSceneReset(&tpl->frames);
+        return FALSE;
+    }
+    tpl->frames.frames = head.frames;
+    tpl->num_slots = head.num_slots;
+    tpl->state = head.state;
+    return TRUE;
+}
+
+static void _SaveCache(const lib_epd_template_t * tpl, const char * cache_path, long long size,
+        unsigned long long hash)
+{
+    tpl_file_t head;
+    char tmp[256];
+    FILE * fd;
+    int ok;
+
+    memset(&head, 0, sizeof(head));
+    head.magic = TPL_MAGIC;
+    head.version = TPL_VERSION;
+    head.size = size;
+    head.hash = hash;
+    head.orientation = LibEpdGetOrientation();
+    head.num_slots = tpl->num_slots;
+    head.len = tpl->frames.len;
+    head.frames = tpl->frames.frames;
+    head.state = tpl->state;
+
+    /* Write aside and rename, so a crash never leaves half a file */
+    snprintf(tmp, sizeof(tmp), "%s.tmp", cache_path);
+    fd = fopen(tmp, "wb");
+    if (fd == NULL)
+    {
+        perror(tmp);
+        return;
+    }
+    ok = (fwrite(&head, sizeof(head), 1, fd) == 1)
+            && (fwrite(tpl->slots, sizeof(lib_epd_slot_t), tpl->num_slots, fd)
+                    == (size_t) tpl->num_slots)
+            && ((tpl->frames.len == 0) || (fwrite(tpl->frames.data, tpl->frames.len, 1, fd) == 1));
+    if ((fclose(fd) != 0) || !ok || (rename(tmp, cache_path) != 0))
+    {
+        perror(cache_path);
+        unlink(tmp);
+    }
+}
+
+/* Compile the template at path, or take it from cache_path (NULL for no cache).
+ * Not to be called while a scene is being recorded.
+ * Returns EPD_TEMPLATE_CACHED, EPD_TEMPLATE_COMPILED or EPD_TEMPLATE_FAILED */
+int LibEpdTemplateLoad(lib_epd_template_t * tpl, const char * path, const char * cache_path)
+{
+    struct stat st;
+    unsigned long long hash;
+    unsigned char * text;
+    FILE * fd;
+    long len;
+    int result = EPD_TEMPLATE_FAILED;
+
+    memset(tpl, 0, sizeof(*tpl));
+    LibEpdSceneInit(&tpl->frames);
+
+    if (stat(path, &st) != 0)
+    {
+        perror(path);
+        return EPD_TEMPLATE_FAILED;
+    }
+    len = st.st_size;
+    text = LibEpdMemAlloc(EPD_MEM_SCRATCH, len + 1);
+    if (text == NULL)
+    {
+        return EPD_TEMPLATE_FAILED;
+    }
+    fd = fopen(path, "rb");
+    if ((fd == NULL) || (fread(text, 1, len, fd) != (size_t) len))
+    {
+        perror(path);
+        if (fd != NULL)
+        {
+            fclose(fd);
+        }
+        LibEpdMemFree(EPD_MEM_SCRATCH, text);
+        return EPD_TEMPLATE_FAILED;
+    }
+    fclose(fd);
+    text[len] = '\0';
+
+    /* Compiling cuts the text into lines, so hash it first */
+    hash = _Fnv(text, len);
+    if ((cache_path != NULL) && _LoadCache(tpl, cache_path, len, hash))
+    {
+        result = EPD_TEMPLATE_CACHED;
+    }
+    else if (_CompileText(tpl, path, (char *) text))
+    {
+        result = EPD_TEMPLATE_COMPILED;
+        if (cache_path != NULL)
+        {
+            _SaveCache(tpl, cache_path, len, hash);
+        }
+    }
+    LibEpdMemFree(EPD_MEM_SCRATCH, text);
+    return result;
+}
+
+void LibEpdTemplateFree(lib_epd_template_t * tpl)
+{
+    LibEpdSceneFree(&tpl->frames);
+    tpl->num_slots = 0;
+}
+
+/* Set the value of every placeholder with this name. Returns FALSE if there is none */
+int LibEpdTemplateSet(lib_epd_template_t * tpl, const char * name, const char * value)
+{
+    int found = FALSE;
+    int i;
+
+    for (i = 0; i < tpl->num_slots; i++)
+    {
+        if (strcmp(tpl->slots[i].name, name) == 0)
+        {
+            snprintf(tpl->slots[i].value, sizeof(tpl->slots[i].value), "%s", value);
+            found = TRUE;
+        }
+    }
+    return found;
+}
+
+/* Send the template, placeholders encoded with their current values.
+ * Returns TRUE on success */
+int LibEpdTemplateDraw(const lib_epd_template_t * tpl)
+{
+    const lib_epd_slot_t * slot;
+    lib_epd_state_t state;
+    int pos = 0;
+    int level;
+    int i;
+
+    for (i = 0; i < tpl->num_slots; i++)
+    {
+        slot = &tpl->slots[i];
+        if (!LibEpdSendFrames(tpl->frames.data + pos, slot->offset - pos))
+        {
+            return FALSE;
+        }
+        pos = slot->offset;
+        if (slot->kind == EPD_SLOT_TEXT)
+        {
+            if (slot->value[0] != '\0')
+            {
+                LibEpdDispStringUtf8(slot->value, slot->x0, slot->y0);
+            }
+        }
+        else
+        {
+            level = atoi(slot->value);
+            level = (level < 0) ? 0 : (level > 100) ? 100 : level;
+            if (level > 0)
+            {
+                LibEpdFillRect(slot->x0, slot->y0,
+                        slot->x0 + (slot->x1 - slot->x0) * level / 100, slot->y1);
+            }
+        }
+    }
+    if (!LibEpdSendFrames(tpl->frames.data + pos, tpl->frames.len - pos))
+    {
+        return FALSE;
+    }
+
+    /* The settings the frames changed */
+    LibEpdGetState(&state);
+    state.mem_mode = (tpl->state.mem_mode != EPD_UNKNOWN) ? tpl->state.mem_mode : state.mem_mode;
+    state.rotation = (tpl->state.rotation != EPD_UNKNOWN) ? tpl->state.rotation : state.rotation;
+    state.en_font = (tpl->state.en_font != EPD_UNKNOWN) ? tpl->state.en_font : state.en_font;
+    state.ch_font = (tpl->state.ch_font != EPD_UNKNOWN) ? tpl->state.ch_font : state.ch_font;
+    state.color = (tpl->state.color != EPD_UNKNOWN) ? tpl->state.color : state.color;
+    state.bkcolor = (tpl->state.bkcolor != EPD_UNKNOWN) ? tpl->state.bkcolor : state.bkcolor;
+    LibEpdSetState(&state);
+    return TRUE;
+}
@@ -0,0 +1,56 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_template.h
+ * @brief   API of the screen templates compiled to encoded frames.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_TEMPLATE_H
+#define LIB_EPD_TEMPLATE_H
+
+#include "lib_epd.h"
+
+#define    EPD_TEMPLATE_SLOTS                 32      /* Placeholders per template */
+#define    EPD_SLOT_NAME                      32
+#define    EPD_SLOT_VALUE                     128
+
+/* LibEpdTemplateLoad() results */
+#define    EPD_TEMPLATE_FAILED                -1
+#define    EPD_TEMPLATE_COMPILED              0
+#define    EPD_TEMPLATE_CACHED                1
+
+/* Placeholder kinds */
+#define    EPD_SLOT_TEXT                      0       /* UTF-8 text at (x0, y0) */
+#define    EPD_SLOT_BAR                       1       /* Rectangle filled 0 to 100 percent */
+
+/* Placeholder, drawn between the static frames before offset and the ones after */
+typedef struct
+{
+    char name[EPD_SLOT_NAME];
+    int kind;
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+    int offset;                         /* Position in the static frames */
+    char value[EPD_SLOT_VALUE];
+} lib_epd_slot_t;
+
+/* Compiled template */
+typedef struct
+{
+    lib_epd_scene_t frames;             /* Static frames */
+    lib_epd_state_t state;              /* Settings it leaves, EPD_UNKNOWN if untouched */
+    int num_slots;
+    lib_epd_slot_t slots[EPD_TEMPLATE_SLOTS];
+} lib_epd_template_t;
+
+int LibEpdTemplateLoad(lib_epd_template_t * tpl, const char * path, const char * cache_path);
+void LibEpdTemplateFree(lib_epd_template_t * tpl);
+int LibEpdTemplateSet(lib_epd_template_t * tpl, const char * name, const char * value);
+int LibEpdTemplateDraw(const lib_epd_template_t * tpl);
+
+#endif
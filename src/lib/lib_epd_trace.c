@@ -0,0 +1,219 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_trace.c
+ * @brief   Event tracing of the e-paper library.
+ *
+ *          Each thread records its events in a ring of its own, taken on its first event, so
+ *          recording needs no lock: the thread is the only writer of its ring and publishes an
+ *          event by moving the head past it. The ring is given back when the thread exits and
+ *          taken over, events kept, by the next thread to trace, so short lived threads such as
+ *          those of the wall do not run out of rings; a track then shows them one after the
+ *          other. LibEpdTraceExport() writes the rings in the Chrome
+ *          trace event format (JSON), which chrome://tracing and Perfetto open, one track per
+ *          thread. An export while threads are still tracing may catch an event being
+ *          overwritten, so it is best done once they are quiet.
+ *
+ *          Built without EPD_TRACE, the macros of lib_epd_trace.h are empty and this file only
+ *          holds stubs.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <pthread.h>
+#include <stdint.h>
+#include "common.h"
+#include "lib_clock.h"
+#include "lib_epd_trace.h"
+
+#ifdef EPD_TRACE
+
+typedef char trace_events_pow2_t[((EPD_TRACE_EVENTS & (EPD_TRACE_EVENTS - 1)) == 0) ? 1 : -1];
+
+typedef struct
+{
+    long long ts_us;
+    const char * name;          /* String literal, kept as is */
+    long arg;
+    char kind;
+} trace_event_t;
+
+typedef struct
+{
+    trace_event_t ev[EPD_TRACE_EVENTS];
+    volatile unsigned long head;    /* Events recorded so far */
+} trace_ring_t;
+
+static trace_ring_t s_ring[EPD_TRACE_THREADS];
+static volatile int s_owned[EPD_TRACE_THREADS];    /* TRUE while a thread holds the ring */
+static volatile int s_threads = 0;  /* Rings ever taken */
+static volatile unsigned long s_dropped = 0;
+static __thread int t_slot = -1;    /* Ring of the thread, -1 if none yet */
+static pthread_key_t s_key;         /* Gives the ring back at thread exit */
+static pthread_once_t s_key_once = PTHREAD_ONCE_INIT;
+
+/* Key destructor, run at the exit of a thread holding a ring. value is the ring index + 1 */
+static void _Release(void * value)
+{
+    int slot = (int) (intptr_t) value - 1;
+
+    __sync_synchronize();
+    s_owned[slot] = FALSE;
+}
+
+static void _CreateKey(void)
+{
+    if (pthread_key_create(&s_key, _Release) != 0)
+    {
+        perror("LibEpdTraceEvent");
+    }
+}
+
+/* Take a free ring for the calling thread. Returns its index, -1 if all are held */
+static int _Take(void)
+{
+    int used;
+    int i;
+
+    pthread_once(&s_key_once, _CreateKey);
+    for (i = 0; i < EPD_TRACE_THREADS; i++)
+    {
+        if (__sync_bool_compare_and_swap(&s_owned[i], FALSE, TRUE))
+        {
+            pthread_setspecific(s_key, (void *) (intptr_t) (i + 1));
+            do
+            {
+                used = s_threads;
+            } while ((used <= i) && !__sync_bool_compare_and_swap(&s_threads, used, i + 1));
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Record an event of the calling thread. Better called through the EPD_TRACE_* macros */
+void LibEpdTraceEvent(char kind, const char * name, long arg)
+{
+    trace_ring_t * ring;
+    trace_event_t * e;
+
+    if (t_slot < 0)
+    {
+        t_slot = _Take();       /* Tried again on each event while all rings are held */
+    }
+    if (t_slot < 0)
+    {
+        __sync_fetch_and_add(&s_dropped, 1);
+        return;
+    }
+    ring = &s_ring[t_slot];
+    e = &ring->ev[ring->head & (EPD_TRACE_EVENTS - 1)];
+    e->ts_us = LibClockNowUs();
+    e->name = name;
+    e->arg = arg;
+    e->kind = kind;
+    __sync_synchronize();
+    ring->head++;
+}
+
+/* Forget the events recorded so far. To be called while no thread traces */
+void LibEpdTraceReset(void)
+{
+    int i;
+
+    for (i = 0; i < EPD_TRACE_THREADS; i++)
+    {
+        s_ring[i].head = 0;
+    }
+    s_dropped = 0;
+}
+
+/* Write the events to path in the Chrome trace event format. Returns TRUE on success */
+int LibEpdTraceExport(const char * path)
+{
+    const trace_event_t * e;
+    unsigned long head;
+    unsigned long i;
+    int threads = s_threads;
+    int first = TRUE;
+    int t;
+    FILE * fp = fopen(path, "w");
+
+    if (fp == NULL)
+    {
+        perror("LibEpdTraceExport");
+        return FALSE;
+    }
+    fprintf(fp, "{\"traceEvents\":[\n");
+    for (t = 0; t < threads; t++)
+    {
+        head = s_ring[t].head;
+        __sync_synchronize();
+        for (i = (head > EPD_TRACE_EVENTS) ? head - EPD_TRACE_EVENTS : 0; i < head; i++)
+        {
+            e = &s_ring[t].ev[i & (EPD_TRACE_EVENTS - 1)];
+            fprintf(fp, "%s{\"name\":\"%s\",\"cat\":\"epd\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%d",
+                    first ? "" : ",\n", e->name, e->kind, e->ts_us, t + 1);
+            if ((e->kind == EPD_TRACE_ASYNC_BEGIN_EV) || (e->kind == EPD_TRACE_ASYNC_END_EV))
+            {
+                fprintf(fp, ",\"id\":%ld}", e->arg);
+            }
+            else
+            {
+                fprintf(fp, "%s,\"args\":{\"arg\":%ld}}",
+                        (e->kind == EPD_TRACE_INSTANT_EV) ? ",\"s\":\"t\"" : "", e->arg);
+            }
+            first = FALSE;
+        }
+    }
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    if (fclose(fp) != 0)
+    {
+        perror("LibEpdTraceExport");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void LibEpdTraceGetStats(lib_epd_trace_stats_t * stats)
+{
+    unsigned long head;
+    int t;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->threads = s_threads;
+    for (t = 0; t < stats->threads; t++)
+    {
+        head = s_ring[t].head;
+        stats->events += head;
+        stats->overwritten += (head > EPD_TRACE_EVENTS) ? head - EPD_TRACE_EVENTS : 0;
+    }
+    stats->dropped = s_dropped;
+}
+
+#else
+
+void LibEpdTraceEvent(char kind, const char * name, long arg)
+{
+    (void) kind;
+    (void) name;
+    (void) arg;
+}
+
+void LibEpdTraceReset(void)
+{
+}
+
+int LibEpdTraceExport(const char * path)
+{
+    fprintf(stderr, "LibEpdTraceExport: %s not written, built without EPD_TRACE\n", path);
+    return FALSE;
+}
+
+void LibEpdTraceGetStats(lib_epd_trace_stats_t * stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+#endif
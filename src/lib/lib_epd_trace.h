@@ -0,0 +1,62 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_trace.h
+ * @brief   API of the event tracing of the e-paper library.
+ *
+ *          The EPD_TRACE_* macros record nothing, and cost nothing, unless the library is built
+ *          with EPD_TRACE defined.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_TRACE_H
+#define LIB_EPD_TRACE_H
+
+/* Events kept per thread, the oldest overwritten first. A power of two */
+#ifndef EPD_TRACE_EVENTS
+#define    EPD_TRACE_EVENTS                   4096
+#endif
+
+/* Threads traced at a time, the events of any further thread are dropped until one exits */
+#ifndef EPD_TRACE_THREADS
+#define    EPD_TRACE_THREADS                  8
+#endif
+
+/* Event kinds, as in the Chrome trace event format */
+#define    EPD_TRACE_BEGIN_EV                 'B'     /* Span opened in this thread */
+#define    EPD_TRACE_END_EV                   'E'     /* Span closed in this thread */
+#define    EPD_TRACE_INSTANT_EV               'i'
+#define    EPD_TRACE_ASYNC_BEGIN_EV           'b'     /* Span that may close in another thread */
+#define    EPD_TRACE_ASYNC_END_EV             'e'
+
+#ifdef EPD_TRACE
+#define    EPD_TRACE_BEGIN(name, arg)         LibEpdTraceEvent(EPD_TRACE_BEGIN_EV, (name), (arg))
+#define    EPD_TRACE_END(name, arg)           LibEpdTraceEvent(EPD_TRACE_END_EV, (name), (arg))
+#define    EPD_TRACE_INSTANT(name, arg)       LibEpdTraceEvent(EPD_TRACE_INSTANT_EV, (name), (arg))
+#define    EPD_TRACE_ASYNC_BEGIN(name, id)    LibEpdTraceEvent(EPD_TRACE_ASYNC_BEGIN_EV, (name), (id))
+#define    EPD_TRACE_ASYNC_END(name, id)      LibEpdTraceEvent(EPD_TRACE_ASYNC_END_EV, (name), (id))
+#else
+#define    EPD_TRACE_BEGIN(name, arg)         ((void) 0)
+#define    EPD_TRACE_END(name, arg)           ((void) 0)
+#define    EPD_TRACE_INSTANT(name, arg)       ((void) 0)
+#define    EPD_TRACE_ASYNC_BEGIN(name, id)    ((void) 0)
+#define    EPD_TRACE_ASYNC_END(name, id)      ((void) 0)
+#endif
+
+/* Trace counters */
+typedef struct
+{
+    int threads;                /* Rings that recorded events */
+    unsigned long events;       /* Events recorded */
+    unsigned long overwritten;  /* Events lost to the wrap of a ring */
+    unsigned long dropped;      /* Events of threads that found no free ring */
+} lib_epd_trace_stats_t;
+
+void LibEpdTraceEvent(char kind, const char * name, long arg);
+void LibEpdTraceReset(void);
+int LibEpdTraceExport(const char * path);
+void LibEpdTraceGetStats(lib_epd_trace_stats_t * stats);
+
+#endif
@@ -0,0 +1,622 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_wall.c
+ * @brief   Video wall of e-paper screens.
+ *
+ *          Several panels side by side, each on its own UART, make one canvas of cols x rows
+ *          panels, with bezel pixels of canvas hidden between two panels. Each primitive drawn
+ *          on the canvas is recorded, in the coordinates of the panel, into the scene of every
+ *          panel it touches:
+ *          - pixels, rectangles and circles wholly on one panel go as they are;
+ *          - lines are clipped to the panel (Cohen-Sutherland), rectangles intersected with it;
+ *          - circles over an edge are cut into horizontal lines, one or two per row, since the
+ *            e-paper cannot be given a center off the panel;
+ *          - text is split between characters, with the metrics of lib_epd_layout. A
+ *            character goes whole to the panel its left edge falls on, and a line of text to
+ *            the row of panels its top falls on, the part past the edge lost.
+ *          A circle cut into lines may be a pixel off the one the e-paper would draw.
+ *
+ *          LibEpdWallFlush() then writes the scenes to all the panels at once, one thread per
+ *          panel. LibEpdWallUpdate() also waits until every panel answered its frames and a
+ *          handshake, so they are all idle, and then sends the update to all of them together,
+ *          so the wall refreshes as one. The replies to the frames of a plain flush and to the
+ *          last update are left unread; each panel counts them and the next wait reads them
+ *          first, so none of them passes for the answer to the handshake.
+ *
+ *          The panels are written plainly: the link, skip and power layers only drive the
+ *          e-paper of lib_epd. The lib_epd orientation is taken to be EPD_ROTATE_0.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include <pthread.h>
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_layout.h"
+#include "lib_epd_wall.h"
+#include "drv_uart.h"
+
+#define WALL_CLIP_LEFT      0x01
+#define WALL_CLIP_RIGHT     0x02
+#define WALL_CLIP_TOP       0x04
+#define WALL_CLIP_BOTTOM    0x08
+
+typedef struct
+{
+    int fd;
+    int x;                      /* Canvas position of the top left pixel */
+    int y;
+    lib_epd_scene_t scene;
+    int update;                 /* Send the update once all panels are ready */
+    int unread;                 /* Replies to frames written earlier, not read yet */
+    int ok;
+    long long ready_us;
+    long long update_us;
+} wall_panel_t;
+
+static wall_panel_t s_panel[EPD_WALL_MAX];
+static int s_panels = 0;
+static int s_cols = 0;
+static int s_rows = 0;
+static int s_bezel = 0;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_ready = PTHREAD_COND_INITIALIZER;
+static int s_waiting = 0;        /* Panels ready for the update */
+static int s_running = 0;        /* Panels with a thread */
+static lib_epd_wall_stats_t s_stats;
+
+/* Encode a frame with no data */
+static void _Frame(unsigned char cmd, unsigned char * frame)
+{
+    int i;
+
+    frame[0] = START;
+    frame[1] = 0x00;
+    frame[2] = 0x09;
+    frame[3] = cmd;
+    frame[4] = END_0;
+    frame[5] = END_1;
+    frame[6] = END_2;
+    frame[7] = END_3;
+    frame[8] = 0;
+    for (i = 0; i < 8; i++)
+    {
+        frame[8] ^= frame[i];
+    }
+}
+
+static long long _RoundDiv(long long n, long long d)
+{
+    if (d < 0)
+    {
+        n = -n;
+        d = -d;
+    }
+    return (n >= 0) ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+static int _Isqrt(long v)
+{
+    long r = 0;
+
+    while ((r + 1) * (r + 1) <= v)
+    {
+        r++;
+    }
+    return (int) r;
+}
+
+static int _Outcode(int x, int y, int x1, int y1)
+{
+    return ((x < 0) ? WALL_CLIP_LEFT : 0) | ((x > x1) ? WALL_CLIP_RIGHT : 0)
+            | ((y < 0) ? WALL_CLIP_TOP : 0) | ((y > y1) ? WALL_CLIP_BOTTOM : 0);
+}
+
+/* Clip a line in panel coordinates to the panel. Returns FALSE if nothing is left */
+static int _ClipLine(int * x0, int * y0, int * x1, int * y1)
+{
+    const int xm = EPD_WIDTH - 1;
+    const int ym = EPD_HEIGHT - 1;
+    int c0 = _Outcode(*x0, *y0, xm, ym);
+    int c1 = _Outcode(*x1, *y1, xm, ym);
+    int c;
+    long long x;
+    long long y;
+
+    while (TRUE)
+    {
+        if ((c0 | c1) == 0)
+        {
+            return TRUE;
+        }
+        if ((c0 & c1) != 0)
+        {
+            return FALSE;
+        }
+        c = (c0 != 0) ? c0 : c1;
+        if (c & WALL_CLIP_TOP)
+        {
+            y = 0;
+            x = *x0 + _RoundDiv((long long) (*x1 - *x0) * (0 - *y0), *y1 - *y0);
+        }
+        else if (c & WALL_CLIP_BOTTOM)
+        {
+            y = ym;
+            x = *x0 + _RoundDiv((long long) (*x1 - *x0) * (ym - *y0), *y1 - *y0);
+        }
+        else if (c & WALL_CLIP_RIGHT)
+        {
+            x = xm;
+            y = *y0 + _RoundDiv((long long) (*y1 - *y0) * (xm - *x0), *x1 - *x0);
+        }
+        else
+        {
+            x = 0;
+            y = *y0 + _RoundDiv((long long) (*y1 - *y0) * (0 - *x0), *x1 - *x0);
+        }
+        if (c == c0)
+        {
+            *x0 = (int) x;
+            *y0 = (int) y;
+            c0 = _Outcode(*x0, *y0, xm, ym);
+        }
+        else
+        {
+            *x1 = (int) x;
+            *y1 = (int) y;
+            c1 = _Outcode(*x1, *y1, xm, ym);
+        }
+    }
+}
+
+/* Does the canvas box touch the panel, and does it fit in it whole */
+static int _Touches(const wall_panel_t * p, int x0, int y0, int x1, int y1, int * whole)
+{
+    *whole = (x0 >= p->x) && (x1 < p->x + EPD_WIDTH) && (y0 >= p->y) && (y1 < p->y + EPD_HEIGHT);
+    return (x1 >= p->x) && (x0 < p->x + EPD_WIDTH) && (y1 >= p->y) && (y0 < p->y + EPD_HEIGHT);
+}
+
+/* Horizontal run of a circle cut into lines, in panel coordinates */
+static void _Span(int xa, int xb, int y)
+{
+    xa = (xa < 0) ? 0 : xa;
+    xb = (xb > EPD_WIDTH - 1) ? EPD_WIDTH - 1 : xb;
+    if ((xa <= xb) && (y >= 0) && (y < EPD_HEIGHT))
+    {
+        LibEpdDrawLine(xa, y, xb, y);
+    }
+}
+
+/* Circle over a panel edge, in panel coordinates, as lines */
+static void _CutCircle(int cx, int cy, int r, int fill)
+{
+    int outer;
+    int inner;
+    int dy;
+
+    for (dy = -r; dy <= r; dy++)
+    {
+        if ((cy + dy < 0) || (cy + dy >= EPD_HEIGHT))
+        {
+            continue;
+        }
+        outer = _Isqrt((long) r * r - (long) dy * dy);
+        inner = (fill || (dy <= -r + 1) || (dy >= r - 1)) ? -1
+                : _Isqrt((long) (r - 1) * (r - 1) - (long) dy * dy);
+        if (inner < 0)
+        {
+            _Span(cx - outer, cx + outer, cy + dy);
+        }
+        else
+        {
+            _Span(cx - outer, cx - inner - 1, cy + dy);
+            _Span(cx + inner + 1, cx + outer, cy + dy);
+        }
+    }
+}
+
+static void _Circle(int x0, int y0, int r, int fill)
+{
+    wall_panel_t * p;
+    int whole;
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        p = &s_panel[i];
+        if (!_Touches(p, x0 - r, y0 - r, x0 + r, y0 + r, &whole))
+        {
+            continue;
+        }
+        LibEpdSceneBegin(&p->scene);
+        if (!whole)
+        {
+            _CutCircle(x0 - p->x, y0 - p->y, r, fill);
+        }
+        else if (fill)
+        {
+            LibEpdFillCircle(x0 - p->x, y0 - p->y, r);
+        }
+        else
+        {
+            LibEpdDrawCircle(x0 - p->x, y0 - p->y, r);
+        }
+        LibEpdSceneEnd();
+    }
+}
+
+/* Write the scene of a panel, wait for it to have run it, then send the update with the others */
+static void * _Transmit(void * arg)
+{
+    wall_panel_t * p = (wall_panel_t *) arg;
+    unsigned char frame[9];
+    unsigned char rx[64];
+    long long due = LibClockNowUs() + EPD_WALL_READY_US;
+    long long now;
+    int replies = 0;
+    int expected;
+    int prev = 0;
+    int n;
+    int i;
+
+    p->ok = (DrvUartWritePort(p->fd, p->scene.data, p->scene.len) >= 0);
+    if (p->ok && p->update)
+    {
+        /* Every frame is answered, those written earlier first and the handshake last */
+        expected = p->unread + p->scene.frames + 1;
+        _Frame(CMD_HANDSHAKE, frame);
+        p->ok = (DrvUartWritePort(p->fd, frame, 9) == 9);
+        while (p->ok && (replies < expected) && ((now = LibClockNowUs()) < due))
+        {
+            n = DrvUartReadPort(p->fd, rx, sizeof(rx), (long) (due - now));
+            p->ok = (n >= 0);
+            for (i = 0; i < n; i++)
+            {
+                replies += (((prev == 'O') && (rx[i] == 'K')) || (rx[i] == 'E')) ? 1 : 0;
+                prev = rx[i];
+            }
+        }
+        p->ok = p->ok && (replies >= expected);
+        p->unread = 0;
+        if (!p->ok)
+        {
+            /* Replies may still come, the count is lost */
+            DrvUartFlushPort(p->fd);
+        }
+    }
+    else if (p->ok)
+    {
+        p->unread += p->scene.frames;
+        p->ok = DrvUartDrainPort(p->fd);
+    }
+    p->ready_us = LibClockNowUs();
+
+    if (p->update)
+    {
+        /* Reached whether the panel is ready or not, the others wait for it */
+        pthread_mutex_lock(&s_lock);
+        s_waiting++;
+        pthread_cond_broadcast(&s_ready);
+        while (s_waiting < s_running)
+        {
+            pthread_cond_wait(&s_ready, &s_lock);
+        }
+        pthread_mutex_unlock(&s_lock);
+        _Frame(CMD_UPDATE, frame);
+        p->update_us = LibClockNowUs();
+        if (DrvUartWritePort(p->fd, frame, 9) == 9)
+        {
+            p->unread++;
+        }
+        else
+        {
+            p->ok = FALSE;
+        }
+    }
+    return NULL;
+}
+
+static int _Send(int update)
+{
+    pthread_t thread[EPD_WALL_MAX];
+    int started[EPD_WALL_MAX];
+    long long start = LibClockNowUs();
+    long long first = 0;
+    long long last = 0;
+    int spread = FALSE;
+    int i;
+
+    if (s_panels == 0)
+    {
+        return FALSE;
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.panels = s_panels;
+    s_waiting = 0;
+    s_running = s_panels;
+    for (i = 0; i < s_panels; i++)
+    {
+        s_panel[i].update = update;
+        s_panel[i].ready_us = start;
+        s_stats.bytes += s_panel[i].scene.len + (update ? 18 : 0);
+        started[i] = (pthread_create(&thread[i], NULL, _Transmit, &s_panel[i]) == 0);
+        if (!started[i])
+        {
+            /* Not waited for by the others */
+            perror("LibEpdWallFlush");
+            s_panel[i].ok = FALSE;
+            pthread_mutex_lock(&s_lock);
+            s_running--;
+            pthread_cond_broadcast(&s_ready);
+            pthread_mutex_unlock(&s_lock);
+        }
+    }
+    for (i = 0; i < s_panels; i++)
+    {
+        if (started[i])
+        {
+            pthread_join(thread[i], NULL);
+        }
+    }
+    for (i = 0; i < s_panels; i++)
+    {
+        s_stats.failed += s_panel[i].ok ? 0 : 1;
+        if (s_panel[i].ready_us - start > s_stats.send_us)
+        {
+            s_stats.send_us = (long) (s_panel[i].ready_us - start);
+        }
+        if (update && started[i])
+        {
+            first = (!spread || (s_panel[i].update_us < first)) ? s_panel[i].update_us : first;
+            last = (!spread || (s_panel[i].update_us > last)) ? s_panel[i].update_us : last;
+            spread = TRUE;
+        }
+        LibEpdSceneReset(&s_panel[i].scene);
+    }
+    s_stats.skew_us = (long) (last - first);
+    return s_stats.failed == 0;
+}
+
+/* Open a wall of cols x rows panels, devs naming their UARTs row by row, bezel canvas pixels
+ * hidden between two panels. Returns TRUE on success */
+int LibEpdWallOpen(int cols, int rows, int bezel, const char * const * devs, int speed)
+{
+    char dev[256];
+    int i;
+
+    LibEpdWallClose();
+    if ((cols < 1) || (rows < 1) || (cols * rows > EPD_WALL_MAX))
+    {
+        fprintf(stderr, "LibEpdWallOpen: %d x %d panels, at most %d\n", cols, rows, EPD_WALL_MAX);
+        return FALSE;
+    }
+    for (i = 0; i < cols * rows; i++)
+    {
+        snprintf(dev, sizeof(dev), "%s", devs[i]);
+        s_panel[i].fd = DrvUartOpenPort(dev, speed, 8, 1, 'N');
+        if (s_panel[i].fd < 0)
+        {
+            LibEpdWallClose();
+            return FALSE;
+        }
+        s_panel[i].x = (i % cols) * (EPD_WIDTH + bezel);
+        s_panel[i].y = (i / cols) * (EPD_HEIGHT + bezel);
+        s_panel[i].unread = 0;
+        LibEpdSceneInit(&s_panel[i].scene);
+        s_panels = i + 1;
+    }
+    s_cols = cols;
+    s_rows = rows;
+    s_bezel = bezel;
+    return TRUE;
+}
+
+void LibEpdWallClose(void)
+{
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        close(s_panel[i].fd);
+        LibEpdSceneFree(&s_panel[i].scene);
+    }
+    s_panels = 0;
+}
+
+/* Size of the canvas in pixels, bezels included */
+void LibEpdWallSize(int * width, int * height)
+{
+    *width = s_cols * EPD_WIDTH + (s_cols - 1) * s_bezel;
+    *height = s_rows * EPD_HEIGHT + (s_rows - 1) * s_bezel;
+}
+
+void LibEpdWallSetColor(unsigned char color, unsigned char bkcolor)
+{
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        LibEpdSceneBegin(&s_panel[i].scene);
+        LibEpdSetColor(color, bkcolor);
+        LibEpdSceneEnd();
+    }
+}
+
+/* English and Chinese font of the same size */
+void LibEpdWallSetFont(unsigned char font)
+{
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        LibEpdSceneBegin(&s_panel[i].scene);
+        LibEpdSetEnFont(font);
+        LibEpdSetChFont(font);
+        LibEpdSceneEnd();
+    }
+}
+
+void LibEpdWallClear(void)
+{
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        LibEpdSceneBegin(&s_panel[i].scene);
+        LibEpdClear();
+        LibEpdSceneEnd();
+    }
+}
+
+void LibEpdWallDrawPixel(int x0, int y0)
+{
+    LibEpdWallFillRect(x0, y0, x0, y0);
+}
+
+void LibEpdWallDrawLine(int x0, int y0, int x1, int y1)
+{
+    wall_panel_t * p;
+    int xa;
+    int ya;
+    int xb;
+    int yb;
+    int whole;
+    int i;
+
+    for (i = 0; i < s_panels; i++)
+    {
+        p = &s_panel[i];
+        if (!_Touches(p, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 > x1) ? x0 : x1,
+                (y0 > y1) ? y0 : y1, &whole))
+        {
+            continue;
+        }
+        xa = x0 - p->x;
+        ya = y0 - p->y;
+        xb = x1 - p->x;
+        yb = y1 - p->y;
+        if (whole || _ClipLine(&xa, &ya, &xb, &yb))
+        {
+            LibEpdSceneBegin(&p->scene);
+            LibEpdDrawLine(xa, ya, xb, yb);
+            LibEpdSceneEnd();
+        }
+    }
+}
+
+void LibEpdWallFillRect(int x0, int y0, int x1, int y1)
+{
+    wall_panel_t * p;
+    int t;
+    int whole;
+    int i;
+
+    if (x0 > x1)
+    {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (y0 > y1)
+    {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    for (i = 0; i < s_panels; i++)
+    {
+        p = &s_panel[i];
+        if (!_Touches(p, x0, y0, x1, y1, &whole))
+        {
+            continue;
+        }
+        LibEpdSceneBegin(&p->scene);
+        if ((x0 == x1) && (y0 == y1))
+        {
+            LibEpdDrawPixel(x0 - p->x, y0 - p->y);
+        }
+        else
+        {
+            LibEpdFillRect((x0 > p->x) ? x0 - p->x : 0, (y0 > p->y) ? y0 - p->y : 0,
+                    (x1 < p->x + EPD_WIDTH) ? x1 - p->x : EPD_WIDTH - 1,
+                    (y1 < p->y + EPD_HEIGHT) ? y1 - p->y : EPD_HEIGHT - 1);
+        }
+        LibEpdSceneEnd();
+    }
+}
+
+void LibEpdWallDrawCircle(int x0, int y0, int r)
+{
+    _Circle(x0, y0, r, FALSE);
+}
+
+void LibEpdWallFillCircle(int x0, int y0, int r)
+{
+    _Circle(x0, y0, r, TRUE);
+}
+
+/* GBK text with its top left corner at (x0, y0), split between the panels it crosses */
+void LibEpdWallDispString(const char * gbk, int x0, int y0)
+{
+    const unsigned char * s = (const unsigned char *) gbk;
+    char part[FRAME_BUFF_SIZE];
+    wall_panel_t * p = NULL;
+    wall_panel_t * at;
+    int start = 0;
+    int len = (int) strlen(gbk);
+    int cl;
+    int cx;
+    int i;
+    int j;
+
+    for (i = 0; i <= len; i += cl)
+    {
+        cl = ((i < len - 1) && (s[i] >= 0x81) && (s[i] <= 0xFE) && (s[i + 1] >= 0x40)) ? 2 : 1;
+        at = NULL;
+        cx = x0 + LibEpdTextWidth(gbk, i);
+        for (j = 0; (i < len) && (j < s_panels); j++)
+        {
+            if ((cx >= s_panel[j].x) && (cx < s_panel[j].x + EPD_WIDTH)
+                    && (y0 >= s_panel[j].y) && (y0 < s_panel[j].y + EPD_HEIGHT))
+            {
+                at = &s_panel[j];
+            }
+        }
+        if ((at == p) && (i < len))
+        {
+            continue;
+        }
+        /* The characters [start, i) go to p */
+        if ((p != NULL) && (i - start < (int) sizeof(part)))
+        {
+            memcpy(part, gbk + start, i - start);
+            part[i - start] = '\0';
+            LibEpdSceneBegin(&p->scene);
+            LibEpdDispString(part, x0 + LibEpdTextWidth(gbk, start) - p->x, y0 - p->y);
+            LibEpdSceneEnd();
+        }
+        p = at;
+        start = i;
+    }
+}
+
+/* Write what was drawn to every panel at once. Returns TRUE if all were written */
+int LibEpdWallFlush(void)
+{
+    return _Send(FALSE);
+}
+
+/* Write what was drawn, wait until every panel has run it, then update them all together.
+ * Returns TRUE if every panel was written and answered */
+int LibEpdWallUpdate(void)
+{
+    return _Send(TRUE);
+}
+
+void LibEpdWallGetStats(lib_epd_wall_stats_t * stats)
+{
+    *stats = s_stats;
+}
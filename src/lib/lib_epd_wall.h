@@ -0,0 +1,50 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_wall.h
+ * @brief   API of the video wall of e-paper screens.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_WALL_H
+#define LIB_EPD_WALL_H
+
+#include "lib_epd.h"
+
+/* Most panels of a wall */
+#define    EPD_WALL_MAX                       16
+
+/* Longest wait for a panel to run the frames sent before the update */
+#define    EPD_WALL_READY_US                  5000000
+
+/* Counters of the last flush */
+typedef struct
+{
+    int panels;
+    int failed;                 /* Panels that could not be written or did not answer */
+    long bytes;                 /* Bytes sent to all panels */
+    long send_us;               /* Time of the slowest panel to be ready for the update */
+    long skew_us;               /* Spread of the times the panels were sent the update */
+} lib_epd_wall_stats_t;
+
+int LibEpdWallOpen(int cols, int rows, int bezel, const char * const * devs, int speed);
+void LibEpdWallClose(void);
+void LibEpdWallSize(int * width, int * height);
+
+void LibEpdWallSetColor(unsigned char color, unsigned char bkcolor);
+void LibEpdWallSetFont(unsigned char font);
+void LibEpdWallClear(void);
+void LibEpdWallDrawPixel(int x0, int y0);
+void LibEpdWallDrawLine(int x0, int y0, int x1, int y1);
+void LibEpdWallFillRect(int x0, int y0, int x1, int y1);
+void LibEpdWallDrawCircle(int x0, int y0, int r);
+void LibEpdWallFillCircle(int x0, int y0, int r);
+void LibEpdWallDispString(const char * gbk, int x0, int y0);
+
+int LibEpdWallFlush(void);
+int LibEpdWallUpdate(void);
+void LibEpdWallGetStats(lib_epd_wall_stats_t * stats);
+
+#endif
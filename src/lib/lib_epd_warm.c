@@ -0,0 +1,184 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_warm.c
+ * @brief   Warm start of the e-paper screen.
+ *
+ *          The e-paper keeps its settings while our process restarts. The settings last sent
+ *          (baud, memory mode, rotation, fonts, colours) are saved to a state file; on the next
+ *          start one handshake round trip at the saved baud confirms the e-paper is still there
+ *          and still ready, and only the settings that differ from the wanted ones are sent.
+ *          Without a state file, or without an answer within EPD_WARM_PROBE_US, the cold
+ *          sequence is used: UART at the default baud, wake up, handshake, then all wanted
+ *          settings. A sleeping or absent e-paper thus costs the probe, not the UART timeout.
+ *
+ *          A handshake reply does not prove the e-paper kept its settings: it answers the same
+ *          after a power cycle. The state file is keyed on the boot id of the kernel, so a
+ *          reboot, which usually power cycles the e-paper too, always starts cold. An e-paper
+ *          power cycled on its own while the system stays up is not detected: remove the
+ *          state file, or save it again after a cold start, whenever that may happen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_warm.h"
+
+#define WARM_MAGIC      0x45504453      /* "EPDS" */
+#define WARM_VERSION    2
+#define WARM_BAUD       115200          /* Baud of the e-paper after power up */
+#define WARM_BOOT_ID    "/proc/sys/kernel/random/boot_id"
+
+typedef struct
+{
+    unsigned int magic;
+    unsigned int version;
+    char boot_id[40];               /* Boot the settings were sent in, empty if unknown */
+    lib_epd_state_t state;
+} warm_file_t;
+
+/* Read the boot id of the kernel, left empty if it cannot be read */
+static void _BootId(char * id, int size)
+{
+    FILE * fd;
+
+    memset(id, 0, size);
+    fd = fopen(WARM_BOOT_ID, "r");
+    if (fd == NULL)
+    {
+        return;
+    }
+    if (fgets(id, size, fd) == NULL)
+    {
+        id[0] = '\0';
+    }
+    id[strcspn(id, "\n")] = '\0';
+    fclose(fd);
+}
+
+/* Read the state file. Returns TRUE if it holds a usable state, saved since the last boot */
+static int _Load(const char * path, lib_epd_state_t * state)
+{
+    warm_file_t file;
+    char boot_id[sizeof(file.boot_id)];
+    FILE * fd;
+    size_t n;
+
+    fd = fopen(path, "rb");
+    if (fd == NULL)
+    {
+        return FALSE;
+    }
+    n = fread(&file, sizeof(file), 1, fd);
+    fclose(fd);
+
+    _BootId(boot_id, sizeof(boot_id));
+    if ((n != 1) || (file.magic != WARM_MAGIC) || (file.version != WARM_VERSION)
+            || (file.state.baud <= 0)
+            || (strncmp(file.boot_id, boot_id, sizeof(boot_id)) != 0))
+    {
+        return FALSE;
+    }
+    *state = file.state;
+    return TRUE;
+}
+
+/* Send the wanted settings that differ from the current ones */
+static void _Apply(const lib_epd_state_t * want)
+{
+    lib_epd_state_t cur;
+
+    LibEpdGetSentState(&cur);
+    if ((want->mem_mode != EPD_UNKNOWN) && (want->mem_mode != cur.mem_mode))
+    {
+        LibEpdSetMemory(want->mem_mode);
+    }
+    if ((want->rotation != EPD_UNKNOWN) && (want->rotation != cur.rotation))
+    {
+        LibEpdScreenRotation(want->rotation);
+    }
+    if ((want->en_font != EPD_UNKNOWN) && (want->en_font != cur.en_font))
+    {
+        LibEpdSetEnFont(want->en_font);
+    }
+    if ((want->ch_font != EPD_UNKNOWN) && (want->ch_font != cur.ch_font))
+    {
+        LibEpdSetChFont(want->ch_font);
+    }
+    if ((want->color != EPD_UNKNOWN)
+            && ((want->color != cur.color) || (want->bkcolor != cur.bkcolor)))
+    {
+        LibEpdSetColor(want->color, want->bkcolor);
+    }
+}
+
+/* Open the e-paper, reusing the saved state when the e-paper confirms it is ready.
+ * want: settings to end up with, EPD_UNKNOWN fields are left alone. The baud is kept as found.
+ * Returns EPD_START_WARM, EPD_START_COLD or EPD_START_FAILED */
+int LibEpdWarmStart(const char * path, const lib_epd_state_t * want)
+{
+    lib_epd_state_t state;
+    int result = EPD_START_WARM;
+
+    if (!_Load(path, &state) || !LibEpdInitSpeed((int) state.baud)
+            || !LibEpdWaitReadyUs(EPD_WARM_PROBE_US))
+    {
+        /* Cold start: default baud, wake up and wait for the handshake */
+        result = EPD_START_COLD;
+        LibEpdClose();
+        if (!LibEpdInitSpeed(WARM_BAUD))
+        {
+            return EPD_START_FAILED;
+        }
+        LibEpdWakeup();
+        if (!LibEpdWaitReady())
+        {
+            return EPD_START_FAILED;
+        }
+        memset(&state, EPD_UNKNOWN, sizeof(state));
+        state.baud = WARM_BAUD;
+    }
+    LibEpdSetSentState(&state);
+
+    if (want != NULL)
+    {
+        _Apply(want);
+    }
+    LibEpdWarmSave(path);
+
+    return result;
+}
+
+/* Save the current settings for the next warm start. Returns TRUE on success */
+int LibEpdWarmSave(const char * path)
+{
+    warm_file_t file;
+    char tmp[256];
+    FILE * fd;
+    size_t n;
+
+    memset(&file, 0, sizeof(file));
+    file.magic = WARM_MAGIC;
+    file.version = WARM_VERSION;
+    _BootId(file.boot_id, sizeof(file.boot_id));
+    LibEpdGetSentState(&file.state);
+
+    /* Write aside and rename, so a crash never leaves half a file */
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    fd = fopen(tmp, "wb");
+    if (fd == NULL)
+    {
+        perror("LibEpdWarmSave");
+        return FALSE;
+    }
+    n = fwrite(&file, sizeof(file), 1, fd);
+    if ((fclose(fd) != 0) || (n != 1) || (rename(tmp, path) != 0))
+    {
+        perror("LibEpdWarmSave");
+        unlink(tmp);
+        return FALSE;
+    }
+    return TRUE;
+}
@@ -0,0 +1,30 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_warm.h
+ * @brief   API of the warm start of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_WARM_H
+#define LIB_EPD_WARM_H
+
+#include "lib_epd.h"
+
+/* Where the settings survive a restart of the process */
+#define    EPD_STATE_FILE                     "/var/tmp/epd_state"
+
+/* Wait for the handshake reply at the saved baud before falling back to a cold start */
+#define    EPD_WARM_PROBE_US                  500000
+
+/* LibEpdWarmStart() results */
+#define    EPD_START_FAILED                   -1
+#define    EPD_START_COLD                     0
+#define    EPD_START_WARM                     1
+
+int LibEpdWarmStart(const char * path, const lib_epd_state_t * want);
+int LibEpdWarmSave(const char * path);
+
+#endif
@@ -0,0 +1,345 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_widget.c
+ * @brief   Retained widgets of the e-paper screen.
+ *
+ *          The screen is kept as a tree of widgets, each with its bounds, colors and value.
+ *          Changing a value only marks the widget dirty, and only if the value really changed.
+ *          LibEpdWidgetCommit() then erases each dirty widget with a background rectangle,
+ *          draws it again, and updates the screen, all recorded into one scene so the commit
+ *          goes out in one write. Redrawing a widget redraws its children, drawn over it.
+ *
+ *          The first commit clears the screen and draws every widget. Siblings are expected
+ *          not to overlap, since erasing one would wipe the other.
+ *
+ *          Coordinates of a widget are relative to its parent, corners included.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_epd.h"
+#include "lib_epd_layout.h"
+#include "lib_epd_shape.h"
+#include "lib_epd_widget.h"
+
+#define WIDGET_GAUGE_FROM   135     /* Gauge start, degrees clockwise from the right */
+#define WIDGET_GAUGE_SWEEP  270
+
+typedef struct
+{
+    int kind;
+    int parent;
+    int x0;             /* Bounds on the screen */
+    int y0;
+    int x1;
+    int y1;
+    unsigned char color;
+    unsigned char bkcolor;
+    unsigned char font;
+    int align;
+    int value;
+    char text[EPD_WIDGET_TEXT];
+    int dirty;
+} widget_t;
+
+static widget_t s_widget[EPD_WIDGET_MAX];
+static int s_count = 0;
+static int s_full = TRUE;       /* Screen to be cleared and every widget drawn */
+static unsigned char s_color = BLACK;
+static unsigned char s_bkcolor = WHITE;
+static lib_epd_scene_t s_scene;
+static int s_scene_ready = FALSE;
+static lib_epd_widget_stats_t s_stats;
+
+static widget_t * _Get(int w)
+{
+    return ((w >= 0) && (w < s_count)) ? &s_widget[w] : NULL;
+}
+
+/* Set the colors, unless the e-paper already has them */
+static void _Color(unsigned char color, unsigned char bkcolor)
+{
+    lib_epd_state_t st;
+
+    LibEpdGetState(&st);
+    if ((st.color != color) || (st.bkcolor != bkcolor))
+    {
+        LibEpdSetColor(color, bkcolor);
+    }
+}
+
+static void _Font(unsigned char font)
+{
+    lib_epd_state_t st;
+
+    LibEpdGetState(&st);
+    if (st.en_font != font)
+    {
+        LibEpdSetEnFont(font);
+    }
+    if (st.ch_font != font)
+    {
+        LibEpdSetChFont(font);
+    }
+}
+
+static void _Text(const widget_t * wd, const char * gbk)
+{
+    lib_epd_layout_t box;
+
+    box.x0 = wd->x0;
+    box.y0 = wd->y0;
+    box.x1 = wd->x1;
+    box.y1 = wd->y1;
+    box.align = wd->align;
+    box.valign = EPD_ALIGN_MIDDLE;
+    box.flags = EPD_LAYOUT_WRAP | EPD_LAYOUT_ELLIPSIS;
+    box.line_gap = 0;
+    _Font(wd->font);
+    LibEpdLayoutText(&box, gbk);
+}
+
+static void _Gauge(const widget_t * wd)
+{
+    int cx = (wd->x0 + wd->x1) / 2;
+    int cy = (wd->y0 + wd->y1) / 2;
+    int r = ((wd->x1 - wd->x0 < wd->y1 - wd->y0) ? wd->x1 - wd->x0 : wd->y1 - wd->y0) / 2;
+    int sweep = WIDGET_GAUGE_SWEEP * wd->value / 100;
+
+    if (sweep > 0)
+    {
+        LibEpdFillPie(cx, cy, r, WIDGET_GAUGE_FROM, WIDGET_GAUGE_FROM + sweep, NULL);
+    }
+    LibEpdDrawArc(cx, cy, r, WIDGET_GAUGE_FROM, WIDGET_GAUGE_FROM + WIDGET_GAUGE_SWEEP, NULL);
+    _Color(wd->bkcolor, wd->bkcolor);
+    LibEpdFillCircle(cx, cy, r * 2 / 3);
+}
+
+/* Erase a widget to its background and draw it */
+static void _Draw(const widget_t * wd)
+{
+    char clock[8];
+
+    _Color(wd->bkcolor, wd->bkcolor);
+    LibEpdFillRect(wd->x0, wd->y0, wd->x1, wd->y1);
+    _Color(wd->color, wd->bkcolor);
+
+    switch (wd->kind)
+    {
+    case EPD_WIDGET_PANEL:
+        if (wd->value != 0)
+        {
+            LibEpdDrawRoundRect(wd->x0, wd->y0, wd->x1, wd->y1, 0, NULL);
+        }
+        break;
+    case EPD_WIDGET_LABEL:
+        _Text(wd, wd->text);
+        break;
+    case EPD_WIDGET_PROGRESS:
+        LibEpdDrawRoundRect(wd->x0, wd->y0, wd->x1, wd->y1, 0, NULL);
+        if ((wd->value > 0) && (wd->x1 - wd->x0 > 2))
+        {
+            LibEpdFillRect(wd->x0 + 2, wd->y0 + 2,
+                    wd->x0 + 2 + (wd->x1 - wd->x0 - 4) * wd->value / 100, wd->y1 - 2);
+        }
+        break;
+    case EPD_WIDGET_GAUGE:
+        _Gauge(wd);
+        break;
+    case EPD_WIDGET_ICON:
+        if (wd->text[0] != '\0')
+        {
+            LibEpdDispBitmap(wd->text, wd->x0, wd->y0);
+        }
+        break;
+    case EPD_WIDGET_CLOCK:
+        snprintf(clock, sizeof(clock), "%02d:%02d", (wd->value / 60) % 24, wd->value % 60);
+        _Text(wd, clock);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Drop every widget. Widgets added next are drawn in color on bkcolor unless set otherwise */
+void LibEpdWidgetInit(unsigned char color, unsigned char bkcolor)
+{
+    if (!s_scene_ready)
+    {
+        LibEpdSceneInit(&s_scene);
+        s_scene_ready = TRUE;
+    }
+    s_count = 0;
+    s_full = TRUE;
+    s_color = color;
+    s_bkcolor = bkcolor;
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+/* Drop every widget and release the commit buffer */
+void LibEpdWidgetClose(void)
+{
+    if (s_scene_ready)
+    {
+        LibEpdSceneFree(&s_scene);
+        s_scene_ready = FALSE;
+    }
+    s_count = 0;
+}
+
+/* Add a widget of a kind in the bounds, relative to the parent (EPD_WIDGET_SCREEN for none).
+ * It takes the colors of its parent. Returns its handle, -1 if the tree is full */
+int LibEpdWidgetAdd(int parent, int kind, int x0, int y0, int x1, int y1)
+{
+    const widget_t * up = _Get(parent);
+    widget_t * wd;
+
+    if (s_count >= EPD_WIDGET_MAX)
+    {
+        fprintf(stderr, "LibEpdWidgetAdd: more than %d widgets\n", EPD_WIDGET_MAX);
+        return -1;
+    }
+    wd = &s_widget[s_count];
+    memset(wd, 0, sizeof(*wd));
+    wd->kind = kind;
+    wd->parent = (up != NULL) ? parent : EPD_WIDGET_SCREEN;
+    wd->x0 = x0 + ((up != NULL) ? up->x0 : 0);
+    wd->y0 = y0 + ((up != NULL) ? up->y0 : 0);
+    wd->x1 = x1 + ((up != NULL) ? up->x0 : 0);
+    wd->y1 = y1 + ((up != NULL) ? up->y0 : 0);
+    wd->color = (up != NULL) ? up->color : s_color;
+    wd->bkcolor = (up != NULL) ? up->bkcolor : s_bkcolor;
+    wd->font = ASCII32;
+    wd->align = EPD_ALIGN_LEFT;
+    wd->dirty = TRUE;
+    return s_count++;
+}
+
+void LibEpdWidgetSetColor(int w, unsigned char color, unsigned char bkcolor)
+{
+    widget_t * wd = _Get(w);
+
+    if ((wd != NULL) && ((wd->color != color) || (wd->bkcolor != bkcolor)))
+    {
+        wd->color = color;
+        wd->bkcolor = bkcolor;
+        wd->dirty = TRUE;
+    }
+}
+
+/* Font (ASCII32, ASCII48 or ASCII64, the GBK one of the same size too) and alignment of text */
+void LibEpdWidgetSetFont(int w, unsigned char font, int align)
+{
+    widget_t * wd = _Get(w);
+
+    if ((wd != NULL) && ((wd->font != font) || (wd->align != align)))
+    {
+        wd->font = font;
+        wd->align = align;
+        wd->dirty = TRUE;
+    }
+}
+
+/* Text of a label, or bitmap file name of an icon */
+void LibEpdWidgetSetText(int w, const char * gbk)
+{
+    widget_t * wd = _Get(w);
+
+    if ((wd != NULL) && (strncmp(wd->text, gbk, EPD_WIDGET_TEXT - 1) != 0))
+    {
+        strncpy(wd->text, gbk, EPD_WIDGET_TEXT - 1);
+        wd->text[EPD_WIDGET_TEXT - 1] = '\0';
+        wd->dirty = TRUE;
+    }
+}
+
+/* Value of a widget, see the widget kinds */
+void LibEpdWidgetSetValue(int w, int value)
+{
+    widget_t * wd = _Get(w);
+
+    if ((wd != NULL) && (wd->value != value))
+    {
+        wd->value = value;
+        wd->dirty = TRUE;
+    }
+}
+
+/* Redraw a widget at the next commit even if unchanged */
+void LibEpdWidgetInvalidate(int w)
+{
+    widget_t * wd = _Get(w);
+
+    if (wd != NULL)
+    {
+        wd->dirty = TRUE;
+    }
+}
+
+/* Redraw the dirty widgets and update the screen, nothing if none is dirty.
+ * Returns the number of widgets redrawn, -1 on failure */
+int LibEpdWidgetCommit(void)
+{
+    widget_t * wd;
+    int n = 0;
+    int ok;
+    int i;
+
+    /* Parents come before their children, so one pass carries the dirty flags down */
+    for (i = 0; i < s_count; i++)
+    {
+        wd = &s_widget[i];
+        wd->dirty = wd->dirty || s_full || ((wd->parent >= 0) && s_widget[wd->parent].dirty);
+        n += wd->dirty ? 1 : 0;
+    }
+    if ((n == 0) && !s_full)
+    {
+        return 0;
+    }
+    if (!s_scene_ready)
+    {
+        LibEpdSceneInit(&s_scene);
+        s_scene_ready = TRUE;
+    }
+
+    LibEpdSceneReset(&s_scene);
+    LibEpdSceneBegin(&s_scene);
+    if (s_full)
+    {
+        LibEpdSetColor(s_color, s_bkcolor);
+        LibEpdClear();
+    }
+    for (i = 0; i < s_count; i++)
+    {
+        if (s_widget[i].dirty)
+        {
+            _Draw(&s_widget[i]);
+        }
+    }
+    LibEpdUpdate();
+    LibEpdSceneEnd();
+
+    ok = LibEpdSceneSend(&s_scene);
+    s_stats.commits++;
+    s_stats.redrawn += n;
+    s_stats.last_widgets = n;
+    s_stats.last_bytes = s_scene.len;
+    if (!ok)
+    {
+        return -1;
+    }
+    for (i = 0; i < s_count; i++)
+    {
+        s_widget[i].dirty = FALSE;
+    }
+    s_full = FALSE;
+    return n;
+}
+
+void LibEpdWidgetGetStats(lib_epd_widget_stats_t * stats)
+{
+    *stats = s_stats;
+}
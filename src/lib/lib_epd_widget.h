@@ -0,0 +1,56 @@
+/***************************************************************************************************
+ *
+ * @file    lib_epd_widget.h
+ * @brief   API of the retained widgets of the e-paper screen.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_EPD_WIDGET_H
+#define LIB_EPD_WIDGET_H
+
+/* Most widgets in the tree */
+#ifndef EPD_WIDGET_MAX
+#define    EPD_WIDGET_MAX                     32
+#endif
+
+/* Longest text of a label or file name of an icon, in bytes, terminator included */
+#define    EPD_WIDGET_TEXT                    64
+
+/* Parent of the top level widgets */
+#define    EPD_WIDGET_SCREEN                  -1
+
+/* Widget kinds */
+#define    EPD_WIDGET_PANEL                   0       /* Background, border if value is not 0 */
+#define    EPD_WIDGET_LABEL                   1       /* GBK text laid out in the bounds */
+#define    EPD_WIDGET_PROGRESS                2       /* Bar filled to value percent */
+#define    EPD_WIDGET_GAUGE                   3       /* Ring filled to value percent */
+#define    EPD_WIDGET_ICON                    4       /* Bitmap file of the e-paper */
+#define    EPD_WIDGET_CLOCK                   5       /* HH:MM of value minutes since midnight */
+
+/* Counters of the commits */
+typedef struct
+{
+    unsigned long commits;
+    unsigned long redrawn;      /* Widgets redrawn over all commits */
+    int last_widgets;           /* Widgets redrawn by the last commit */
+    int last_bytes;             /* Bytes sent by the last commit, update included */
+} lib_epd_widget_stats_t;
+
+void LibEpdWidgetInit(unsigned char color, unsigned char bkcolor);
+void LibEpdWidgetClose(void);
+
+int LibEpdWidgetAdd(int parent, int kind, int x0, int y0, int x1, int y1);
+void LibEpdWidgetSetColor(int w, unsigned char color, unsigned char bkcolor);
+void LibEpdWidgetSetFont(int w, unsigned char font, int align);
+void LibEpdWidgetSetText(int w, const char * gbk);
+void LibEpdWidgetSetValue(int w, int value);
+void LibEpdWidgetInvalidate(int w);
+
+int LibEpdWidgetCommit(void);
+
+void LibEpdWidgetGetStats(lib_epd_widget_stats_t * stats);
+
+#endif
@@ -0,0 +1,191 @@
+/***************************************************************************************************
+ *
+ * @file    lib_gbk.c
+ * @brief   UTF-8 to GBK converter.
+ *
+ *          A two level table indexed by the code point replaces iconv. Runs of ASCII are found
+ *          a word (or an SSE2 vector) at a time and copied as they are, so mostly ASCII labels
+ *          cost little more than a strcpy.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <stdint.h>
+#include "common.h"
+#include "lib_gbk.h"
+#include "lib_gbk_table.h"
+
+#define GBK_ONES    ((unsigned long) -1 / 0xFF)     /* 0x01 in every byte */
+#define GBK_HIGHS   (GBK_ONES * 0x80)               /* 0x80 in every byte */
+
+/* Next code point of a UTF-8 string, U+FFFD for a malformed sequence.
+ * *p is moved past it, never past the terminating NUL */
+unsigned long LibGbkUtf8Next(const unsigned char ** p)
+{
+    const unsigned char * s = *p;
+    unsigned long cp;
+    int more;
+    int i;
+
+    if (s[0] < 0x80)
+    {
+        *p = s + 1;
+        return s[0];
+    }
+    if ((s[0] & 0xE0) == 0xC0)
+    {
+        cp = s[0] & 0x1F;
+        more = 1;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        cp = s[0] & 0x0F;
+        more = 2;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        cp = s[0] & 0x07;
+        more = 3;
+    }
+    else
+    {
+        *p = s + 1;
+        return 0xFFFD;
+    }
+    for (i = 1; i <= more; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *p = s + i;
+            return 0xFFFD;
+        }
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+    *p = s + more + 1;
+    return cp;
+}
+
+/* GBK code of a code point, first byte high; ASCII as it is, 0 if GBK does not have it */
+unsigned int LibGbkFromUnicode(unsigned long cp)
+{
+    int page;
+
+    if (cp < 0x80)
+    {
+        return cp;
+    }
+    if (cp > 0xFFFF)
+    {
+        return 0;
+    }
+    page = c_gbk_page[cp >> 8];
+    return (page == 0) ? 0 : c_gbk_code[page - 1][cp & 0xFF];
+}
+
+/* Number of ASCII bytes other than NUL at the start of s, at most max.
+ * Whole words are read from aligned addresses only, so never across a page end */
+static int _AsciiRun(const unsigned char * s, int max)
+{
+    int n = 0;
+    unsigned long w;
+#if defined(__SSE2__)
+    __m128i v;
+    int mask;
+#endif
+
+    while ((n < max) && (((uintptr_t) (s + n) % sizeof(unsigned long)) != 0))
+    {
+        if ((s[n] == 0) || (s[n] >= 0x80))
+        {
+            return n;
+        }
+        n++;
+    }
+#if defined(__SSE2__)
+    /* Word by word up to the next 16 byte boundary */
+    while ((n + (int) sizeof(w) <= max) && ((uintptr_t) (s + n) % 16 != 0))
+    {
+        memcpy(&w, s + n, sizeof(w));
+        if (((w | ((w - GBK_ONES) & ~w)) & GBK_HIGHS) != 0)
+        {
+            break;
+        }
+        n += sizeof(w);
+    }
+    while ((n + 16 <= max) && ((uintptr_t) (s + n) % 16 == 0))
+    {
+        v = _mm_load_si128((const __m128i *) (s + n));
+        mask = _mm_movemask_epi8(v) | _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+        if (mask != 0)
+        {
+            break;
+        }
+        n += 16;
+    }
+#endif
+    while (n + (int) sizeof(w) <= max)
+    {
+        memcpy(&w, s + n, sizeof(w));
+        /* High bit set, or a zero byte */
+        if (((w | ((w - GBK_ONES) & ~w)) & GBK_HIGHS) != 0)
+        {
+            break;
+        }
+        n += sizeof(w);
+    }
+    while ((n < max) && (s[n] != 0) && (s[n] < 0x80))
+    {
+        n++;
+    }
+    return n;
+}
+
+/* Convert UTF-8 text to GBK into size bytes, NUL included, GBK_REPLACEMENT for what GBK does
+ * not have. Text that does not fit is cut at a character boundary.
+ * Returns the number of bytes written, NUL excluded */
+int LibGbkFromUtf8(const char * utf8, unsigned char * gbk, int size)
+{
+    const unsigned char * s = (const unsigned char *) utf8;
+    unsigned int code;
+    int len = 0;
+    int n;
+
+    if (size <= 0)
+    {
+        return 0;
+    }
+    size--;     /* Room for the NUL */
+    while (*s != '\0')
+    {
+        n = _AsciiRun(s, size - len);
+        memcpy(gbk + len, s, n);
+        len += n;
+        s += n;
+        if ((*s == '\0') || (len == size))
+        {
+            break;
+        }
+
+        code = LibGbkFromUnicode(LibGbkUtf8Next(&s));
+        if (code < 0x100)
+        {
+            gbk[len++] = (code == 0) ? GBK_REPLACEMENT : code;
+        }
+        else if (len + 2 <= size)
+        {
+            gbk[len++] = code >> 8;
+            gbk[len++] = code & 0xFF;
+        }
+        else
+        {
+            break;
+        }
+    }
+    gbk[len] = '\0';
+    return len;
+}
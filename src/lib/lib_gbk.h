@@ -0,0 +1,21 @@
+/***************************************************************************************************
+ *
+ * @file    lib_gbk.h
+ * @brief   API of the UTF-8 to GBK converter.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_GBK_H
+#define LIB_GBK_H
+
+/* Written for a character GBK does not have */
+#define    GBK_REPLACEMENT                    '?'
+
+unsigned long LibGbkUtf8Next(const unsigned char ** p);
+unsigned int LibGbkFromUnicode(unsigned long cp);
+int LibGbkFromUtf8(const char * utf8, unsigned char * gbk, int size);
+
+#endif
@@ -0,0 +1,537 @@
+/***************************************************************************************************
+ *
+ * @file    lib_qr.c
+ * @brief   QR code encoder (ISO/IEC 18004), byte mode, versions 1 to 40.
+ *
+ *          The smallest version that holds the data at the requested error correction level is
+ *          used. The mask is the given one, or the one with the lowest penalty score.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_qr.h"
+
+#define QR_MAX_CODEWORDS    3706    /* Raw codewords of version 40 */
+
+/* Error correction codewords per block, by level and version */
+static const signed char c_qr_ecc_per_block[4][41] =
+{
+    { -1,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28,
+          28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+    { -1, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26,
+          26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28 },
+    { -1, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30,
+          28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+    { -1, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28,
+          30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+};
+
+/* Error correction blocks, by level and version */
+static const signed char c_qr_blocks[4][41] =
+{
+    { -1,  1,  1,  1,  1,  1,  2,  2,  2,  2,  4,  4,  4,  4,  4,  6,  6,  6,  6,  7,  8,
+           8,  9,  9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25 },
+    { -1,  1,  1,  1,  2,  2,  4,  4,  4,  5,  5,  5,  8,  9,  9, 10, 10, 11, 13, 14, 16,
+          17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49 },
+    { -1,  1,  1,  2,  2,  4,  4,  6,  6,  8,  8,  8, 10, 12, 16, 12, 17, 16, 18, 21, 20,
+          23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68 },
+    { -1,  1,  1,  2,  4,  4,  4,  5,  6,  8,  8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25,
+          25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81 },
+};
+
+/* Level as written in the format information */
+static const int c_qr_ecl_bits[4] = { 1, 0, 3, 2 };
+
+/* Matrix being built */
+typedef struct
+{
+    int size;
+    unsigned char * modules;                        /* 1 = dark */
+    unsigned char function[QR_MAX_SIZE * QR_MAX_SIZE];    /* 1 = not a data module */
+} qr_t;
+
+static int _RawModules(int ver)
+{
+    int result = (16 * ver + 128) * ver + 64;
+    int align;
+
+    if (ver >= 2)
+    {
+        align = ver / 7 + 2;
+        result -= (25 * align - 10) * align - 55;
+        if (ver >= 7)
+        {
+            result -= 36;
+        }
+    }
+    return result;
+}
+
+static int _DataCodewords(int ver, int ecl)
+{
+    return _RawModules(ver) / 8 - c_qr_ecc_per_block[ecl][ver] * c_qr_blocks[ecl][ver];
+}
+
+/* GF(2^8) product, modulo x^8 + x^4 + x^3 + x^2 + 1 */
+static unsigned char _GfMul(unsigned char x, unsigned char y)
+{
+    int z = 0;
+    int i;
+
+    for (i = 7; i >= 0; i--)
+    {
+        z = (z << 1) ^ ((z >> 7) * 0x11D);
+        z ^= ((y >> i) & 1) * x;
+    }
+    return (unsigned char) z;
+}
+
+/* Reed-Solomon generator polynomial of the given degree, leading term omitted */
+static void _RsDivisor(int degree, unsigned char * result)
+{
+    unsigned char root = 1;
+    int i;
+    int j;
+
+    memset(result, 0, degree);
+    result[degree - 1] = 1;
+    for (i = 0; i < degree; i++)
+    {
+        for (j = 0; j < degree; j++)
+        {
+            result[j] = _GfMul(result[j], root);
+            if (j + 1 < degree)
+            {
+                result[j] ^= result[j + 1];
+            }
+        }
+        root = _GfMul(root, 0x02);
+    }
+}
+
+static void _RsRemainder(const unsigned char * data, int len, const unsigned char * divisor,
+        int degree, unsigned char * result)
+{
+    unsigned char factor;
+    int i;
+    int j;
+
+    memset(result, 0, degree);
+    for (i = 0; i < len; i++)
+    {
+        factor = data[i] ^ result[0];
+        memmove(result, result + 1, degree - 1);
+        result[degree - 1] = 0;
+        for (j = 0; j < degree; j++)
+        {
+            result[j] ^= _GfMul(divisor[j], factor);
+        }
+    }
+}
+
+/* Split the data into blocks, add their ECC and interleave everything */
+static void _AddEcc(const unsigned char * data, int ver, int ecl, unsigned char * result)
+{
+    unsigned char divisor[30];
+    unsigned char ecc[30];
+    int blocks = c_qr_blocks[ecl][ver];
+    int ecc_len = c_qr_ecc_per_block[ecl][ver];
+    int raw = _RawModules(ver) / 8;
+    int data_len = _DataCodewords(ver, ecl);
+    int short_blocks = blocks - raw % blocks;
+    int short_len = raw / blocks - ecc_len;
+    int len;
+    int i;
+    int j;
+    int k;
+
+    _RsDivisor(ecc_len, divisor);
+    for (i = 0; i < blocks; i++)
+    {
+        len = short_len + ((i < short_blocks) ? 0 : 1);
+        _RsRemainder(data, len, divisor, ecc_len, ecc);
+        for (j = 0, k = i; j < len; j++, k += blocks)
+        {
+            if (j == short_len)
+            {
+                k -= short_blocks;
+            }
+            result[k] = data[j];
+        }
+        for (j = 0, k = data_len + i; j < ecc_len; j++, k += blocks)
+        {
+            result[k] = ecc[j];
+        }
+        data += len;
+    }
+}
+
+static void _Set(qr_t * qr, int x, int y, int dark)
+{
+    qr->modules[y * qr->size + x] = dark ? 1 : 0;
+    qr->function[y * qr->size + x] = 1;
+}
+
+static int _Abs(int v)
+{
+    return (v < 0) ? -v : v;
+}
+
+static int _Max(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
+static void _DrawFinder(qr_t * qr, int cx, int cy)
+{
+    int dx;
+    int dy;
+    int d;
+
+    for (dy = -4; dy <= 4; dy++)
+    {
+        for (dx = -4; dx <= 4; dx++)
+        {
+            d = _Max(_Abs(dx), _Abs(dy));
+            if ((cx + dx >= 0) && (cx + dx < qr->size) && (cy + dy >= 0) && (cy + dy < qr->size))
+            {
+                _Set(qr, cx + dx, cy + dy, (d != 2) && (d != 4));
+            }
+        }
+    }
+}
+
+static void _DrawFormat(qr_t * qr, int ecl, int mask)
+{
+    int data = (c_qr_ecl_bits[ecl] << 3) | mask;
+    int rem = data;
+    int bits;
+    int i;
+
+    for (i = 0; i < 10; i++)
+    {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    }
+    bits = ((data << 10) | rem) ^ 0x5412;
+
+    for (i = 0; i <= 5; i++)
+    {
+        _Set(qr, 8, i, (bits >> i) & 1);
+    }
+    _Set(qr, 8, 7, (bits >> 6) & 1);
+    _Set(qr, 8, 8, (bits >> 7) & 1);
+    _Set(qr, 7, 8, (bits >> 8) & 1);
+    for (i = 9; i < 15; i++)
+    {
+        _Set(qr, 14 - i, 8, (bits >> i) & 1);
+    }
+    for (i = 0; i < 8; i++)
+    {
+        _Set(qr, qr->size - 1 - i, 8, (bits >> i) & 1);
+    }
+    for (i = 8; i < 15; i++)
+    {
+        _Set(qr, 8, qr->size - 15 + i, (bits >> i) & 1);
+    }
+    _Set(qr, 8, qr->size - 8, 1);
+}
+
+static void _DrawFunctions(qr_t * qr, int ver, int ecl)
+{
+    int pos[7];
+    int align;
+    int step;
+    int rem;
+    int bits;
+    int last;
+    int i;
+    int j;
+    int dx;
+    int dy;
+
+    /* Timing patterns */
+    for (i = 0; i < qr->size; i++)
+    {
+        _Set(qr, 6, i, i % 2 == 0);
+        _Set(qr, i, 6, i % 2 == 0);
+    }
+
+    _DrawFinder(qr, 3, 3);
+    _DrawFinder(qr, qr->size - 4, 3);
+    _DrawFinder(qr, 3, qr->size - 4);
+
+    /* Alignment patterns, except where they would hit a finder */
+    if (ver > 1)
+    {
+        align = ver / 7 + 2;
+        step = (ver == 32) ? 26 : (ver * 4 + align * 2 + 1) / (align * 2 - 2) * 2;
+        pos[0] = 6;
+        for (i = align - 1, j = qr->size - 7; i >= 1; i--, j -= step)
+        {
+            pos[i] = j;
+        }
+        last = align - 1;
+        for (i = 0; i < align; i++)
+        {
+            for (j = 0; j < align; j++)
+            {
+                if (((i == 0) && (j == 0)) || ((i == 0) && (j == last))
+                        || ((i == last) && (j == 0)))
+                {
+                    continue;
+                }
+                for (dy = -2; dy <= 2; dy++)
+                {
+                    for (dx = -2; dx <= 2; dx++)
+                    {
+                        _Set(qr, pos[i] + dx, pos[j] + dy, _Max(_Abs(dx), _Abs(dy)) != 1);
+                    }
+                }
+            }
+        }
+    }
+
+    /* Reserve the format areas, written for real once the mask is known */
+    _DrawFormat(qr, ecl, 0);
+
+    if (ver >= 7)
+    {
+        rem = ver;
+        for (i = 0; i < 12; i++)
+        {
+            rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+        }
+        bits = (ver << 12) | rem;
+        for (i = 0; i < 18; i++)
+        {
+            _Set(qr, qr->size - 11 + i % 3, i / 3, (bits >> i) & 1);
+            _Set(qr, i / 3, qr->size - 11 + i % 3, (bits >> i) & 1);
+        }
+    }
+}
+
+/* Place the codewords in the zigzag order */
+static void _DrawCodewords(qr_t * qr, const unsigned char * data, int len)
+{
+    int i = 0;
+    int right;
+    int vert;
+    int j;
+    int x;
+    int y;
+    int upward;
+
+    for (right = qr->size - 1; right >= 1; right -= 2)
+    {
+        if (right == 6)
+        {
+            right = 5;
+        }
+        upward = ((right + 1) & 2) == 0;
+        for (vert = 0; vert < qr->size; vert++)
+        {
+            for (j = 0; j < 2; j++)
+            {
+                x = right - j;
+                y = upward ? qr->size - 1 - vert : vert;
+                if (!qr->function[y * qr->size + x] && (i < len * 8))
+                {
+                    qr->modules[y * qr->size + x] = (data[i >> 3] >> (7 - (i & 7))) & 1;
+                    i++;
+                }
+            }
+        }
+    }
+}
+
+static void _ApplyMask(qr_t * qr, int mask)
+{
+    int x;
+    int y;
+    int invert;
+
+    for (y = 0; y < qr->size; y++)
+    {
+        for (x = 0; x < qr->size; x++)
+        {
+            switch (mask)
+            {
+            case 0:  invert = (x + y) % 2 == 0;                      break;
+            case 1:  invert = y % 2 == 0;                            break;
+            case 2:  invert = x % 3 == 0;                            break;
+            case 3:  invert = (x + y) % 3 == 0;                      break;
+            case 4:  invert = (x / 3 + y / 2) % 2 == 0;              break;
+            case 5:  invert = x * y % 2 + x * y % 3 == 0;            break;
+            case 6:  invert = (x * y % 2 + x * y % 3) % 2 == 0;      break;
+            default: invert = ((x + y) % 2 + x * y % 3) % 2 == 0;    break;
+            }
+            if (invert && !qr->function[y * qr->size + x])
+            {
+                qr->modules[y * qr->size + x] ^= 1;
+            }
+        }
+    }
+}
+
+static int _Module(const qr_t * qr, int x, int y, int transpose)
+{
+    return transpose ? qr->modules[x * qr->size + y] : qr->modules[y * qr->size + x];
+}
+
+/* Penalty score of the masked matrix, rules N1 to N4 */
+static int _Penalty(const qr_t * qr)
+{
+    static const unsigned char c_finder[11] = { 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0 };
+    int score = 0;
+    int dark = 0;
+    int total = qr->size * qr->size;
+    int t;
+    int x;
+    int y;
+    int i;
+    int run;
+    int fwd;
+    int bwd;
+    int c;
+
+    for (t = 0; t < 2; t++)
+    {
+        for (y = 0; y < qr->size; y++)
+        {
+            run = 1;
+            for (x = 1; x <= qr->size; x++)
+            {
+                if ((x < qr->size) && (_Module(qr, x, y, t) == _Module(qr, x - 1, y, t)))
+                {
+                    run++;
+                    continue;
+                }
+                if (run >= 5)
+                {
+                    score += 3 + (run - 5);
+                }
+                run = 1;
+            }
+            for (x = 0; x + 11 <= qr->size; x++)
+            {
+                fwd = TRUE;
+                bwd = TRUE;
+                for (i = 0; i < 11; i++)
+                {
+                    fwd = fwd && (_Module(qr, x + i, y, t) == c_finder[i]);
+                    bwd = bwd && (_Module(qr, x + i, y, t) == c_finder[10 - i]);
+                }
+                score += (fwd ? 40 : 0) + (bwd ? 40 : 0);
+            }
+        }
+    }
+
+    for (y = 0; y < qr->size; y++)
+    {
+        for (x = 0; x < qr->size; x++)
+        {
+            c = _Module(qr, x, y, 0);
+            dark += c;
+            if ((x + 1 < qr->size) && (y + 1 < qr->size) && (c == _Module(qr, x + 1, y, 0))
+                    && (c == _Module(qr, x, y + 1, 0)) && (c == _Module(qr, x + 1, y + 1, 0)))
+            {
+                score += 3;
+            }
+        }
+    }
+    score += ((_Abs(dark * 20 - total * 10) + total - 1) / total - 1) * 10;
+
+    return score;
+}
+
+/* Encode bytes into a QR code.
+ * mask:    0 to 7, or -1 to pick the best one
+ * modules: QR_MAX_SIZE * QR_MAX_SIZE bytes, receives size rows of size modules, 1 = dark
+ * Returns the number of modules per side, 0 if the data does not fit */
+int LibQrEncode(const unsigned char * data, int len, int ecl, int mask, unsigned char * modules)
+{
+    unsigned char codewords[QR_MAX_CODEWORDS];
+    unsigned char all[QR_MAX_CODEWORDS];
+    qr_t qr;
+    int ver;
+    int capacity = 0;
+    int count_bits = 8;
+    int bits = 0;
+    int i;
+    int m;
+    int score;
+    int best = -1;
+    int best_score = 0;
+
+    if ((ecl < QR_ECC_L) || (ecl > QR_ECC_H) || (len < 0) || (mask < -1) || (mask > 7))
+    {
+        return 0;
+    }
+    for (ver = 1; ver <= 40; ver++)
+    {
+        count_bits = (ver < 10) ? 8 : 16;
+        capacity = _DataCodewords(ver, ecl) * 8;
+        if (4 + count_bits + len * 8 <= capacity)
+        {
+            break;
+        }
+    }
+    if (ver > 40)
+    {
+        return 0;
+    }
+
+    /* Byte mode segment, terminator and padding */
+    memset(codewords, 0, sizeof(codewords));
+#define QR_PUT(value, n)                                                        \
+    for (i = (n) - 1; i >= 0; i--, bits++)                                      \
+    {                                                                           \
+        codewords[bits >> 3] |= (((value) >> i) & 1) << (7 - (bits & 7));       \
+    }
+    QR_PUT(0x4, 4);
+    QR_PUT(len, count_bits);
+    for (m = 0; m < len; m++)
+    {
+        QR_PUT(data[m], 8);
+    }
+#undef QR_PUT
+    bits += (capacity - bits < 4) ? capacity - bits : 4;
+    bits = (bits + 7) & ~7;
+    for (i = bits / 8, m = 0; i < capacity / 8; i++, m ^= 1)
+    {
+        codewords[i] = m ? 0x11 : 0xEC;
+    }
+
+    _AddEcc(codewords, ver, ecl, all);
+
+    qr.size = ver * 4 + 17;
+    qr.modules = modules;
+    memset(modules, 0, qr.size * qr.size);
+    memset(qr.function, 0, sizeof(qr.function));
+    _DrawFunctions(&qr, ver, ecl);
+    _DrawCodewords(&qr, all, _RawModules(ver) / 8);
+
+    if (mask < 0)
+    {
+        for (m = 0; m < 8; m++)
+        {
+            _ApplyMask(&qr, m);
+            _DrawFormat(&qr, ecl, m);
+            score = _Penalty(&qr);
+            if ((best < 0) || (score < best_score))
+            {
+                best = m;
+                best_score = score;
+            }
+            _ApplyMask(&qr, m);     /* XOR undoes it */
+        }
+        mask = best;
+    }
+    _ApplyMask(&qr, mask);
+    _DrawFormat(&qr, ecl, mask);
+
+    return qr.size;
+}
@@ -0,0 +1,25 @@
+/***************************************************************************************************
+ *
+ * @file    lib_qr.h
+ * @brief   API of the QR code encoder.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_QR_H
+#define LIB_QR_H
+
+/* Error correction levels */
+#define    QR_ECC_L                           0       /* ~7% */
+#define    QR_ECC_M                           1       /* ~15% */
+#define    QR_ECC_Q                           2       /* ~25% */
+#define    QR_ECC_H                           3       /* ~30% */
+
+/* Modules per side of version 40 */
+#define    QR_MAX_SIZE                        177
+
+int LibQrEncode(const unsigned char * data, int len, int ecl, int mask, unsigned char * modules);
+
+#endif
@@ -0,0 +1,857 @@
+/***************************************************************************************************
+ *
+ * @file    lib_ttf.c
+ * @brief   TrueType font reader and rasterizer.
+ *
+ *          Only what text drawing needs: the cmap (format 4 or 12), horizontal metrics and the
+ *          quadratic outlines of the glyf table, simple and composite. Hinting is ignored.
+ *          Outlines are flattened to edges and filled with the non-zero rule, 4 samples per
+ *          pixel vertically and exact coverage horizontally.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#include "common.h"
+#include "lib_ttf.h"
+#include "lib_epd_mem.h"
+
+#define TTF_SUBSAMPLES      4       /* Scanlines per pixel row */
+#define TTF_MAX_DEPTH       4       /* Composite glyph nesting */
+#define TTF_MAX_STEPS       16      /* Segments per curve */
+
+/* Edge, y0 < y1 */
+typedef struct
+{
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    int dir;
+} ttf_edge_t;
+
+/* Outline being flattened */
+typedef struct
+{
+    ttf_edge_t * edges;
+    int num;
+    int size;
+    float m[6];             /* Font units to pixels: x' = m0 x + m2 y + m4, y' = m1 x + m3 y + m5 */
+} ttf_outline_t;
+
+/* Crossing of a scanline */
+typedef struct
+{
+    float x;
+    int dir;
+} ttf_cross_t;
+
+static int s_font_id = 0;
+
+static int _U16(const unsigned char * p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static int _S16(const unsigned char * p)
+{
+    return (short) ((p[0] << 8) | p[1]);
+}
+
+static long _U32(const unsigned char * p)
+{
+    return ((long) p[0] << 24) | ((long) p[1] << 16) | ((long) p[2] << 8) | p[3];
+}
+
+/* Whether len bytes at off are inside the file */
+static int _In(const lib_ttf_t * font, long off, long len)
+{
+    return (off >= 0) && (len >= 0) && (off + len <= font->size);
+}
+
+static long _Table(const lib_ttf_t * font, const char * tag, long min_len)
+{
+    int num = _U16(font->data + 4);
+    const unsigned char * rec;
+    int i;
+
+    for (i = 0; i < num; i++)
+    {
+        rec = font->data + 12 + i * 16;
+        if (_In(font, 12 + i * 16, 16) && (memcmp(rec, tag, 4) == 0))
+        {
+            if (_In(font, _U32(rec + 8), min_len) && (_U32(rec + 12) >= min_len))
+            {
+                return _U32(rec + 8);
+            }
+            break;
+        }
+    }
+    return -1;
+}
+
+/* Pick the Unicode cmap subtable, full repertoire first */
+static int _FindCmap(lib_ttf_t * font, long cmap)
+{
+    int num = _U16(font->data + cmap + 2);
+    long sub;
+    int format;
+    int i;
+
+    font->cmap = -1;
+    for (i = 0; (i < num) && _In(font, cmap + 4 + i * 8, 8); i++)
+    {
+        sub = cmap + _U32(font->data + cmap + 4 + i * 8 + 4);
+        if (!_In(font, sub, 16))
+        {
+            continue;
+        }
+        format = _U16(font->data + sub);
+        if ((format == 12) && _In(font, sub, _U32(font->data + sub + 4)))
+        {
+            font->cmap = sub;
+            font->cmap_format = 12;
+            return TRUE;
+        }
+        if ((format == 4) && (font->cmap < 0) && _In(font, sub, _U16(font->data + sub + 2))
+                && _In(font, sub, 16 + _U16(font->data + sub + 6) * 4))
+        {
+            font->cmap = sub;
+            font->cmap_format = 4;
+        }
+    }
+    return font->cmap >= 0;
+}
+
+/* Load a .ttf file, returns TRUE on success */
+int LibTtfLoad(lib_ttf_t * font, const char * path)
+{
+    FILE * fd;
+    long head;
+    long maxp;
+    long hhea;
+    long cmap;
+
+    memset(font, 0, sizeof(*font));
+    fd = fopen(path, "rb");
+    if (fd == NULL)
+    {
+        perror(path);
+        return FALSE;
+    }
+    fseek(fd, 0, SEEK_END);
+    font->size = ftell(fd);
+    fseek(fd, 0, SEEK_SET);
+    font->data = malloc(font->size > 0 ? font->size : 1);
+    if ((font->data == NULL) || (fread(font->data, 1, font->size, fd) != (size_t) font->size))
+    {
+        perror(path);
+        fclose(fd);
+        LibTtfFree(font);
+        return FALSE;
+    }
+    fclose(fd);
+
+    if (!_In(font, 0, 12))
+    {
+        fprintf(stderr, "%s: not a font file\n", path);
+        LibTtfFree(font);
+        return FALSE;
+    }
+    head = _Table(font, "head", 54);
+    maxp = _Table(font, "maxp", 6);
+    hhea = _Table(font, "hhea", 36);
+    cmap = _Table(font, "cmap", 4);
+    font->loca = _Table(font, "loca", 0);
+    font->glyf = _Table(font, "glyf", 0);
+    font->hmtx = _Table(font, "hmtx", 4);
+    if ((head < 0) || (maxp < 0) || (hhea < 0) || (cmap < 0) || (font->loca < 0)
+            || (font->glyf < 0) || (font->hmtx < 0) || !_FindCmap(font, cmap))
+    {
+        fprintf(stderr, "%s: no TrueType outlines or Unicode cmap\n", path);
+        LibTtfFree(font);
+        return FALSE;
+    }
+
+    font->units_per_em = _U16(font->data + head + 18);
+    font->loca_long = _S16(font->data + head + 50);
+    font->num_glyphs = _U16(font->data + maxp + 4);
+    font->ascent = _S16(font->data + hhea + 4);
+    font->descent = _S16(font->data + hhea + 6);
+    font->line_gap = _S16(font->data + hhea + 8);
+    font->num_hmetrics = _U16(font->data + hhea + 34);
+    if ((font->units_per_em == 0) || (font->num_hmetrics == 0)
+            || !_In(font, font->loca, (font->num_glyphs + 1) * (font->loca_long ? 4 : 2))
+            || !_In(font, font->hmtx, font->num_hmetrics * 4))
+    {
+        fprintf(stderr, "%s: broken font tables\n", path);
+        LibTtfFree(font);
+        return FALSE;
+    }
+
+    font->id = ++s_font_id;
+    return TRUE;
+}
+
+void LibTtfFree(lib_ttf_t * font)
+{
+    free(font->data);
+    font->data = NULL;
+    font->size = 0;
+}
+
+/* Glyph index of a Unicode code point, 0 (the missing glyph) if the font has none */
+int LibTtfGlyph(const lib_ttf_t * font, unsigned long cp)
+{
+    const unsigned char * sub = font->data + font->cmap;
+    const unsigned char * seg;
+    long groups;
+    long lo;
+    long hi;
+    long mid;
+    long ro;
+    unsigned long ug;
+    int seg_x2;
+    int i;
+    int g;
+
+    if (font->cmap_format == 12)
+    {
+        groups = _U32(sub + 12);
+        lo = 0;
+        hi = groups - 1;
+        while ((lo <= hi) && _In(font, font->cmap + 16 + hi * 12, 12))
+        {
+            mid = (lo + hi) / 2;
+            seg = sub + 16 + mid * 12;
+            if (cp < (unsigned long) _U32(seg))
+            {
+                hi = mid - 1;
+            }
+            else if (cp > (unsigned long) _U32(seg + 4))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                /* Unsigned, a malformed group must not wrap to a negative glyph */
+                ug = (unsigned long) _U32(seg + 8) + (cp - (unsigned long) _U32(seg));
+                return (ug < (unsigned long) font->num_glyphs) ? (int) ug : 0;
+            }
+        }
+        return 0;
+    }
+
+    if (cp > 0xFFFF)
+    {
+        return 0;
+    }
+    seg_x2 = _U16(sub + 6);
+    for (i = 0; i < seg_x2; i += 2)
+    {
+        if (cp > (unsigned long) _U16(sub + 14 + i))
+        {
+            continue;
+        }
+        if (cp < (unsigned long) _U16(sub + 16 + seg_x2 + i))
+        {
+            return 0;
+        }
+        ro = _U16(sub + 16 + seg_x2 * 3 + i);
+        if (ro == 0)
+        {
+            g = (cp + _U16(sub + 16 + seg_x2 * 2 + i)) & 0xFFFF;
+        }
+        else
+        {
+            ro = font->cmap + 16 + seg_x2 * 3 + i + ro + (cp - _U16(sub + 16 + seg_x2 + i)) * 2;
+            if (!_In(font, ro, 2))
+            {
+                return 0;
+            }
+            g = _U16(font->data + ro);
+            if (g != 0)
+            {
+                g = (g + _U16(sub + 16 + seg_x2 * 2 + i)) & 0xFFFF;
+            }
+        }
+        return (g < font->num_glyphs) ? g : 0;
+    }
+    return 0;
+}
+
+/* Advance width in font units */
+int LibTtfAdvance(const lib_ttf_t * font, int glyph)
+{
+    if (glyph < 0)
+    {
+        return 0;
+    }
+    if (glyph >= font->num_hmetrics)
+    {
+        glyph = font->num_hmetrics - 1;
+    }
+    return _U16(font->data + font->hmtx + glyph * 4);
+}
+
+/* Pixels per font unit at an em size of px pixels */
+float LibTtfScale(const lib_ttf_t * font, int px)
+{
+    return (float) px / font->units_per_em;
+}
+
+/* Offset of the glyph description, -1 if the glyph has no outline */
+static long _GlyphOffset(const lib_ttf_t * font, int glyph)
+{
+    const unsigned char * loca = font->data + font->loca;
+    long start;
+    long end;
+
+    if ((glyph < 0) || (glyph >= font->num_glyphs))
+    {
+        return -1;
+    }
+    if (font->loca_long)
+    {
+        start = _U32(loca + glyph * 4);
+        end = _U32(loca + glyph * 4 + 4);
+    }
+    else
+    {
+        start = _U16(loca + glyph * 2) * 2L;
+        end = _U16(loca + glyph * 2 + 2) * 2L;
+    }
+    if ((end <= start) || !_In(font, font->glyf + start, 10) || !_In(font, font->glyf + end, 0))
+    {
+        return -1;
+    }
+    return font->glyf + start;
+}
+
+static int _Floor(float v)
+{
+    int i = (int) v;
+
+    return (i > v) ? i - 1 : i;
+}
+
+static int _Ceil(float v)
+{
+    int i = (int) v;
+
+    return (i < v) ? i + 1 : i;
+}
+
+/* Box of the glyph in pixels, returns FALSE if it draws nothing */
+int LibTtfBox(const lib_ttf_t * font, int glyph, int px, lib_ttf_box_t * box)
+{
+    float scale = LibTtfScale(font, px);
+    long g = _GlyphOffset(font, glyph);
+    int x1;
+    int y1;
+
+    memset(box, 0, sizeof(*box));
+    if (g < 0)
+    {
+        return FALSE;
+    }
+    box->x0 = _Floor(_S16(font->data + g + 2) * scale);
+    box->y0 = -_Ceil(_S16(font->data + g + 8) * scale);
+    x1 = _Ceil(_S16(font->data + g + 6) * scale);
+    y1 = -_Floor(_S16(font->data + g + 4) * scale);
+    box->w = x1 - box->x0;
+    box->h = y1 - box->y0;
+    return (box->w > 0) && (box->h > 0);
+}
+
+static int _AddEdge(ttf_outline_t * ol, float x0, float y0, float x1, float y1)
+{
+    ttf_edge_t * edges;
+    ttf_edge_t * e;
+
+    if (y0 == y1)
+    {
+        return TRUE;
+    }
+    if (ol->num == ol->size)
+    {
+        ol->size = (ol->size == 0) ? 64 : ol->size * 2;
+        edges = LibEpdMemRealloc(EPD_MEM_SCRATCH, ol->edges, ol->size * sizeof(ttf_edge_t));
+        if (edges == NULL)
+        {
+            return FALSE;
+        }
+        ol->edges = edges;
+    }
+    e = &ol->edges[ol->num++];
+    e->dir = (y0 < y1) ? 1 : -1;
+    e->x0 = (y0 < y1) ? x0 : x1;
+    e->y0 = (y0 < y1) ? y0 : y1;
+    e->x1 = (y0 < y1) ? x1 : x0;
+    e->y1 = (y0 < y1) ? y1 : y0;
+    return TRUE;
+}
+
+/* Flatten the quadratic curve from (x0, y0) through control (cx, cy) to (x1, y1) */
+static int _AddCurve(ttf_outline_t * ol, float x0, float y0, float cx, float cy, float x1, float y1)
+{
+    float dx = x0 - 2 * cx + x1;
+    float dy = y0 - 2 * cy + y1;
+    float dev = ((dx < 0) ? -dx : dx) + ((dy < 0) ? -dy : dy);
+    float t;
+    float px = x0;
+    float py = y0;
+    float nx;
+    float ny;
+    int steps = 1;
+    int i;
+
+    while ((steps * steps < dev * 2) && (steps < TTF_MAX_STEPS))
+    {
+        steps++;
+    }
+    for (i = 1; i <= steps; i++)
+    {
+        t = (float) i / steps;
+        nx = (1 - t) * (1 - t) * x0 + 2 * t * (1 - t) * cx + t * t * x1;
+        ny = (1 - t) * (1 - t) * y0 + 2 * t * (1 - t) * cy + t * t * y1;
+        if (!_AddEdge(ol, px, py, nx, ny))
+        {
+            return FALSE;
+        }
+        px = nx;
+        py = ny;
+    }
+    return TRUE;
+}
+
+/* Flatten one closed contour of n points, on curve flags in on[] */
+static int _AddContour(ttf_outline_t * ol, const float * xs, const float * ys,
+        const unsigned char * on, int n)
+{
+    float sx;
+    float sy;
+    float lx;
+    float ly;
+    float cx = 0;
+    float cy = 0;
+    int pending = FALSE;
+    int first;
+    int ok;
+    int i;
+    int k;
+
+    /* Start on an on-curve point, or between the first two control points */
+    for (first = 0; (first < n) && !on[first]; first++)
+    {
+    }
+    if (first == n)
+    {
+        first = 0;
+        sx = (xs[0] + xs[1 % n]) / 2;
+        sy = (ys[0] + ys[1 % n]) / 2;
+    }
+    else
+    {
+        sx = xs[first];
+        sy = ys[first];
+    }
+    lx = sx;
+    ly = sy;
+
+    /* Walk back round to the first point, midpoints between controls are implied on-curve */
+    for (i = 1; i <= n; i++)
+    {
+        k = (first + i) % n;
+        if (on[k])
+        {
+            ok = pending ? _AddCurve(ol, lx, ly, cx, cy, xs[k], ys[k])
+                    : _AddEdge(ol, lx, ly, xs[k], ys[k]);
+            lx = xs[k];
+            ly = ys[k];
+            pending = FALSE;
+        }
+        else
+        {
+            ok = TRUE;
+            if (pending)
+            {
+                ok = _AddCurve(ol, lx, ly, cx, cy, (cx + xs[k]) / 2, (cy + ys[k]) / 2);
+                lx = (cx + xs[k]) / 2;
+                ly = (cy + ys[k]) / 2;
+            }
+            cx = xs[k];
+            cy = ys[k];
+            pending = TRUE;
+        }
+        if (!ok)
+        {
+            return FALSE;
+        }
+    }
+    return pending ? _AddCurve(ol, lx, ly, cx, cy, sx, sy) : TRUE;
+}
+
+static int _AddSimple(const lib_ttf_t * font, ttf_outline_t * ol, long g, int contours)
+{
+    const unsigned char * p;
+    unsigned char * flags;
+    unsigned char * on;
+    float * xs;
+    float * ys;
+    long off;
+    int points;
+    int flag;
+    int count;
+    int x = 0;
+    int y = 0;
+    int start;
+    int end;
+    int i;
+    int result = FALSE;
+
+    off = g + 10 + contours * 2;
+    if (!_In(font, off, 2))
+    {
+        return FALSE;
+    }
+    points = _U16(font->data + off - 2) + 1;
+    off += 2 + _U16(font->data + off);
+
+    flags = LibEpdMemAlloc(EPD_MEM_SCRATCH, points * 2);
+    xs = LibEpdMemAlloc(EPD_MEM_SCRATCH, points * 2 * sizeof(float));
+    if ((flags == NULL) || (xs == NULL))
+    {
+        goto out;
+    }
+    on = flags + points;
+    ys = xs + points;
+
+    for (i = 0; i < points; )
+    {
+        if (!_In(font, off, 1))
+        {
+            goto out;
+        }
+        flag = font->data[off++];
+        count = 1;
+        if (flag & 0x08)
+        {
+            if (!_In(font, off, 1))
+            {
+                goto out;
+            }
+            count += font->data[off++];
+        }
+        while ((count-- > 0) && (i < points))
+        {
+            flags[i++] = flag;
+        }
+    }
+
+    for (i = 0; i < points; i++)
+    {
+        p = font->data + off;
+        if (flags[i] & 0x02)
+        {
+            if (!_In(font, off, 1))
+            {
+                goto out;
+            }
+            x += (flags[i] & 0x10) ? p[0] : -p[0];
+            off++;
+        }
+        else if (!(flags[i] & 0x10))
+        {
+            if (!_In(font, off, 2))
+            {
+                goto out;
+            }
+            x += _S16(p);
+            off += 2;
+        }
+        xs[i] = x;
+    }
+    for (i = 0; i < points; i++)
+    {
+        p = font->data + off;
+        if (flags[i] & 0x04)
+        {
+            if (!_In(font, off, 1))
+            {
+                goto out;
+            }
+            y += (flags[i] & 0x20) ? p[0] : -p[0];
+            off++;
+        }
+        else if (!(flags[i] & 0x20))
+        {
+            if (!_In(font, off, 2))
+            {
+                goto out;
+            }
+            y += _S16(p);
+            off += 2;
+        }
+        ys[i] = y;
+    }
+
+    for (i = 0; i < points; i++)
+    {
+        on[i] = flags[i] & 0x01;
+        x = xs[i];
+        xs[i] = ol->m[0] * x + ol->m[2] * ys[i] + ol->m[4];
+        ys[i] = ol->m[1] * x + ol->m[3] * ys[i] + ol->m[5];
+    }
+
+    for (i = 0, start = 0; i < contours; i++, start = end + 1)
+    {
+        end = _U16(font->data + g + 10 + i * 2);
+        if ((end < start) || (end >= points))
+        {
+            goto out;
+        }
+        if (!_AddContour(ol, xs + start, ys + start, on + start, end - start + 1))
+        {
+            goto out;
+        }
+    }
+    result = TRUE;
+
+out:
+    LibEpdMemFree(EPD_MEM_SCRATCH, xs);
+    LibEpdMemFree(EPD_MEM_SCRATCH, flags);
+    return result;
+}
+
+static int _AddGlyph(const lib_ttf_t * font, ttf_outline_t * ol, int glyph, int depth);
+
+static int _AddComposite(const lib_ttf_t * font, ttf_outline_t * ol, long off, int depth)
+{
+    const unsigned char * p;
+    float saved[6];
+    float a;
+    float b;
+    float c;
+    float d;
+    float e;
+    float f;
+    int flags;
+    int glyph;
+    int len;
+
+    memcpy(saved, ol->m, sizeof(saved));
+    do
+    {
+        if (!_In(font, off, 4))
+        {
+            return FALSE;
+        }
+        p = font->data + off;
+        flags = _U16(p);
+        glyph = _U16(p + 2);
+        len = 4 + ((flags & 0x01) ? 4 : 2);
+        len += (flags & 0x08) ? 2 : (flags & 0x40) ? 4 : (flags & 0x80) ? 8 : 0;
+        if (!_In(font, off, len))
+        {
+            return FALSE;
+        }
+        p += 4;
+        if (flags & 0x01)
+        {
+            e = _S16(p);
+            f = _S16(p + 2);
+            p += 4;
+        }
+        else
+        {
+            e = (signed char) p[0];
+            f = (signed char) p[1];
+            p += 2;
+        }
+        if (!(flags & 0x02))
+        {
+            e = 0;      /* Point matching is not supported */
+            f = 0;
+        }
+        a = 1;
+        b = 0;
+        c = 0;
+        d = 1;
+        if (flags & 0x08)
+        {
+            a = d = _S16(p) / 16384.0f;
+        }
+        else if (flags & 0x40)
+        {
+            a = _S16(p) / 16384.0f;
+            d = _S16(p + 2) / 16384.0f;
+        }
+        else if (flags & 0x80)
+        {
+            a = _S16(p) / 16384.0f;
+            b = _S16(p + 2) / 16384.0f;
+            c = _S16(p + 4) / 16384.0f;
+            d = _S16(p + 6) / 16384.0f;
+        }
+
+        /* Component transform applied first, then the parent one */
+        ol->m[0] = saved[0] * a + saved[2] * b;
+        ol->m[1] = saved[1] * a + saved[3] * b;
+        ol->m[2] = saved[0] * c + saved[2] * d;
+        ol->m[3] = saved[1] * c + saved[3] * d;
+        ol->m[4] = saved[0] * e + saved[2] * f + saved[4];
+        ol->m[5] = saved[1] * e + saved[3] * f + saved[5];
+        if (!_AddGlyph(font, ol, glyph, depth + 1))
+        {
+            return FALSE;
+        }
+        memcpy(ol->m, saved, sizeof(saved));
+        off += len;
+    } while (flags & 0x20);
+
+    return TRUE;
+}
+
+static int _AddGlyph(const lib_ttf_t * font, ttf_outline_t * ol, int glyph, int depth)
+{
+    long g = _GlyphOffset(font, glyph);
+    int contours;
+
+    if (g < 0)
+    {
+        return TRUE;
+    }
+    if (depth > TTF_MAX_DEPTH)
+    {
+        return FALSE;
+    }
+    contours = _S16(font->data + g);
+    if (contours >= 0)
+    {
+        return _AddSimple(font, ol, g, contours);
+    }
+    return _AddComposite(font, ol, g + 10, depth);
+}
+
+/* Add the part of [xa, xb) inside the row, weighted by one scanline */
+static void _Cover(float * row, int w, float xa, float xb)
+{
+    float weight = 1.0f / TTF_SUBSAMPLES;
+    int ia;
+    int ib;
+    int i;
+
+    xa = (xa < 0) ? 0 : xa;
+    xb = (xb > w) ? w : xb;
+    if (xb <= xa)
+    {
+        return;
+    }
+    ia = (int) xa;
+    ib = (int) xb;
+    if (ia == ib)
+    {
+        row[ia] += (xb - xa) * weight;
+        return;
+    }
+    row[ia] += (ia + 1 - xa) * weight;
+    for (i = ia + 1; i < ib; i++)
+    {
+        row[i] += weight;
+    }
+    if (ib < w)
+    {
+        row[ib] += (xb - ib) * weight;
+    }
+}
+
+/* Rasterize the glyph into box->w * box->h coverage bytes, 0 (none) to 255 (full).
+ * Returns FALSE on a broken glyph or out of memory */
+int LibTtfRender(const lib_ttf_t * font, int glyph, int px, const lib_ttf_box_t * box,
+        unsigned char * coverage)
+{
+    ttf_outline_t ol;
+    ttf_cross_t * cross = NULL;
+    ttf_cross_t tmp;
+    float * row = NULL;
+    float scale = LibTtfScale(font, px);
+    float sy;
+    float xa = 0;
+    int num;
+    int wind;
+    int result = FALSE;
+    int r;
+    int s;
+    int i;
+    int j;
+
+    memset(coverage, 0, box->w * box->h);
+    memset(&ol, 0, sizeof(ol));
+    ol.m[0] = scale;
+    ol.m[3] = -scale;
+    ol.m[4] = -box->x0;
+    ol.m[5] = -box->y0;
+    if (!_AddGlyph(font, &ol, glyph, 0))
+    {
+        goto out;
+    }
+
+    cross = LibEpdMemAlloc(EPD_MEM_SCRATCH, (ol.num + 1) * sizeof(ttf_cross_t));
+    row = LibEpdMemAlloc(EPD_MEM_SCRATCH, box->w * sizeof(float));
+    if ((cross == NULL) || (row == NULL))
+    {
+        goto out;
+    }
+
+    for (r = 0; r < box->h; r++)
+    {
+        memset(row, 0, box->w * sizeof(float));
+        for (s = 0; s < TTF_SUBSAMPLES; s++)
+        {
+            sy = r + (s + 0.5f) / TTF_SUBSAMPLES;
+            num = 0;
+            for (i = 0; i < ol.num; i++)
+            {
+                if ((sy >= ol.edges[i].y0) && (sy < ol.edges[i].y1))
+                {
+                    cross[num].x = ol.edges[i].x0 + (sy - ol.edges[i].y0)
+                            * (ol.edges[i].x1 - ol.edges[i].x0) / (ol.edges[i].y1 - ol.edges[i].y0);
+                    cross[num].dir = ol.edges[i].dir;
+                    /* Insertion sort, a scanline crosses few edges */
+                    for (j = num; (j > 0) && (cross[j - 1].x > cross[j].x); j--)
+                    {
+                        tmp = cross[j];
+                        cross[j] = cross[j - 1];
+                        cross[j - 1] = tmp;
+                    }
+                    num++;
+                }
+            }
+            for (i = 0, wind = 0; i < num; i++)
+            {
+                if (wind == 0)
+                {
+                    xa = cross[i].x;
+                }
+                wind += cross[i].dir;
+                if (wind == 0)
+                {
+                    _Cover(row, box->w, xa, cross[i].x);
+                }
+            }
+        }
+        for (i = 0; i < box->w; i++)
+        {
+            coverage[r * box->w + i] = (row[i] >= 1.0f) ? 255 : (unsigned char) (row[i] * 255 + 0.5f);
+        }
+    }
+    result = TRUE;
+
+out:
+    LibEpdMemFree(EPD_MEM_SCRATCH, row);
+    LibEpdMemFree(EPD_MEM_SCRATCH, cross);
+    LibEpdMemFree(EPD_MEM_SCRATCH, ol.edges);
+    return result;
+}
@@ -0,0 +1,53 @@
+/***************************************************************************************************
+ *
+ * @file    lib_ttf.h
+ * @brief   API of the TrueType font reader and rasterizer.
+ *
+ * @author  agent@local
+ * @date    2026/10/19
+ *
+ **************************************************************************************************/
+
+#ifndef LIB_TTF_H
+#define LIB_TTF_H
+
+/* Loaded font file */
+typedef struct
+{
+    unsigned char * data;   /* Whole file */
+    long size;
+    int id;                 /* Unique per load, never reused */
+    int units_per_em;
+    int num_glyphs;
+    int loca_long;          /* 32-bit loca offsets */
+    long loca;              /* Table offsets in data */
+    long glyf;
+    long hmtx;
+    long cmap;              /* Unicode subtable used */
+    int cmap_format;        /* 4 or 12 */
+    int num_hmetrics;
+    int ascent;             /* Font units, y up */
+    int descent;
+    int line_gap;
+} lib_ttf_t;
+
+/* Glyph box in pixels, relative to the pen on the baseline, y down */
+typedef struct
+{
+    int x0;                 /* Left column */
+    int y0;                 /* Top row */
+    int w;
+    int h;
+} lib_ttf_box_t;
+
+int LibTtfLoad(lib_ttf_t * font, const char * path);
+void LibTtfFree(lib_ttf_t * font);
+
+int LibTtfGlyph(const lib_ttf_t * font, unsigned long cp);
+int LibTtfAdvance(const lib_ttf_t * font, int glyph);
+float LibTtfScale(const lib_ttf_t * font, int px);
+int LibTtfBox(const lib_ttf_t * font, int glyph, int px, lib_ttf_box_t * box);
+int LibTtfRender(const lib_ttf_t * font, int glyph, int px, const lib_ttf_box_t * box,
+        unsigned char * coverage);
+
+#endif
@@ -9,6 +9,60 @@
  **************************************************************************************************/
 #include "common.h"
 #include "lib_epd.h"
+#include "lib_clock.h"
+#include "lib_epd_warm.h"
+#if defined(APP_EPD_DAEMON)
+#include "lib_epd_daemon.h"
+#elif defined(APP_EPDCTL)
+#include "lib_epd_ctl.h"
+#include "lib_epd_link.h"
+#endif
+#ifdef BENCH
+#include "lib_epd_chart.h"
+#endif
+
+#if defined(APP_EPDCTL)
+/* epdctl [device [fifo]]: run the commands of stdin, or of the fifo, reopened whenever its
+ * writer goes until "quit", and print the per-update latencies and a summary */
+static int _EpdCtl(int argc, char * argv[])
+{
+    lib_epd_ctl_stats_t st;
+    FILE * in;
+    long long start = LibClockNowUs();
+    double secs;
+    int ret = EPD_CTL_DONE;
+
+    if (!((argc > 1) ? LibEpdInitDev(argv[1], 115200) : LibEpdInitSpeed(115200)))
+    {
+        return 1;
+    }
+    LibEpdSetLowLatency(TRUE);
+    LibEpdLinkOpen(EPD_LINK_WINDOW_MAX);
+    if (argc < 3)
+    {
+        ret = LibEpdCtlRun(stdin, stdout);
+    }
+    while ((argc > 2) && (ret == EPD_CTL_DONE) && ((in = fopen(argv[2], "rb")) != NULL))
+    {
+        ret = LibEpdCtlRun(in, stdout);
+        fclose(in);
+    }
+    if (ret == EPD_CTL_QUIT)
+    {
+        ret = 0;
+    }
+    LibEpdLinkClose();
+
+    LibEpdCtlGetStats(&st);
+    secs = (LibClockNowUs() - start) / 1e6;
+    fprintf(stderr, "epdctl: %lu commands, %lu errors, %lu updates, %lu bytes in %.2f s\n",
+            st.commands, st.errors, st.updates, st.bytes, secs);
+    fprintf(stderr, "epdctl: parsing %.0f commands/s, sending %.2f s\n",
+            (st.parse_us > 0) ? st.commands * 1e6 / st.parse_us : 0.0, st.send_us / 1e6);
+    LibEpdClose();
+    return ret;
+}
+#endif
 
 static void _BaseDraw(void)
 {
@@ -28,7 +82,7 @@ static void _BaseDraw(void)
     }
     LibEpdUpdate();
 
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 
     /* draw line */
     LibEpdClear();
@@ -38,7 +92,7 @@ static void _BaseDraw(void)
         LibEpdDrawLine(799, 0, i, 599);
     }
     LibEpdUpdate();
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 
     /* fill rect */
     LibEpdClear();
@@ -52,7 +106,7 @@ static void _BaseDraw(void)
     LibEpdFillRect(210, 10, 300, 100);
 
     LibEpdUpdate();
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 
     /* draw circle */
     LibEpdSetColor(BLACK, WHITE);
@@ -62,7 +116,7 @@ static void _BaseDraw(void)
         LibEpdDrawCircle(399, 299, i);
     }
     LibEpdUpdate();
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 
     /* fill circle */
     LibEpdClear();
@@ -74,7 +128,7 @@ static void _BaseDraw(void)
         }
     }
     LibEpdUpdate();
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 
     /* draw triangle */
     LibEpdClear();
@@ -84,7 +138,7 @@ static void _BaseDraw(void)
                 449 + i * 50, 349 + i * 50);
     }
     LibEpdUpdate();
-    usleep(3000000);
+    LibClockSleepUs(3000000);
 }
 void DrawTextDemo(void)
 {
@@ -107,7 +161,7 @@ void DrawTextDemo(void)
     LibEpdSetEnFont(ASCII64);
     LibEpdDispString("ASCII64: Aya!", 0, 450);
 
-    usleep(3000000);
+    LibClockSleepUs(3000000);
     LibEpdUpdate();
 }
 
@@ -116,13 +170,13 @@ void DrawBitmapDemo(void)
     LibEpdClear();
     LibEpdDispBitmap("PIC4.BMP", 0, 0);
     LibEpdUpdate();
-    usleep(5000000);
+    LibClockSleepUs(5000000);
 
     LibEpdClear();
     LibEpdDispBitmap("PIC2.BMP", 0, 100);
     LibEpdDispBitmap("PIC3.BMP", 400, 100);
     LibEpdUpdate();
-    usleep(5000000);
+    LibClockSleepUs(5000000);
 
     LibEpdClear();
     LibEpdDispBitmap("FOXB.BMP", 0, 0);
@@ -137,21 +191,27 @@ void EpaperText(char *str, int x, int y)
     LibEpdSetEnFont(ASCII32);
     LibEpdDispString(str, x, y);
 
-    usleep(1000000);
+    LibClockSleepUs(1000000);
     LibEpdUpdate();
 }
 
 void EpaperTest(void)
 {
-    LibEpdInit();
-    LibEpdWakeup();
+    lib_epd_state_t want;
+    int start;
+
+    /* Only the memory mode matters here, the demos set colours and fonts themselves */
+    memset(&want, EPD_UNKNOWN, sizeof(want));
+    want.mem_mode = MEM_TF;
 
     printf("Handshaking...\n");
-    LibEpdHandshake();
-    usleep(1000000);
-    printf("Updating...\n");
-    LibEpdUpdate();
-    LibEpdSetMemory(MEM_TF);
+    start = LibEpdWarmStart(EPD_STATE_FILE, &want);
+    if (start == EPD_START_FAILED)
+    {
+        printf("ERROR: E-paper not ready!\n");
+        return;
+    }
+    printf("%s start\n", (start == EPD_START_WARM) ? "Warm" : "Cold");
 
 #if 1
     /* base Draw demo */
@@ -163,6 +223,7 @@ void EpaperTest(void)
 
     LibEpdClear();
 
+    LibEpdWarmSave(EPD_STATE_FILE);
     LibEpdClose();
 #endif
 
@@ -193,13 +254,93 @@ static void _TypeCheck(void)
     (8 == sizeof(int64)) ? printf("PASS\n") : printf("FAIL\n");
 }
 
-int main(void)
+#ifdef BENCH
+/* Chart decimation speed on a million points, against a plain loop */
+static void _ChartBench(void)
+{
+    const int n = 1000000;
+    const int columns = 800;
+    const int rounds = 20;
+    lib_epd_chart_t chart = { 0, 0, 799, 599, 0.0f, 0.0f };
+    lib_epd_scene_t scene;
+    volatile float sink = 0.0f;
+    float * v;
+    float * col;
+    float lo, hi;
+    long long t0, t1;
+    int i, r, c, start, end;
+
+    v = malloc(n * sizeof(float));
+    col = malloc(3 * columns * sizeof(float));
+    for (i = 0; i < n; i++)
+    {
+        v[i] = (float) (i % 5000) + (float) (rand() % 100);
+    }
+
+    t0 = LibClockNowUs();
+    for (r = 0; r < rounds; r++)
+    {
+        LibEpdChartDecimate(v, n, columns, col, col + columns, col + 2 * columns);
+        sink += col[0];
+    }
+    t1 = LibClockNowUs();
+    printf("Decimate %d points: %.3f ns/point\n", n, (t1 - t0) * 1000.0 / ((double) n * rounds));
+
+    t0 = LibClockNowUs();
+    for (r = 0; r < rounds; r++)
+    {
+        for (c = 0, start = 0; c < columns; c++, start = end)
+        {
+            end = (int) (((long long) (c + 1) * n) / columns);
+            lo = hi = v[start];
+            for (i = start; i < end; i++)
+            {
+                lo = (v[i] < lo) ? v[i] : lo;
+                hi = (v[i] > hi) ? v[i] : hi;
+            }
+            sink += lo + hi;
+        }
+    }
+    t1 = LibClockNowUs();
+    printf("Plain loop %d points: %.3f ns/point\n", n, (t1 - t0) * 1000.0 / ((double) n * rounds));
+
+    LibEpdSceneInit(&scene);
+    LibEpdSceneBegin(&scene);
+    LibEpdChartLine(&chart, v, n);
+    LibEpdSceneEnd();
+    printf("Line chart: %d frames, %d bytes (%d frames as single lines)\n", scene.frames,
+            scene.len, n - 1);
+
+    LibEpdSceneFree(&scene);
+    free(col);
+    free(v);
+}
+#endif
+
+int main(int argc, char * argv[])
 {
 #ifdef DEBUG
     _TypeCheck();
 #endif
-    
+#ifdef BENCH
+    _ChartBench();
+    exit(0);
+#endif
+#ifdef CLOCK_VIRTUAL
+    /* Emulated run: every delay passes in simulated time */
+    LibClockUseVirtual();
+#endif
+
+#if defined(APP_EPD_DAEMON)
+    /* Optional argument: serial device, e.g. a pty for testing */
+    exit(LibEpdDaemonRun(EPD_DAEMON_SOCK, (argc > 1) ? argv[1] : NULL));
+#elif defined(APP_EPDCTL)
+    exit(_EpdCtl(argc, argv));
+#else
+    (void) argc;
+    (void) argv;
     EpaperTest();
+#endif
 
     exit(0);
 }